@@ -172,6 +172,36 @@ public class GarbageCollectorMXBeanImpl
 		return this.getTotalCompactsImpl(id);
 	}
 
+	/**
+	 * Returns the number of objects and references waiting to be finalized or enqueued.
+	 *
+	 * @return number of pending finalization jobs
+	 * @see #getPendingFinalizationCount()
+	 */
+	private native long getPendingFinalizationCountImpl();
+
+	/**
+	 * To satisfy com.ibm.lang.management.GarbageCollectorMXBean.
+	 */
+	public final long getPendingFinalizationCount() {
+		return this.getPendingFinalizationCountImpl();
+	}
+
+	/**
+	 * Returns the time in milliseconds that the oldest pending finalization job has been waiting.
+	 *
+	 * @return age of the oldest pending finalization job, or 0 if there is none
+	 * @see #getOldestPendingFinalizationAge()
+	 */
+	private native long getOldestPendingFinalizationAgeImpl();
+
+	/**
+	 * To satisfy com.ibm.lang.management.GarbageCollectorMXBean.
+	 */
+	public final long getOldestPendingFinalizationAge() {
+		return this.getOldestPendingFinalizationAgeImpl();
+	}
+
 	/**
 	 * To satisfy com.ibm.lang.management.GarbageCollectorMXBean.
 	 */
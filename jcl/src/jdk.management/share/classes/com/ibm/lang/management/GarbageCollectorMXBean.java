@@ -71,4 +71,21 @@ public interface GarbageCollectorMXBean extends
      * @return number of compacts performed
      */
     public long getTotalCompacts();
+
+    /**
+     * Returns the number of objects and references waiting to be finalized or enqueued
+     * by the finalizer threads. The queue is shared by all the collectors.
+     * 
+     * @return number of pending finalization jobs
+     */
+    public long getPendingFinalizationCount();
+
+    /**
+     * Returns the time <em>in milliseconds</em> that the oldest pending finalization
+     * job has been waiting. A steadily increasing value means that finalization does
+     * not keep up with the application; see -Xgc:finalizeWorkerThreads.
+     * 
+     * @return age of the oldest pending finalization job, or 0 if there is none
+     */
+    public long getOldestPendingFinalizationAge();
 }
@@ -364,6 +364,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/runtime/MetaData.cpp \
     compiler/runtime/MetaDataDebug.cpp \
     compiler/runtime/MethodMetaData.c \
+    compiler/runtime/PerfJitDump.cpp \
     compiler/runtime/RelocationRecord.cpp \
     compiler/runtime/RelocationRuntime.cpp \
     compiler/runtime/RelocationRuntimeLogger.cpp \
@@ -402,12 +403,14 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/net/MessageBuffer.cpp \
     compiler/net/Message.cpp \
     compiler/net/ServerStream.cpp \
+    compiler/net/SharedMemoryChannel.cpp \
     compiler/runtime/CompileService.cpp \
     compiler/runtime/JITClientSession.cpp \
     compiler/runtime/JITServerAOTCache.cpp \
     compiler/runtime/JITServerAOTDeserializer.cpp \
     compiler/runtime/JITServerIProfiler.cpp \
     compiler/runtime/JITServerROMClassHash.cpp \
+    compiler/runtime/JITServerSharedProfileCache.cpp \
     compiler/runtime/JITServerSharedROMClassCache.cpp \
     compiler/runtime/JITServerStatisticsThread.cpp \
     compiler/runtime/Listener.cpp
@@ -79,6 +79,7 @@ class ClientSessionHT;
 class JITServerAOTCacheMap;
 class JITServerAOTDeserializer;
 class JITServerSharedROMClassCache;
+class JITServerSharedProfileCache;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 struct TR_SignatureCountPair
@@ -687,6 +688,9 @@ public:
    TR_MethodToBeCompiled *addOutOfProcessMethodToBeCompiled(JITServer::ServerStream *stream);
 #endif /* defined(J9VM_OPT_JITSERVER) */
    void                   queueEntry(TR_MethodToBeCompiled *entry);
+   void                   dequeueEntry(TR_MethodToBeCompiled *entry);
+   TR_MethodToBeCompiled *findQueuedEntry(TR::IlGeneratorMethodDetails &details, TR_FrontEnd *fe);
+   TR_MethodToBeCompiled *findQueuedNonDLTEntry(J9Method *method);
    void                   recycleCompilationEntry(TR_MethodToBeCompiled *cur);
 #if defined(J9VM_OPT_JITSERVER)
    void                   requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry);
@@ -736,6 +740,31 @@ public:
    
    void suspendCompilationThread();
    void resumeCompilationThread();
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+   /**
+    * \brief
+    *    Suspends the compilation threads before a checkpoint and waits a bounded amount of time
+    *    for them to park. A compilation thread frees its cached scratch segment when it suspends,
+    *    so the memory is not part of the checkpoint image.
+    *
+    * \param vmThread
+    *    The thread taking the checkpoint; it holds exclusive VM access.
+    *
+    * \return
+    *    The number of compilation threads that did not park in time.
+    */
+   int32_t suspendCompilationThreadsForCheckpoint(J9VMThread *vmThread);
+   /**
+    * \brief
+    *    Resumes the compilation threads suspended by suspendCompilationThreadsForCheckpoint(),
+    *    after a restore or when the checkpoint failed. Threads that were already suspended
+    *    before the checkpoint are left suspended.
+    *
+    * \param vmThread
+    *    The current thread.
+    */
+   void resumeCompilationThreadsSuspendedForCheckpoint(J9VMThread *vmThread);
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
    void purgeMethodQueue(TR_CompilationErrorCode errorCode);
    void *compileMethod(J9VMThread * context, TR::IlGeneratorMethodDetails &details, void *oldStartPC,
       TR_YesNoMaybe async, TR_CompilationErrorCode *, bool *queued, TR_OptimizationPlan *optPlan);
@@ -1057,6 +1086,18 @@ public:
    const std::string &getJITServerSslRootCerts() const { return _sslRootCerts; }
    void  setJITServerSslRootCerts(const std::string &cert) { _sslRootCerts = cert; }
 
+   // Server side sharing of the compilation threads among clients.
+   // Must be called with the compilation monitor in hand.
+   struct ClientFairShare
+      {
+      uint64_t _virtualTime; // compilation time (ms) the client has received, never behind _fairShareVirtualTime while the client is busy
+      volatile uintptr_t _numCompThreads; // threads working for the client
+      volatile uintptr_t _numParkedThreads; // subset of _numCompThreads parked waiting for an earlier request of the client
+      };
+   TR_MethodToBeCompiled *getNextOutOfProcessEntry(ClientFairShare **chargedShare);
+   ClientFairShare *acquireClientFairShare(uint64_t clientUID);
+   void releaseClientFairShare(ClientFairShare *share, uint64_t compTimeMs);
+
    void setCompThreadActivationPolicy(JITServer::CompThreadActivationPolicy newPolicy) { _activationPolicy = newPolicy; }
    JITServer::CompThreadActivationPolicy getCompThreadActivationPolicy() const { return _activationPolicy; }
    uint64_t getCachedFreePhysicalMemoryB() const { return _cachedFreePhysicalMemoryB; }
@@ -1064,6 +1105,9 @@ public:
    JITServerSharedROMClassCache *getJITServerSharedROMClassCache() const { return _sharedROMClassCache; }
    void setJITServerSharedROMClassCache(JITServerSharedROMClassCache *cache) { _sharedROMClassCache = cache; }
 
+   JITServerSharedProfileCache *getJITServerSharedProfileCache() const { return _sharedProfileCache; }
+   void setJITServerSharedProfileCache(JITServerSharedProfileCache *cache) { _sharedProfileCache = cache; }
+
    JITServerAOTCacheMap *getJITServerAOTCacheMap() const { return _JITServerAOTCacheMap; }
    void setJITServerAOTCacheMap(JITServerAOTCacheMap *map) { _JITServerAOTCacheMap = map; }
 
@@ -1116,11 +1160,32 @@ private:
     */
    TR_MethodToBeCompiled * getCompilationQueueEntry();
 
+   void startCompMonitorHold();
+   void endCompMonitorHold();
+
    J9Method *getRamMethod(TR_FrontEnd *vm, char *className, char *methodName, char *signature);
    //char *buildMethodString(TR_ResolvedMethod *method);
 
    static const size_t DLT_HASHSIZE = 123;
 
+   // The main compilation queue is a list sorted by decreasing priority (FIFO for equal priorities).
+   // To avoid scanning the list, the last entry of every priority present in the queue is remembered
+   // in a small array sorted by decreasing priority, and the queued entries are indexed by J9Method.
+   static const uint32_t METHOD_QUEUE_INDEX_BITS = 10;
+   static const uint32_t METHOD_QUEUE_INDEX_SIZE = 1 << METHOD_QUEUE_INDEX_BITS;
+   static const int32_t  MAX_QUEUE_PRIORITY_SEGMENTS = 32;
+
+   struct QueuePrioritySegment
+      {
+      uint16_t _priority;
+      TR_MethodToBeCompiled *_last; // last entry of this priority in the queue
+      };
+
+   static uint32_t methodQueueIndexBucket(J9Method *method)
+      {
+      return (uint32_t)(((uintptr_t)method >> 3) * 2654435761u) >> (32 - METHOD_QUEUE_INDEX_BITS);
+      }
+
    static TR::CompilationInfo * _compilationRuntime;
 
    static int32_t *_compThreadActivationThresholds;
@@ -1131,6 +1196,9 @@ private:
    TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
    TR::CompilationInfoPerThreadBase *_compInfoForCompOnAppThread; // This is NULL for separate compilation thread
    TR_MethodToBeCompiled *_methodQueue;
+   TR_MethodToBeCompiled *_methodQueueIndex[METHOD_QUEUE_INDEX_SIZE]; // chained through TR_MethodToBeCompiled::_nextInIndex
+   QueuePrioritySegment   _queuePrioritySegments[MAX_QUEUE_PRIORITY_SEGMENTS];
+   int32_t                _numQueuePrioritySegments; // -1 when there were too many distinct priorities; the queue is then scanned
    TR_MethodToBeCompiled *_methodPool;
    int32_t                _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -1199,6 +1267,13 @@ private:
    uint32_t               _statNumDowngradeInterpretedMethod;
    uint32_t               _statNumUpgradeJittedMethod;
    uint32_t               _statNumQueuePromotions;
+   uint32_t               _statNumQueueInsertions;
+   uint64_t               _statNumQueueInsertionScanSteps; // entries visited when the priority segments cannot be used
+   bool                   _trackCompMonitorHoldTime; // set with TR_PrintCompStats
+   uint64_t               _compMonitorAcquireTime; // hires clock when the comp monitor was acquired through acquireCompMonitor
+   uint64_t               _statCompMonitorHoldTime; // usec
+   uint64_t               _statMaxCompMonitorHoldTime; // usec
+   uint32_t               _statNumCompMonitorHolds;
    uint32_t               _statNumGCRInducedCompilations;
    uint32_t               _statNumSamplingJProfilingBodies;
    uint32_t               _statNumJProfilingBodies;
@@ -1270,6 +1345,8 @@ private:
    ClientSessionHT               *_clientSessionHT; // JITServer hashtable that holds session information about JITClients
    PersistentUnorderedSet<J9Class*> _classesCachedAtServer;
    TR::Monitor *_classesCachedAtServerMonitor;
+   PersistentUnorderedMap<uint64_t, ClientFairShare> _clientFairShares; // JITServer compilation time received by each client, keyed by clientUID
+   uint64_t                      _fairShareVirtualTime; // virtual time of the last request taken out of the queue
    PersistentVector<TR_OpaqueClassBlock*> *_unloadedClassesTempList; // JITServer list of classes unloaded
    PersistentVector<TR_OpaqueClassBlock*> *_illegalFinalFieldModificationList; // JITServer list of classes that have J9ClassHasIllegalFinalFieldModifications is set
    TR::Monitor                   *_sequencingMonitor; // Used for ordering outgoing messages at the client
@@ -1283,6 +1360,7 @@ private:
    PersistentVector<std::string> _sslCerts;
    JITServer::CompThreadActivationPolicy _activationPolicy;
    JITServerSharedROMClassCache *_sharedROMClassCache;
+   JITServerSharedProfileCache *_sharedProfileCache;
    JITServerAOTCacheMap *_JITServerAOTCacheMap;
    JITServerAOTDeserializer *_JITServerAOTDeserializer;
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -93,6 +93,7 @@
 #include "env/VMJ9.h"
 #include "env/annotations/AnnotationBase.hpp"
 #include "runtime/MethodMetaData.h"
+#include "runtime/PerfJitDump.hpp"
 #include "env/J9JitMemory.hpp"
 #include "env/J9SegmentCache.hpp"
 #include "env/SystemSegmentProvider.hpp"
@@ -1010,6 +1011,9 @@ TR::CompilationInfoPerThread::CompilationInfoPerThread(TR::CompilationInfo &comp
    _compThreadPriority = J9THREAD_PRIORITY_USER_MAX;
    _compThreadMonitor = TR::Monitor::create("JIT-CompThreadMonitor-??");
    _lastCompilationDuration = 0;
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+   _suspendedForCheckpoint = false;
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
    // name the thread
    //
@@ -1089,6 +1093,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _sslKeys(decltype(_sslKeys)::allocator_type(TR::Compiler->persistentAllocator())),
    _sslCerts(decltype(_sslCerts)::allocator_type(TR::Compiler->persistentAllocator())),
    _classesCachedAtServer(decltype(_classesCachedAtServer)::allocator_type(TR::Compiler->persistentAllocator())),
+   _clientFairShares(decltype(_clientFairShares)::allocator_type(TR::Compiler->persistentAllocator())),
 #endif /* defined(J9VM_OPT_JITSERVER) */
    _persistentMemory(pointer_cast<TR_PersistentMemory *>(jitConfig->scratchSegment)),
    _sharedCacheReloRuntime(jitConfig),
@@ -1117,6 +1122,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    // Initialize the compilation monitor
    //
    _compilationMonitor = TR::Monitor::create("JIT-CompilationQueueMonitor");
+   _trackCompMonitorHoldTime = (feGetEnv("TR_PrintCompStats") != NULL);
    _schedulingMonitor = TR::Monitor::create("JIT-SchedulingMonitor");
 #if defined(J9VM_JIT_DYNAMIC_LOOP_TRANSFER)
    _dltMonitor = TR::Monitor::create("JIT-DLTmonitor");
@@ -1184,11 +1190,13 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _newlyExtendedClasses = NULL;
    _sequencingMonitor = TR::Monitor::create("JIT-SequencingMonitor");
    _classesCachedAtServerMonitor = TR::Monitor::create("JIT-ClassesCachedAtServerMonitor");
+   _fairShareVirtualTime = 0;
    _compReqSeqNo = 0;
    _chTableUpdateFlags = 0;
    _localGCCounter = 0;
    _activationPolicy = JITServer::CompThreadActivationPolicy::AGGRESSIVE;
    _sharedROMClassCache = NULL;
+   _sharedProfileCache = NULL;
    _JITServerAOTCacheMap = NULL;
 #endif /* defined(J9VM_OPT_JITSERVER) */
    }
@@ -1423,22 +1431,57 @@ void TR::CompilationInfo::rtlogRelease()
 void TR::CompilationInfo::acquireCompMonitor(J9VMThread *vmThread) // used when we know we have a compilation monitor
    {
    getCompilationMonitor()->enter();
+   if (_trackCompMonitorHoldTime)
+      startCompMonitorHold();
    }
 
 void TR::CompilationInfo::releaseCompMonitor(J9VMThread *vmThread) // used when we know we have a compilation monitor
    {
+   if (_trackCompMonitorHoldTime)
+      endCompMonitorHold();
    getCompilationMonitor()->exit();
    }
 
 void TR::CompilationInfo::waitOnCompMonitor(J9VMThread *vmThread)
    {
+   if (_trackCompMonitorHoldTime)
+      endCompMonitorHold();
    getCompilationMonitor()->wait();
+   if (_trackCompMonitorHoldTime)
+      startCompMonitorHold();
+   }
+
+// Hold times are only measured for the critical sections delimited by acquireCompMonitor/releaseCompMonitor.
+// Nested acquisitions are not tracked separately, so the numbers are an approximation.
+// Must have the compilation monitor in hand.
+void TR::CompilationInfo::startCompMonitorHold()
+   {
+   PORT_ACCESS_FROM_JAVAVM(_jitConfig->javaVM);
+   _compMonitorAcquireTime = j9time_hires_clock();
+   }
+
+void TR::CompilationInfo::endCompMonitorHold()
+   {
+   if (_compMonitorAcquireTime)
+      {
+      PORT_ACCESS_FROM_JAVAVM(_jitConfig->javaVM);
+      uint64_t holdTime = j9time_hires_delta(_compMonitorAcquireTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+      _compMonitorAcquireTime = 0;
+      _statCompMonitorHoldTime += holdTime;
+      _statNumCompMonitorHolds++;
+      if (holdTime > _statMaxCompMonitorHoldTime)
+         _statMaxCompMonitorHoldTime = holdTime;
+      }
    }
 
 intptr_t TR::CompilationInfo::waitOnCompMonitorTimed(J9VMThread *vmThread, int64_t millis, int32_t nanos)
    {
    intptr_t retCode;
+   if (_trackCompMonitorHoldTime)
+      endCompMonitorHold();
    retCode = getCompilationMonitor()->wait_timed(millis, nanos);
+   if (_trackCompMonitorHoldTime)
+      startCompMonitorHold();
    return retCode;
    }
 
@@ -1931,7 +1974,6 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class * clazz, J9
 
    // if compiling on app thread, there is no compilation queue
    TR_MethodToBeCompiled *cur = _methodQueue;
-   TR_MethodToBeCompiled *prev = NULL;
    while (cur)
       {
       TR_MethodToBeCompiled *next = cur->_next;
@@ -1956,20 +1998,13 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class * clazz, J9
             }
 
          // detach from queue
-         if (prev)
-            prev->_next = cur->_next;
-         else
-            _methodQueue = cur->_next;
+         dequeueEntry(cur);
          updateCompQueueAccountingOnDequeue(cur);
          // decrease the queue weight
          decreaseQueueWeightBy(cur->_weight);
          // put back into the pool
          recycleCompilationEntry(cur);
          }
-      else
-         {
-         prev = cur;
-         }
       cur = next;
       }
    // LPQ does not need to be checked because JNI thunk requests cannot be put in LPQ
@@ -2026,7 +2061,6 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
       } // end for
    // if compiling on app thread, there is no compilation queue
    TR_MethodToBeCompiled *cur  = _methodQueue;
-   TR_MethodToBeCompiled *prev = NULL;
    bool verboseDetails = TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseHookDetails);
    while (cur)
       {
@@ -2067,24 +2101,13 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
                   }
                }
             // detach from queue
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
+            dequeueEntry(cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
             // put back into the pool
             recycleCompilationEntry(cur);
             }
-         else
-            {
-            prev = cur;
-            }
-         }
-      else
-         {
-         prev = cur;
          }
       cur = next;
       }
@@ -2385,7 +2408,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
    while (_methodQueue)
       {
       TR_MethodToBeCompiled * cur = _methodQueue;
-      _methodQueue = cur->_next;
+      dequeueEntry(cur);
       updateCompQueueAccountingOnDequeue(cur);
       // decrease the queue weight
       decreaseQueueWeightBy(cur->_weight);
@@ -2640,6 +2663,92 @@ void TR::CompilationInfo::resumeCompilationThread()
       }
    }
 
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+int32_t TR::CompilationInfo::suspendCompilationThreadsForCheckpoint(J9VMThread *vmThread)
+   {
+   if (!useSeparateCompilationThread())
+      return 0;
+
+   // The checkpoint is taken with exclusive VM access, so a thread in the middle of a compilation
+   // may be blocked until after the checkpoint; do not wait for such threads indefinitely
+   static const int32_t MAX_WAIT_MILLIS = 500;
+   static const int32_t WAIT_STEP_MILLIS = 5;
+
+   // Suspend only the threads that are active and remember them, so that a failed checkpoint
+   // or the restore does not resume threads that were suspended for other reasons
+   acquireCompMonitor(vmThread);
+   bool stoppedOneCompilationThread = false;
+   for (int32_t i = 0; i < getNumUsableCompilationThreads(); i++)
+      {
+      TR::CompilationInfoPerThread *curCompThreadInfoPT = _arrayOfCompilationInfoPerThread[i];
+      if (curCompThreadInfoPT->compilationThreadIsActive())
+         {
+         curCompThreadInfoPT->setCompilationThreadState(COMPTHREAD_SIGNAL_SUSPEND);
+         curCompThreadInfoPT->setSuspendedForCheckpoint(true);
+         decNumCompThreadsActive();
+         stoppedOneCompilationThread = true;
+         }
+      }
+   // The queued requests are dropped; they will be issued again when the methods are invoked
+   if (stoppedOneCompilationThread)
+      purgeMethodQueue(compilationSuspended);
+   // Threads that wait for work with a timeout only notice the suspension when they wake up
+   getCompilationMonitor()->notifyAll();
+   releaseCompMonitor(vmThread);
+
+   int32_t numNotParked = 0;
+   for (int32_t waitedMillis = 0; ; waitedMillis += WAIT_STEP_MILLIS)
+      {
+      numNotParked = 0;
+      for (int32_t i = 0; i < getNumUsableCompilationThreads(); i++)
+         {
+         CompilationThreadState state = _arrayOfCompilationInfoPerThread[i]->getCompilationThreadState();
+         if (state == COMPTHREAD_SIGNAL_SUSPEND || state == COMPTHREAD_ACTIVE)
+            numNotParked++;
+         }
+      if (numNotParked == 0 || waitedMillis >= MAX_WAIT_MILLIS)
+         break;
+      j9thread_sleep(WAIT_STEP_MILLIS);
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "t=%6u Checkpoint: suspended compilation threads, %d of %d did not park",
+         (uint32_t)getPersistentInfo()->getElapsedTime(), numNotParked, getNumUsableCompilationThreads());
+      }
+   return numNotParked;
+   }
+
+void TR::CompilationInfo::resumeCompilationThreadsSuspendedForCheckpoint(J9VMThread *vmThread)
+   {
+   if (!useSeparateCompilationThread())
+      return;
+
+   acquireCompMonitor(vmThread);
+   int32_t numResumed = 0;
+   for (int32_t i = 0; i < getNumUsableCompilationThreads(); i++)
+      {
+      TR::CompilationInfoPerThread *curCompThreadInfoPT = _arrayOfCompilationInfoPerThread[i];
+      if (!curCompThreadInfoPT->isSuspendedForCheckpoint())
+         continue;
+      curCompThreadInfoPT->setSuspendedForCheckpoint(false);
+      // With dynamic thread activation the remaining threads stay suspended until the
+      // activation heuristics want them, like any other suspended compilation thread
+      if (numResumed > 0 && shouldActivateNewCompThread() == TR_no)
+         continue;
+      curCompThreadInfoPT->resumeCompilationThread();
+      numResumed++;
+      }
+   releaseCompMonitor(vmThread);
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "t=%6u Checkpoint: resumed %d compilation threads",
+         (uint32_t)getPersistentInfo()->getElapsedTime(), numResumed);
+      }
+   }
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
+
 
 int TR::CompilationInfo::computeCompilationThreadPriority(J9JavaVM *vm)
    {
@@ -3406,6 +3515,16 @@ void TR::CompilationInfo::stopCompilationThreads()
       fprintf(stderr, "NumQueuePromotions=%u\n", _statNumQueuePromotions);
       }
 
+   if (printCompStats)
+      {
+      fprintf(stderr, "Compilation queue: peakSize=%d numInsertions=%u numInsertionScanSteps=%llu\n",
+              getPeakMethodQueueSize(), _statNumQueueInsertions, (unsigned long long)_statNumQueueInsertionScanSteps);
+      fprintf(stderr, "Compilation queue monitor: numHolds=%u totalHoldTime=%llu usec avgHoldTime=%llu usec maxHoldTime=%llu usec\n",
+              _statNumCompMonitorHolds, (unsigned long long)_statCompMonitorHoldTime,
+              (unsigned long long)(_statNumCompMonitorHolds ? _statCompMonitorHoldTime / _statNumCompMonitorHolds : 0),
+              (unsigned long long)_statMaxCompMonitorHoldTime);
+      }
+
 #if defined(J9VM_OPT_JITSERVER)
    static char *printJITServerIPMsgStats = feGetEnv("TR_PrintJITServerIPMsgStats");
    if (printJITServerIPMsgStats)
@@ -3546,23 +3665,30 @@ void TR::CompilationInfo::stopCompilationThreads()
       j9jit_fclose(TR::CompilationInfoPerThreadBase::getPerfFile());
       TR::CompilationInfoPerThreadBase::setPerfFile(NULL); // prevent closing twice
       }
+   TR_PerfJitDump::shutdown();
 #endif
 
    releaseCompMonitor(vmThread);
 #if defined(J9VM_OPT_JITSERVER)
    if (getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT)
       {
-      try
-         {
-         JITServer::ClientStream client(getPersistentInfo());
-         client.writeError(JITServer::MessageType::clientSessionTerminate, getPersistentInfo()->getClientUID());
-         }
-      catch (const JITServer::StreamFailure &e)
+      // Every server we compiled with may hold a session for this client
+      for (uint32_t serverEndpoint = 0; serverEndpoint < getPersistentInfo()->getNumJITServerEndpoints(); ++serverEndpoint)
          {
-         JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(_jitConfig->javaVM->portLibrary), this);
-         // catch the stream failure exception if the server dies before the dummy message is send for termination.
-         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "JITServer StreamFailure (server unreachable before the termination message was sent): %s", e.what());
+         if (serverEndpoint != JITServerHelpers::getActiveServerEndpoint() && !JITServerHelpers::wasServerEndpointUsed(serverEndpoint))
+            continue;
+         try
+            {
+            JITServer::ClientStream client(getPersistentInfo(), serverEndpoint);
+            client.writeError(JITServer::MessageType::clientSessionTerminate, getPersistentInfo()->getClientUID());
+            }
+         catch (const JITServer::StreamFailure &e)
+            {
+            JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(_jitConfig->javaVM->portLibrary), this, serverEndpoint);
+            // catch the stream failure exception if the server dies before the dummy message is send for termination.
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "JITServer StreamFailure (server unreachable before the termination message was sent): %s", e.what());
+            }
          }
       }
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -4661,9 +4787,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
 #endif
 
    // Add this method to the queue of methods waiting to be compiled.
-   TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
-   uint32_t queueWeight = 0; // QW
-   int32_t numEntries = 0;
+   TR_MethodToBeCompiled *cur = NULL;
 
    // See if the method is already in the queue or is already being compiled
    //
@@ -4679,7 +4803,6 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       TR_MethodToBeCompiled *compMethod = curCompThreadInfoPT->getMethodBeingCompiled();
       if (compMethod)
          {
-         queueWeight += compMethod->_weight; // QW
          if (compMethod->getMethodDetails().sameAs(details, fe))
             {
             if (!compMethod->_unloadedMethod) // Redefinition; see cmvc 192606 and RTC 36898
@@ -4694,13 +4817,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          }
       }
 
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      numEntries++;
-      queueWeight += cur->_weight;
-      if (cur->getMethodDetails().sameAs(details, fe))
-         break;
-      }
+   cur = findQueuedEntry(details, fe);
 
    // NOTE: we do not need to search the methodPool since we cannot reach here if an entry
    // for the compilation of this method is already in the pool.  Things are put in the pool
@@ -4719,10 +4836,15 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       if (pc)
          cur->_oldStartPC = pc;
 
-      // If the priority has increased, use the new priority
+      // If the priority has increased, use the new priority.
+      // The entry must be out of the queue while its priority changes; it is re-inserted below
       //
-      if (cur->_priority < priority)
+      bool priorityIncreased = cur->_priority < priority;
+      if (priorityIncreased)
+         {
+         dequeueEntry(cur);
          cur->_priority = priority;
+         }
       // If the optimization level is higher, just upgrade
       // (unless the methods has excessive complexity)
       //
@@ -4739,32 +4861,14 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          }
       // If the position in the queue is still correct, just return
       //
-      if (!prev || prev->_priority >= cur->_priority)
+      if (!priorityIncreased)
          return cur;
-
-      // Must re-position in the queue
-      //
-      prev->_next = cur->_next; // take it out of the queue
       }
 
    // If method is not yet in the queue prepare the queue entry
    //
    else
       {
-      if (queueWeight != _queueWeight) //QW
-         {
-         if (TR::Options::isAnyVerboseOptionSet())
-            TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "Discrepancy for queue weight while adding to queue: computed=%u recorded=%u\n", queueWeight, _queueWeight);
-         // correction
-         _queueWeight = queueWeight;
-         }
-      if (numEntries != _numQueuedMethods)
-         {
-         if (TR::Options::isAnyVerboseOptionSet())
-            TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "Discrepancy for queue size while adding to queue: Before adding numEntries=%d  _numQueuedMethods=%d\n", numEntries, _numQueuedMethods);
-         TR_ASSERT(false, "Discrepancy for queue size while adding to queue");
-         }
-
       cur = getCompilationQueueEntry();
       if (cur == NULL)  // Memory Allocation Failure.
          return NULL;
@@ -4944,31 +5048,160 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
 
 //--------------------------- queueEntry ---------------------------------
 // Insert the compilation request in the queue at the appropriate place
-// based on its priority. Must have compilationQueueMonitor in hanb
+// based on its priority (after all the entries with the same or higher priority)
+// and add it to the J9Method index. Must have compilationQueueMonitor in hand
 //------------------------------------------------------------------------
 void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
    {
    TR_ASSERT_FATAL(entry->_freeTag & ENTRY_INITIALIZED, "queuing an entry which is not initialized\n");
 
    entry->_freeTag |= ENTRY_QUEUED;
+   _statNumQueueInsertions++;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
+   // Find the entry after which the new entry must be inserted
+   TR_MethodToBeCompiled *prev = NULL;
+   if (_numQueuePrioritySegments >= 0)
       {
-      entry->_next = _methodQueue;
-      _methodQueue = entry;
+      int32_t seg = 0;
+      for (; seg < _numQueuePrioritySegments && _queuePrioritySegments[seg]._priority >= entry->_priority; seg++)
+         prev = _queuePrioritySegments[seg]._last;
+
+      if (seg > 0 && _queuePrioritySegments[seg - 1]._priority == entry->_priority)
+         {
+         _queuePrioritySegments[seg - 1]._last = entry;
+         }
+      else if (_numQueuePrioritySegments < MAX_QUEUE_PRIORITY_SEGMENTS)
+         {
+         memmove(&_queuePrioritySegments[seg + 1], &_queuePrioritySegments[seg], (_numQueuePrioritySegments - seg) * sizeof(QueuePrioritySegment));
+         _queuePrioritySegments[seg]._priority = entry->_priority;
+         _queuePrioritySegments[seg]._last = entry;
+         _numQueuePrioritySegments++;
+         }
+      else
+         {
+         // Too many distinct priorities; scan the queue until it becomes empty
+         _numQueuePrioritySegments = -1;
+         }
       }
    else
       {
-      for (TR_MethodToBeCompiled *prev = _methodQueue; ; prev = prev->_next)
+      for (TR_MethodToBeCompiled *cur = _methodQueue; cur && cur->_priority >= entry->_priority; cur = cur->_next)
          {
-         if (!prev->_next || prev->_next->_priority < entry->_priority)
+         prev = cur;
+         _statNumQueueInsertionScanSteps++;
+         }
+      }
+
+   entry->_prev = prev;
+   entry->_next = prev ? prev->_next : _methodQueue;
+   if (entry->_next)
+      entry->_next->_prev = entry;
+   if (prev)
+      prev->_next = entry;
+   else
+      _methodQueue = entry;
+
+   // Requests without a J9Method (e.g. out-of-process compilations at the server) are not indexed.
+   // The method is remembered because the details of a queued entry can still be changed
+   // (e.g. by a JitDump recompilation at the server).
+   J9Method *method = entry->getMethodDetails().getMethod();
+   entry->_indexedMethod = method;
+   if (method)
+      {
+      uint32_t bucket = methodQueueIndexBucket(method);
+      entry->_nextInIndex = _methodQueueIndex[bucket];
+      _methodQueueIndex[bucket] = entry;
+      }
+   }
+
+//--------------------------- dequeueEntry -------------------------------
+// Take the given entry out of the queue and out of the J9Method index.
+// The accounting for the queue size and weight is left to the caller.
+// Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::dequeueEntry(TR_MethodToBeCompiled *entry)
+   {
+   TR_ASSERT(entry->_prev || _methodQueue == entry, "entry %p is not in the compilation queue", entry);
+
+   if (_numQueuePrioritySegments > 0)
+      {
+      int32_t seg = 0;
+      while (seg < _numQueuePrioritySegments && _queuePrioritySegments[seg]._priority != entry->_priority)
+         seg++;
+      TR_ASSERT(seg < _numQueuePrioritySegments, "priority %x of queued entry %p has no segment", entry->_priority, entry);
+      if (seg < _numQueuePrioritySegments && _queuePrioritySegments[seg]._last == entry)
+         {
+         if (entry->_prev && entry->_prev->_priority == entry->_priority)
             {
-            entry->_next = prev->_next;
-            prev->_next = entry;
-            break;
+            _queuePrioritySegments[seg]._last = entry->_prev;
+            }
+         else // this was the only entry with this priority
+            {
+            _numQueuePrioritySegments--;
+            memmove(&_queuePrioritySegments[seg], &_queuePrioritySegments[seg + 1], (_numQueuePrioritySegments - seg) * sizeof(QueuePrioritySegment));
             }
          }
       }
+
+   if (entry->_prev)
+      entry->_prev->_next = entry->_next;
+   else
+      _methodQueue = entry->_next;
+   if (entry->_next)
+      entry->_next->_prev = entry->_prev;
+   entry->_next = NULL;
+   entry->_prev = NULL;
+
+   if (!_methodQueue)
+      _numQueuePrioritySegments = 0; // segments can be used again
+
+   J9Method *method = entry->_indexedMethod;
+   if (method)
+      {
+      TR_MethodToBeCompiled **link = &_methodQueueIndex[methodQueueIndexBucket(method)];
+      while (*link && *link != entry)
+         link = &(*link)->_nextInIndex;
+      TR_ASSERT(*link, "entry %p is missing from the compilation queue index", entry);
+      if (*link)
+         *link = entry->_nextInIndex;
+      entry->_nextInIndex = NULL;
+      entry->_indexedMethod = NULL;
+      }
+   }
+
+//--------------------------- findQueuedEntry ----------------------------
+// Return the queued entry for the same compilation as the given details,
+// or NULL if there is none. Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+TR_MethodToBeCompiled *
+TR::CompilationInfo::findQueuedEntry(TR::IlGeneratorMethodDetails &details, TR_FrontEnd *fe)
+   {
+   if (!details.getMethod()) // such requests are not indexed
+      {
+      for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next)
+         if (cur->getMethodDetails().sameAs(details, fe))
+            return cur;
+      return NULL;
+      }
+   for (TR_MethodToBeCompiled *cur = _methodQueueIndex[methodQueueIndexBucket(details.getMethod())]; cur; cur = cur->_nextInIndex)
+      {
+      if (cur->getMethodDetails().sameAs(details, fe))
+         return cur;
+      }
+   return NULL;
+   }
+
+// Return the queued request for the given method that is not a DLT compilation, or NULL
+TR_MethodToBeCompiled *
+TR::CompilationInfo::findQueuedNonDLTEntry(J9Method *method)
+   {
+   TR_ASSERT(method, "requests without a J9Method are not indexed");
+   for (TR_MethodToBeCompiled *cur = _methodQueueIndex[methodQueueIndexBucket(method)]; cur; cur = cur->_nextInIndex)
+      {
+      if (!cur->isDLTCompile() && cur->getMethodDetails().getMethod() == method)
+         return cur;
+      }
+   return NULL;
    }
 
 //--------------------------------- requeue ----------------------------------
@@ -5012,12 +5245,7 @@ TR::CompilationInfo::adjustCompilationEntryAndRequeue(
       }
 
    // Search the queue for my method
-   TR_MethodToBeCompiled *cur, *prev;
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      if (cur->getMethodDetails().sameAs(details, fe))
-         break;
-      }
+   TR_MethodToBeCompiled *cur = findQueuedEntry(details, fe);
    if (cur)
       {
       // here define the list of exclusions
@@ -5037,10 +5265,7 @@ TR::CompilationInfo::adjustCompilationEntryAndRequeue(
          if (cur->_priority < priority)
             {
             // take the method out
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
+            dequeueEntry(cur);
             // put it back at its proper place
             cur->_priority = priority;
             queueEntry(cur);
@@ -5069,50 +5294,35 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method * method, void *
          }
       }
 
+   TR_MethodToBeCompiled *cur = findQueuedNonDLTEntry(method);
+   if (!cur)
+      return -getMethodQueueSize();
+
+   // The position in the queue is only used for diagnostics; walk back to find it
    int i = 0;
-   TR_MethodToBeCompiled *cur, *prev;
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-         break;
+   for (TR_MethodToBeCompiled *p = cur->_prev; p; p = p->_prev)
       i++;
-      }
 
-   if (!cur || !prev || cur->_priority >= CP_ASYNC_MAX || prev->_priority >= CP_ASYNC_MAX)
+   TR_MethodToBeCompiled *prev = cur->_prev;
+   if (!prev || cur->_priority >= CP_ASYNC_MAX || prev->_priority >= CP_ASYNC_MAX)
       return -i;
    changeCompThreadPriority(J9THREAD_PRIORITY_MAX, 9);
    _statNumQueuePromotions++;
 #ifdef STATS
    fprintf(stderr, "Promoting method in queue QSZ=%d\n", getMethodQueueSize());
 #endif
+   // take the method out and put it back after the entries with CP_ASYNC_MAX or higher priority
+   // FIXME: how about the compilation lag
+   dequeueEntry(cur);
    cur->_priority = CP_ASYNC_MAX;
-
-   // take the method out
-   prev->_next = cur->_next;
-   // find insertion point
-   if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-      {
-      cur->_next = _methodQueue;
-      _methodQueue = cur;
-      // FIXME: how about the compilation lag
-      }
-   else
-      {
-      for (prev = _methodQueue; prev->_next; prev = prev->_next)
-         if (prev->_next->_priority < CP_ASYNC_MAX)
-            {
-            cur->_next = prev->_next;
-            prev->_next = cur;
-            break;
-            }
-      }
+   queueEntry(cur);
    return i;
    }
 
 void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
    {
 
-   TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
+   TR_MethodToBeCompiled *cur = NULL;
    // See if the method is already in the queue or is already being compiled
    //
    for (int32_t i = 0; i < getNumUsableCompilationThreads(); i++)
@@ -5134,25 +5344,16 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
       }
    if (!cur)
       {
-      for (cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-         if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-            break;
+      cur = findQueuedNonDLTEntry(method);
       // Check if this is an asynchronous request
       //
       if (cur && cur->_priority <= CP_ASYNC_MAX)
          {
          // Take the method out, increase its priority and insert it at the proper place
          //
+         dequeueEntry(cur);
          cur->_priority = CP_SYNC_NORMAL;
-         if (prev)
-            {
-            prev->_next = cur->_next;
-            queueEntry(cur);
-            }
-         else // method already at the top of the queue
-            {
-            // Nothing to do
-            }
+         queueEntry(cur);
          }
       else
          {
@@ -5190,10 +5391,7 @@ TR_MethodToBeCompiled * TR::CompilationInfo::requestExistsInCompilationQueue(TR:
          return curCompThreadInfoPT->getMethodBeingCompiled();
       }
 
-   for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next)
-      if (cur->getMethodDetails().sameAs(details, fe))
-         return cur;
-   return NULL;
+   return findQueuedEntry(details, fe);
    }
 
 TR_MethodToBeCompiled *TR::CompilationInfo::peekNextMethodToBeCompiled()
@@ -5244,7 +5442,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       if (_methodQueue)
          {
          nextMethodToBeCompiled = _methodQueue;
-         _methodQueue = _methodQueue->_next;
+         dequeueEntry(nextMethodToBeCompiled);
 
          // See explanation at the start of this function of why it is important to ensure this
          TR_ASSERT_FATAL(nextMethodToBeCompiled->getMethodDetails().isJitDumpMethod(), "Diagnostic thread attempting to process non-JitDump compilation");
@@ -5260,16 +5458,25 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       // entries. We prevent it from processing JitDump compilation requests here.
       if (_methodQueue != NULL && !_methodQueue->getMethodDetails().isJitDumpMethod())
          {
-         // If the request is sync or AOT load, take it now
-         if (_methodQueue->_priority >= CP_SYNC_MIN // sync comp
-            || _methodQueue->_methodIsInSharedCache == TR_yes // very cheap relocation
    #if defined(J9VM_OPT_JITSERVER)
-            || getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER // compile right away in server mode
+         // In server mode compile right away, but share the compilation threads fairly among clients
+         if (getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER)
+            {
+            ClientFairShare *fairShare = NULL;
+            nextMethodToBeCompiled = getNextOutOfProcessEntry(&fairShare);
+            // The thread is charged to the client now, so that other threads see the limit reached
+            static_cast<TR::CompilationInfoPerThreadRemote *>(compInfoPT)->setClientFairShare(fairShare);
+            if (!nextMethodToBeCompiled) // All queued requests belong to clients that use their share of threads
+               *compThreadAction = GO_TO_SLEEP_CONCURRENT_EXPENSIVE_REQUESTS;
+            }
+         else
    #endif
-            )
+         // If the request is sync or AOT load, take it now
+         if (_methodQueue->_priority >= CP_SYNC_MIN // sync comp
+            || _methodQueue->_methodIsInSharedCache == TR_yes) // very cheap relocation
             {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            dequeueEntry(nextMethodToBeCompiled);
             }
          // Check if we need to throttle
          else if (exceedsCompCpuEntitlement() == TR_yes &&
@@ -5288,18 +5495,17 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
                   _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
             {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            dequeueEntry(nextMethodToBeCompiled);
             }
          else // scan for a cold/warm method
             {
-            TR_MethodToBeCompiled *prev = _methodQueue;
-            for (nextMethodToBeCompiled = _methodQueue->_next; nextMethodToBeCompiled; prev = nextMethodToBeCompiled, nextMethodToBeCompiled = nextMethodToBeCompiled->_next)
+            for (nextMethodToBeCompiled = _methodQueue->_next; nextMethodToBeCompiled; nextMethodToBeCompiled = nextMethodToBeCompiled->_next)
                {
                if (nextMethodToBeCompiled->_optimizationPlan->getOptLevel() <= warm || // cheaper comp
                   nextMethodToBeCompiled->_priority >= CP_SYNC_MIN ||       // sync comp
                   nextMethodToBeCompiled->_methodIsInSharedCache == TR_yes) // very cheap relocation
                   {
-                  prev->_next = nextMethodToBeCompiled->_next;
+                  dequeueEntry(nextMethodToBeCompiled);
                   break;
                   }
                }
@@ -6210,20 +6416,12 @@ void *TR::CompilationInfo::compileOnSeparateThread(J9VMThread * vmThread, TR::Il
          changeCompReqFromAsyncToSync(method);
       else
          {
-         TR_MethodToBeCompiled *reqMe, *prevReq;
-         for (prevReq=NULL, reqMe=_methodQueue; reqMe; prevReq = reqMe, reqMe = reqMe->_next)
-            {
-            if (!reqMe->isDLTCompile() && reqMe->getMethodDetails().getMethod() == method)
-               break;
-            }
+         TR_MethodToBeCompiled *reqMe = findQueuedNonDLTEntry(method);
          if (reqMe && reqMe->_priority<CP_ASYNC_ABOVE_NORMAL)
             {
+            dequeueEntry(reqMe);
             reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
-            if (prevReq && prevReq->_priority<CP_ASYNC_ABOVE_NORMAL)
-               {
-               prevReq->_next = reqMe->_next;
-               queueEntry(reqMe);
-               }
+            queueEntry(reqMe);
             }
          }
       }
@@ -7826,6 +8024,18 @@ TR::CompilationInfoPerThreadBase::postCompilationTasks(J9VMThread * vmThread,
       generatePerfToolEntry();
       }
 
+   if (TR::Options::getGeneratePerfJitDump() && getMetadata() &&
+       startPC != 0 && startPC != entry->_oldStartPC
+#if defined(J9VM_OPT_JITSERVER)
+       && _compInfo.getPersistentInfo()->getRemoteCompilationMode() != JITServer::SERVER
+#endif /* defined(J9VM_OPT_JITSERVER) */
+      )
+      {
+      // At this point we have the compilationQueueMonitor, so only one thread can initialize the writer
+      TR_PerfJitDump::initialize();
+      TR_PerfJitDump::codeLoad(vmThread, getMetadata(), entry->_oldStartPC);
+      }
+
    if (_compiler)
       {
       // Unreserve the code cache used for this compilation
@@ -8855,6 +9065,16 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
                proposedScratchMemoryLimit *= TR::Options::getScratchSpaceFactorWhenJITServerWorkload();
                // However, this new limit must not be larger than the half the free physical memory
 
+               // Split the scratch memory a client may use among the threads working for it,
+               // so that one client with many concurrent compilations cannot exhaust the server
+               uint64_t perClientLimit = (uint64_t)TR::Options::getPerClientScratchSpaceLimitKB() * 1024;
+               TR::CompilationInfo::ClientFairShare *fairShare = static_cast<TR::CompilationInfoPerThreadRemote *>(that)->getClientFairShare();
+               if (perClientLimit > 0 && fairShare)
+                  {
+                  uintptr_t numCompThreads = fairShare->_numCompThreads > 0 ? fairShare->_numCompThreads : 1;
+                  if (proposedScratchMemoryLimit > perClientLimit / numCompThreads)
+                     proposedScratchMemoryLimit = perClientLimit / numCompThreads;
+                  }
                }
 #endif
 
@@ -12706,6 +12926,87 @@ TR::CompilationInfo::addOutOfProcessMethodToBeCompiled(JITServer::ServerStream *
    return entry;
    }
 
+// Select the next request to be processed by the JITServer with start-time fair queuing:
+// take the request of the client that has received the least compilation time so far.
+// Requests arriving on connections that have not carried a request yet have an unknown
+// client and are taken first. A client is skipped when the number of threads working
+// for it reached the limit given by -Xjit:perClientCompThreadLimit. A requeued connection
+// knows its client, so the thread taking it is charged to that client here, in the same
+// critical section as the limit check; the share is returned in chargedShare. Threads taking
+// a connection of an unknown client are charged once the request has been read (see processEntry).
+// Must be executed with compilation monitor in hand.
+TR_MethodToBeCompiled *
+TR::CompilationInfo::getNextOutOfProcessEntry(ClientFairShare **chargedShare)
+   {
+   *chargedShare = NULL;
+   TR_MethodToBeCompiled *bestEntry = NULL;
+   uint64_t bestVirtualTime = 0;
+   for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next)
+      {
+      uint64_t clientUID = cur->_stream ? cur->_stream->getClientId() : 0;
+      if (!clientUID)
+         {
+         bestEntry = cur;
+         break;
+         }
+      auto it = _clientFairShares.find(clientUID);
+      ClientFairShare *share = (it != _clientFairShares.end()) ? &it->second : NULL;
+      // Parked threads do not count against the limit; they wait for a request of the same client that may still be queued
+      if (share && share->_numCompThreads - share->_numParkedThreads >= (uintptr_t)TR::Options::getPerClientCompThreadLimit())
+         continue;
+      // A client that was idle does not get credit for the time it did not use
+      uint64_t virtualTime = (share && share->_virtualTime > _fairShareVirtualTime) ? share->_virtualTime : _fairShareVirtualTime;
+      if (!bestEntry || virtualTime < bestVirtualTime)
+         {
+         bestEntry = cur;
+         bestVirtualTime = virtualTime;
+         }
+      }
+
+   if (bestEntry)
+      {
+      dequeueEntry(bestEntry);
+      if (bestEntry->_stream && bestEntry->_stream->getClientId())
+         {
+         _fairShareVirtualTime = bestVirtualTime;
+         *chargedShare = acquireClientFairShare(bestEntry->_stream->getClientId());
+         }
+      }
+   return bestEntry;
+   }
+
+TR::CompilationInfo::ClientFairShare *
+TR::CompilationInfo::acquireClientFairShare(uint64_t clientUID)
+   {
+   auto it = _clientFairShares.find(clientUID);
+   if (it == _clientFairShares.end())
+      {
+      // A client with no thread working for it and no credit left is the same as an unknown client,
+      // so forget such clients when a new one shows up to keep the map from growing with departed clients
+      for (auto cur = _clientFairShares.begin(); cur != _clientFairShares.end();)
+         {
+         if (cur->second._numCompThreads == 0 && cur->second._virtualTime <= _fairShareVirtualTime)
+            cur = _clientFairShares.erase(cur);
+         else
+            ++cur;
+         }
+      ClientFairShare newShare = { _fairShareVirtualTime, 0, 0 };
+      it = _clientFairShares.insert({ clientUID, newShare }).first;
+      }
+   ClientFairShare *share = &it->second;
+   if (share->_virtualTime < _fairShareVirtualTime)
+      share->_virtualTime = _fairShareVirtualTime;
+   VM_AtomicSupport::add(&share->_numCompThreads, 1);
+   return share;
+   }
+
+void
+TR::CompilationInfo::releaseClientFairShare(ClientFairShare *share, uint64_t compTimeMs)
+   {
+   share->_virtualTime += compTimeMs;
+   VM_AtomicSupport::subtract(&share->_numCompThreads, 1);
+   }
+
 void
 TR::CompilationInfo::requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry)
    {
@@ -482,6 +482,10 @@ class CompilationInfoPerThread : public TR::CompilationInfoPerThreadBase
    bool                   isDiagnosticThread() const { return _isDiagnosticThread; }
    CpuSelfThreadUtilization& getCompThreadCPU() { return _compThreadCPU; }
    virtual void           freeAllResources();
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+   bool                   isSuspendedForCheckpoint() const { return _suspendedForCheckpoint; }
+   void                   setSuspendedForCheckpoint(bool b) { _suspendedForCheckpoint = b; }
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
 #if defined(J9VM_OPT_JITSERVER)
    TR_J9ServerVM            *getServerVM() const { return _serverVM; }
@@ -509,6 +513,9 @@ class CompilationInfoPerThread : public TR::CompilationInfoPerThreadBase
    bool                   _initializationSucceeded;
    bool                   _isDiagnosticThread;
    CpuSelfThreadUtilization _compThreadCPU;
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+   bool                   _suspendedForCheckpoint; // suspended by the checkpoint, not by a suspend request
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 #if defined(J9VM_OPT_JITSERVER)
    TR_J9ServerVM         *_serverVM;
    TR_J9SharedCacheServerVM *_sharedCacheServerVM;
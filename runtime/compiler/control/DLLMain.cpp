@@ -553,20 +553,23 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void * reserved)
             TR_IProfiler *iProfiler = fe->getIProfiler();
             if (iProfiler)
                {
-               J9VMThread *iProfilerThread = iProfiler->getIProfilerThread();
-               if (iProfilerThread)
+               for (uint32_t i = 0; i < iProfiler->getNumIProfilerThreads(); i++)
                   {
-                  vm->internalVMFunctions->initializeAttachedThread
-                      (curThread, "IProfiler", vm->systemThreadGroupRef,
-                      ((iProfilerThread->privateFlags & J9_PRIVATE_FLAGS_DAEMON_THREAD) != 0),
-                      iProfilerThread);
-                  if ((curThread->currentException != NULL) || (curThread->threadObject == NULL))
+                  J9VMThread *iProfilerThread = iProfiler->getIProfilerThread(i);
+                  if (iProfilerThread)
                      {
-                     if (!loadInfo->fatalErrorStr || strlen(loadInfo->fatalErrorStr)==0)
-                        loadInfo->fatalErrorStr = "cannot create the iProfiler Thread object";
-                     return J9VMDLLMAIN_FAILED;
+                     vm->internalVMFunctions->initializeAttachedThread
+                         (curThread, i == 0 ? "IProfiler" : "IProfiler Helper", vm->systemThreadGroupRef,
+                         ((iProfilerThread->privateFlags & J9_PRIVATE_FLAGS_DAEMON_THREAD) != 0),
+                         iProfilerThread);
+                     if ((curThread->currentException != NULL) || (curThread->threadObject == NULL))
+                        {
+                        if (!loadInfo->fatalErrorStr || strlen(loadInfo->fatalErrorStr)==0)
+                           loadInfo->fatalErrorStr = "cannot create the iProfiler Thread object";
+                        return J9VMDLLMAIN_FAILED;
+                        }
+                     TRIGGER_J9HOOK_VM_THREAD_STARTED(vm->hookInterface, curThread, iProfilerThread);
                      }
-                  TRIGGER_J9HOOK_VM_THREAD_STARTED(vm->hookInterface, curThread, iProfilerThread);
                   }
                }
 #endif
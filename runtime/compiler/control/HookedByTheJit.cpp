@@ -80,6 +80,7 @@
 #include "env/SystemSegmentProvider.hpp"
 #if defined(J9VM_OPT_JITSERVER)
 #include "control/JITServerHelpers.hpp"
+#include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerAOTDeserializer.hpp"
 #include "runtime/JITServerIProfiler.hpp"
 #include "runtime/JITServerStatisticsThread.hpp"
@@ -1378,8 +1379,109 @@ static void jitMethodSampleInterrupt(J9VMThread* vmThread, IDATA handlerKey, voi
    }
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+// Time (usec) spent by the JIT in the class unloading hooks since the end of the previous
+// class unloading cycle, reported at the end of the cycle with -Xjit:verbose={classUnloading}.
+// The hooks run on the thread doing the class unloading, while it has exclusive VM access.
+static struct
+   {
+   uint64_t _compQueues;         // purging compilation requests of unloaded methods
+   uint64_t _runtimeAssumptions; // patching the sites guarded by assumptions on unloaded classes
+   uint64_t _chTable;            // removing unloaded classes from the persistent CH table
+   uint64_t _metaData;           // releasing the metadata and code of unloaded methods
+   uint64_t _codeCache;          // purging the code cache hash tables and trampolines
+   uint64_t _profilers;          // invalidating interpreter and hardware profiling data
+   uint64_t _other;
+   } classUnloadingCost;
+
+// Set at the end of a class unloading cycle that left runtime assumptions marked for
+// reclamation. The sampler thread then reclaims them outside of the GC pause.
+static volatile bool classUnloadingCleanupPending = false;
+
+// Assumptions reclaimed by the sampler thread per acquisition of the assumption table mutex,
+// which bounds how long a GC that needs the table can be held up by the background cleanup
+#define DEFERRED_ASSUMPTION_RECLAMATION_CHUNK 1000
+
+/**
+ * @brief Determine whether the reclamation of marked runtime assumptions can be left to the sampler thread
+ *
+ * The sampler thread is not used when it does not run, is suspended or only wakes up rarely
+ * because the JVM is deeply idle; the marked assumptions are then reclaimed at the start of
+ * the next global GC, as they would be without deferred cleanup.
+ */
+static bool canDeferClassUnloadingCleanup(TR::CompilationInfo *compInfo)
+   {
+   if (compInfo->getSamplingThreadLifetimeState() != TR::CompilationInfo::SAMPLE_THR_INITIALIZED)
+      return false;
+   TR::CompilationInfo::TR_SamplerStates samplerState = compInfo->getSamplerState();
+   return samplerState == TR::CompilationInfo::SAMPLER_DEFAULT || samplerState == TR::CompilationInfo::SAMPLER_IDLE;
+   }
+
+/**
+ * @brief Reclaim the runtime assumptions left marked by class unloading; called periodically by the sampler thread
+ *
+ * The sampler thread does not hold VM access, so this does not delay GCs except when one
+ * needs the assumption table while a chunk is being reclaimed.
+ */
+static void jitDeferredClassUnloadingCleanup(TR::CompilationInfo *compInfo)
+   {
+   if (!classUnloadingCleanupPending)
+      return;
+   classUnloadingCleanupPending = false;
+
+   PORT_ACCESS_FROM_JAVAVM(compInfo->getJITConfig()->javaVM);
+   TR_RuntimeAssumptionTable *rat = compInfo->getPersistentInfo()->getRuntimeAssumptionTable();
+   uint64_t startTime = j9time_usec_clock();
+   uint32_t markedBefore = rat->getMarkedAssumptionCount();
+   uint32_t numChunks = 0;
+   for (uint32_t marked = markedBefore; marked > 0; )
+      {
+      rat->reclaimMarkedAssumptionsFromRAT(DEFERRED_ASSUMPTION_RECLAMATION_CHUNK);
+      numChunks++;
+      uint32_t stillMarked = rat->getMarkedAssumptionCount();
+      if (stillMarked >= marked) // no progress; leave the rest to the next global GC
+         break;
+      marked = stillMarked;
+      }
+   uint32_t markedAfter = rat->getMarkedAssumptionCount();
+
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseClassUnloading))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_GC, "t=%6u Deferred class unloading cleanup: reclaimed %u runtime assumptions in %u chunks, %" OMR_PRIu64 " us",
+         (uint32_t)compInfo->getPersistentInfo()->getElapsedTime(),
+         markedBefore > markedAfter ? markedBefore - markedAfter : 0,
+         numChunks,
+         j9time_usec_clock() - startTime);
+   }
+
 static void jitHookClassesUnloadEnd(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
    {
+   MM_ClassUnloadingEndEvent *event = (MM_ClassUnloadingEndEvent *)eventData;
+   J9JITConfig *jitConfig = event->currentThread->javaVM->jitConfig;
+   if (!jitConfig)
+      return; // if a hook gets called after freeJitConfig then not much else we can do
+
+   TR::CompilationInfo *compInfo = TR::CompilationInfo::get(jitConfig);
+   uint32_t markedAssumptions = compInfo->getPersistentInfo()->getRuntimeAssumptionTable()->getMarkedAssumptionCount();
+   bool deferCleanup = markedAssumptions > 0 && canDeferClassUnloadingCleanup(compInfo);
+   if (deferCleanup)
+      classUnloadingCleanupPending = true;
+
+   if ((event->classesCount > 0 || event->classLoaderCount > 0) &&
+       TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseClassUnloading))
+      {
+      uint64_t totalCost = classUnloadingCost._compQueues + classUnloadingCost._runtimeAssumptions + classUnloadingCost._chTable +
+                           classUnloadingCost._metaData + classUnloadingCost._codeCache + classUnloadingCost._profilers + classUnloadingCost._other;
+      TR_VerboseLog::vlogAcquire();
+      TR_VerboseLog::writeLine(TR_Vlog_GC, "t=%6u Class unloading: %u classes, %u class loaders: JIT cleanup in GC pause %" OMR_PRIu64 " us",
+         (uint32_t)compInfo->getPersistentInfo()->getElapsedTime(), (uint32_t)event->classesCount, (uint32_t)event->classLoaderCount, totalCost);
+      TR_VerboseLog::writeLine(TR_Vlog_GC, "   compQueues=%" OMR_PRIu64 " assumptions=%" OMR_PRIu64 " CHTable=%" OMR_PRIu64 " metaData=%" OMR_PRIu64 " codeCache=%" OMR_PRIu64 " profilers=%" OMR_PRIu64 " other=%" OMR_PRIu64 " us",
+         classUnloadingCost._compQueues, classUnloadingCost._runtimeAssumptions, classUnloadingCost._chTable,
+         classUnloadingCost._metaData, classUnloadingCost._codeCache, classUnloadingCost._profilers, classUnloadingCost._other);
+      TR_VerboseLog::writeLine(TR_Vlog_GC, "   %u runtime assumptions marked for reclamation %s", markedAssumptions,
+         deferCleanup ? "by the sampler thread" : "at the next global GC");
+      TR_VerboseLog::vlogRelease();
+      }
+
+   memset(&classUnloadingCost, 0, sizeof(classUnloadingCost));
    }
 #endif
 
@@ -1470,6 +1572,19 @@ void initJitPrivateThreadData(J9VMThread * currentThread)
    while (thread &&(thread != currentThread));
 }
 
+/**
+ * @brief Reclaim some of the runtime assumptions marked for reclamation, unless the sampler
+ * thread is about to reclaim those left by class unloading outside of the GC pause
+ */
+static void reclaimMarkedAssumptionsAtGCStart(J9JITConfig *jitConfig)
+   {
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+   if (jitConfig && classUnloadingCleanupPending && canDeferClassUnloadingCleanup(TR::CompilationInfo::get(jitConfig)))
+      return;
+#endif
+   jitReclaimMarkedAssumptions(false);
+   }
+
 static void jitHookGlobalGCStart(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
    {
    J9VMThread* vmThread = (J9VMThread*)((MM_GlobalGCStartEvent *)eventData)->currentThread->_language_vmthread;
@@ -1480,7 +1595,7 @@ static void jitHookGlobalGCStart(J9HookInterface * * hookInterface, UDATA eventN
 
    if (jitConfig && jitConfig->runtimeFlags & J9JIT_GC_NOTIFY)
       printf("\n{GGC");
-   jitReclaimMarkedAssumptions(false);
+   reclaimMarkedAssumptionsAtGCStart(jitConfig);
    }
 
 static void jitHookLocalGCStart(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
@@ -1503,7 +1618,7 @@ static void jitHookLocalGCStart(J9HookInterface * * hookInterface, UDATA eventNu
       printf("\n<jit: enabling stack tracing at gc %" OMR_PRIuPTR ">", jitConfig->gcCount);
       TR::Options::getCmdLineOptions()->setVerboseOption(TR_VerboseGc);
       }
-   jitReclaimMarkedAssumptions(false);
+   reclaimMarkedAssumptionsAtGCStart(jitConfig);
    }
 
 static void jitHookGlobalGCEnd(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
@@ -1806,6 +1921,15 @@ static void jitHookThreadDestroy(J9HookInterface * * hookInterface, UDATA eventN
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 static void jitHookPrepareCheckpoint(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
    {
+   J9CheckpointEvent * checkpointEvent = (J9CheckpointEvent *)eventData;
+   J9VMThread * vmThread = checkpointEvent->currentThread;
+   TR::CompilationInfo * compInfo = TR::CompilationInfo::get(vmThread->javaVM->jitConfig);
+
+   /* Park the compilation threads so that their scratch memory is released
+    * before the image is written; they are resumed on restore, or right
+    * away if the checkpoint fails
+    */
+   compInfo->suspendCompilationThreadsForCheckpoint(vmThread);
    }
 
 static void jitHookPrepareRestore(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
@@ -1823,6 +1947,41 @@ static void jitHookPrepareRestore(J9HookInterface * * hookInterface, UDATA event
       TR::Compiler->target.cpu = TR::CPU::detect(TR::Compiler->omrPortLib);
       jitConfig->targetProcessor = TR::Compiler->target.cpu.getProcessorDescription();
       }
+
+   // The restored process can run on a machine with a very different number of CPUs
+   // and amount of memory. Refresh both before resuming the compilation threads, so that
+   // threads are activated (up to numTargetCPUs-1) and throttled for the new machine
+   // rather than for the machine the checkpoint was taken on.
+   TR::CompilationInfo *compInfo = TR::CompilationInfo::get(javaVM->jitConfig);
+   compInfo->computeAndCacheCpuEntitlement();
+   uint32_t numProc = compInfo->getNumTargetCPUs();
+   TR::Compiler->host.setNumberOfProcessors(numProc);
+   TR::Compiler->target.setNumberOfProcessors(numProc);
+   TR::Compiler->relocatableTarget.setNumberOfProcessors(numProc);
+
+   bool incompleteInfo = false;
+   uint64_t phMemAvail = compInfo->computeAndCacheFreePhysicalMemory(incompleteInfo, 0);
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::vlogAcquire();
+      TR_VerboseLog::writeLine(TR_Vlog_PERF, "t=%6u Restore: target CPUs=%u usable compilation threads=%d",
+         (uint32_t)compInfo->getPersistentInfo()->getElapsedTime(), numProc, compInfo->getNumUsableCompilationThreads());
+      if (phMemAvail != OMRPORT_MEMINFO_NOT_AVAILABLE)
+         TR_VerboseLog::writeLine(TR_Vlog_PERF, "Restore: free physical memory: %lld MB %s", phMemAvail >> 20, incompleteInfo?"estimated":"");
+      TR_VerboseLog::vlogRelease();
+      }
+
+   compInfo->resumeCompilationThreadsSuspendedForCheckpoint(vmThread);
+   }
+
+static void jitHookCheckpointFailed(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
+   {
+   J9CheckpointFailedEvent * failedEvent = (J9CheckpointFailedEvent *)eventData;
+   J9VMThread * vmThread = failedEvent->currentThread;
+
+   /* No image was written, so the process keeps running as before the checkpoint */
+   TR::CompilationInfo::get(vmThread->javaVM->jitConfig)->resumeCompilationThreadsSuspendedForCheckpoint(vmThread);
    }
 #endif
 
@@ -1881,11 +2040,11 @@ static void jitHookClassesUnload(J9HookInterface * * hookInterface, UDATA eventN
       persistentInfo->clearVisitedSuperClasses();
 
       PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
-      J9ClassWalkState classWalkState;
-      J9Class * j9clazz;
+      uint64_t startTime = j9time_usec_clock();
       TR_OpaqueClassBlock *clazz;
-      j9clazz = vmThread->javaVM->internalVMFunctions->allClassesStartDo(&classWalkState, vmThread->javaVM, NULL);
-      while (j9clazz)
+      // The event lists all the dying classes, so there is no need to walk all the classes
+      // loaded in the JVM to find them
+      for (J9Class *j9clazz = unloadedEvent->classesToUnload; j9clazz; j9clazz = j9clazz->gcLink)
          {
          // If the romableAotITable field is set to 0, that means this class was not caught
          // by the JIT load hook and has not been loaded.
@@ -1895,12 +2054,8 @@ static void jitHookClassesUnload(J9HookInterface * * hookInterface, UDATA eventN
             clazz = ((TR_J9VMBase *)fe)->convertClassPtrToClassOffset(j9clazz);
             table->classGotUnloadedPost(fe,clazz); // side-effect: builds the array of visited superclasses
             }
-         j9clazz = vmThread->javaVM->internalVMFunctions->allClassesNextDo(&classWalkState);
          }
 
-      vmThread->javaVM->internalVMFunctions->allClassesEndDo(&classWalkState);
-
-
       TR_OpaqueClassBlock **visitedSuperClasses = persistentInfo->getVisitedSuperClasses();
       if (visitedSuperClasses && !persistentInfo->tooManySuperClasses())
          {
@@ -1918,6 +2073,7 @@ static void jitHookClassesUnload(J9HookInterface * * hookInterface, UDATA eventN
          {
          table->resetVisitedClasses();
          }
+      classUnloadingCost._chTable += j9time_usec_clock() - startTime;
       }
 
    return;
@@ -1935,6 +2091,9 @@ static void jitHookAnonClassesUnload(J9HookInterface * * hookInterface, UDATA ev
    if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseClassUnloading))
       TR_VerboseLog::writeLineLocked(TR_Vlog_GC, "jitHookAnonClassesUnload: unloading %u anonymous classes\n", (uint32_t)anonymousClassUnloadCount);
 
+   PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+   uint64_t phaseStart = j9time_usec_clock();
+
    // Create a dummy classLoader and change j9class->classLoader to point to this fake one
    J9ClassLoader dummyClassLoader;
    int32_t numClasses = 0;
@@ -1983,6 +2142,9 @@ static void jitHookAnonClassesUnload(J9HookInterface * * hookInterface, UDATA ev
       // Perform the cleanup
       jitRemoveAllMetaDataForClassLoader(vmThread, &dummyClassLoader);
       }
+   uint64_t phaseEnd = j9time_usec_clock();
+   classUnloadingCost._metaData += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    // Remove entries from the MCC hash tables related to trampolines
    if (needsMCCCleaning)
@@ -1991,6 +2153,9 @@ static void jitHookAnonClassesUnload(J9HookInterface * * hookInterface, UDATA ev
          TR_VerboseLog::writeLineLocked(TR_Vlog_GC, "jitHookAnonClassesUnload: will perform MCC cleaning\n");
       TR::CodeCacheManager::instance()->onClassUnloading(&dummyClassLoader);
       }
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._codeCache += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    J9JITConfig *jitConfig = vmThread->javaVM->jitConfig;
    TR::CompilationInfo * compInfo = TR::CompilationInfo::get(jitConfig);
@@ -1999,8 +2164,14 @@ static void jitHookAnonClassesUnload(J9HookInterface * * hookInterface, UDATA ev
    if (compInfo->getDLT_HT())
       compInfo->getDLT_HT()->onClassUnloading();
 #endif
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._other += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    compInfo->getLowPriorityCompQueue().purgeEntriesOnClassLoaderUnloading(&dummyClassLoader);
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._compQueues += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    compInfo->getPersistentInfo()->incGlobalClassUnloadID();
 #if defined(J9VM_INTERP_PROFILING_BYTECODES)
@@ -2018,6 +2189,9 @@ static void jitHookAnonClassesUnload(J9HookInterface * * hookInterface, UDATA ev
    // Invalidate the buffers from the hardware profiler
    if (compInfo->getPersistentInfo()->isRuntimeInstrumentationEnabled())
       compInfo->getHWProfiler()->invalidateProfilingBuffers();
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._profilers += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    // Don't want j9classes to point to the dummy class loader that will disappear
    for (J9Class* j9clazz = unloadedEvent->anonymousClassesToUnload; j9clazz; j9clazz = j9clazz->gcLink)
@@ -2025,6 +2199,7 @@ static void jitHookAnonClassesUnload(J9HookInterface * * hookInterface, UDATA ev
       cgOnClassUnloading(j9clazz);
       j9clazz->classLoader = NULL;
       }
+   classUnloadingCost._codeCache += j9time_usec_clock() - phaseStart;
    }
 #endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING)*/
 
@@ -2042,6 +2217,9 @@ static void jitHookClassUnload(J9HookInterface * * hookInterface, UDATA eventNum
    TR_J9VMBase * fej9 = TR_J9VMBase::get(jitConfig, vmThread);
    TR_OpaqueClassBlock *clazz = fej9->convertClassPtrToClassOffset(j9clazz);
 
+   PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+   uint64_t phaseStart = j9time_usec_clock();
+
       {
       TR::ClassTableCriticalSection removeClasses(fej9);
       TR_ASSERT(!removeClasses.acquiredVMAccess(), "jitHookClassUnload should already have VM access");
@@ -2067,12 +2245,13 @@ static void jitHookClassUnload(J9HookInterface * * hookInterface, UDATA eventNum
       TR_VerboseLog::writeLineLocked(TR_Vlog_HD, "Class unloading for class=0x%p\n", j9clazz);
       }
 
-   PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
-
    // remove from compilation request queue any methods that belong to this class
    fej9->acquireCompilationLock();
    fej9->invalidateCompilationRequestsForUnloadedMethods(clazz, false);
    fej9->releaseCompilationLock();
+   uint64_t phaseEnd = j9time_usec_clock();
+   classUnloadingCost._compQueues += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    J9Method * resolvedMethods = (J9Method *) fej9->getMethods((TR_OpaqueClassBlock*)j9clazz);
    uint32_t numMethods = fej9->getNumMethods((TR_OpaqueClassBlock*)j9clazz);
@@ -2089,6 +2268,9 @@ static void jitHookClassUnload(J9HookInterface * * hookInterface, UDATA eventNum
    static char *disableUnloadedClassRanges = feGetEnv("TR_disableUnloadedClassRanges");
    if (!disableUnloadedClassRanges)
       compInfo->getPersistentInfo()->addUnloadedClass(clazz, methodsStartAddr, (uint32_t)(methodsEndAddr-methodsStartAddr));
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._runtimeAssumptions += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    TR_RuntimeAssumptionTable * rat = compInfo->getPersistentInfo()->getRuntimeAssumptionTable();
    rat->notifyClassUnloadEvent(fej9, 0, clazz, clazz);
@@ -2113,12 +2295,18 @@ static void jitHookClassUnload(J9HookInterface * * hookInterface, UDATA eventNum
       }
 
    // END
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._runtimeAssumptions += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    TR_PersistentCHTable * table = 0;
    if (!TR::Options::getCmdLineOptions()->getOption(TR_DisableCHOpts))
       table = compInfo->getPersistentInfo()->getPersistentCHTable();
    if (table && table->isActive())
       table->classGotUnloaded(fej9, clazz);
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._chTable += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
 #if defined(J9VM_OPT_JITSERVER)
    // Add to JITServer unload list
@@ -2132,6 +2320,7 @@ static void jitHookClassUnload(J9HookInterface * * hookInterface, UDATA eventNum
          deserializer->invalidateClass(vmThread, j9clazz);
       }
 #endif
+   classUnloadingCost._other += j9time_usec_clock() - phaseStart;
    }
 #endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING)*/
 
@@ -2158,17 +2347,27 @@ static void jitHookClassLoaderUnload(J9HookInterface * * hookInterface, UDATA ev
    compInfo->getPersistentInfo()->incGlobalClassUnloadID();
 
    PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+   uint64_t phaseStart = j9time_usec_clock();
 
    if (classLoader->flags & J9CLASSLOADER_CONTAINS_JITTED_METHODS)
       jitRemoveAllMetaDataForClassLoader(vmThread, classLoader);
+   uint64_t phaseEnd = j9time_usec_clock();
+   classUnloadingCost._metaData += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    if (classLoader->flags & J9CLASSLOADER_CONTAINS_METHODS_PRESENT_IN_MCC_HASH)
       TR::CodeCacheManager::instance()->onClassUnloading(classLoader);
 
    // CodeGen-specific actions on class unloading
    cgOnClassUnloading(classLoader);
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._codeCache += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    compInfo->getLowPriorityCompQueue().purgeEntriesOnClassLoaderUnloading(classLoader);
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._compQueues += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
 #if defined(J9VM_INTERP_PROFILING_BYTECODES)
    if (!TR::Options::getCmdLineOptions()->getOption(TR_DisableIProfilerThread))
@@ -2185,6 +2384,9 @@ static void jitHookClassLoaderUnload(J9HookInterface * * hookInterface, UDATA ev
    // Invalidate the buffers from the hardware profiler
    if (compInfo->getPersistentInfo()->isRuntimeInstrumentationEnabled())
       compInfo->getHWProfiler()->invalidateProfilingBuffers();
+   phaseEnd = j9time_usec_clock();
+   classUnloadingCost._profilers += phaseEnd - phaseStart;
+   phaseStart = phaseEnd;
 
    compInfo->getPersistentInfo()->getPersistentClassLoaderTable()->removeClassLoader(vmThread, classLoader);
 
@@ -2192,6 +2394,7 @@ static void jitHookClassLoaderUnload(J9HookInterface * * hookInterface, UDATA ev
    if (auto deserializer = compInfo->getJITServerAOTDeserializer())
       deserializer->invalidateClassLoader(vmThread, classLoader);
 #endif /* defined(J9VM_OPT_JITSERVER) */
+   classUnloadingCost._other += j9time_usec_clock() - phaseStart;
    }
 
 #endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING)*/
@@ -4313,6 +4516,10 @@ void JitShutdown(J9JITConfig * jitConfig)
       {
       statsThreadObj->stopStatisticsThread(jitConfig);
       }
+
+   // Save AOT caches after the statistics thread has stopped to include all the methods compiled so far
+   if (auto aotCacheMap = TR::CompilationInfo::get(jitConfig)->getJITServerAOTCacheMap())
+      aotCacheMap->saveCaches();
 #endif
 
    TR_DebuggingCounters::report();
@@ -5989,6 +6196,11 @@ static int32_t J9THREAD_PROC samplerThreadProc(void * entryarg)
 
             TR_DebuggingCounters::transferSmallCountsToTotalCounts();
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+            // Reclaim the runtime assumptions left behind by the last class unloading
+            jitDeferredClassUnloadingCleanup(compInfo);
+#endif
+
             if (TR::Options::_compilationExpirationTime > 0 &&
                 !persistentInfo->getDisableFurtherCompilation())
                {
@@ -6793,7 +7005,8 @@ int32_t setUpHooks(J9JavaVM * javaVM, J9JITConfig * jitConfig, TR_FrontEnd * vm)
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
    if ((*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_PREPARING_FOR_CHECKPOINT, jitHookPrepareCheckpoint, OMR_GET_CALLSITE(), NULL) ||
-       (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_PREPARING_FOR_RESTORE, jitHookPrepareRestore, OMR_GET_CALLSITE(), NULL))
+       (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_PREPARING_FOR_RESTORE, jitHookPrepareRestore, OMR_GET_CALLSITE(), NULL) ||
+       (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CHECKPOINT_FAILED, jitHookCheckpointFailed, OMR_GET_CALLSITE(), NULL))
       {
       j9tty_printf(PORTLIB, "Error: Unable to register CRIU hook\n");
       return -1;
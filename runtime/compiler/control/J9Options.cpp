@@ -73,6 +73,9 @@ bool enableCompiledMethodLoadHookOnly = false;
 
 bool J9::Options::_doNotProcessEnvVars = false; // set through XX options in Java
 bool J9::Options::_reportByteCodeInfoAtCatchBlock = false;
+bool J9::Options::_generatePerfJitDump = false;
+bool J9::Options::_useHotCodeCache = false;
+bool J9::Options::_useHugePagesForHotCodeCache = false;
 int32_t J9::Options::_samplingFrequencyInIdleMode = 1000; // ms
 #if defined(J9VM_OPT_JITSERVER)
 int32_t J9::Options::_statisticsFrequency = 0; // ms
@@ -128,8 +131,13 @@ int64_t J9::Options::_oldAgeUnderLowMemory = 1000*60*5; // 5 minute
 int64_t J9::Options::_timeBetweenPurges = 1000*60*1; // 1 minute
 bool J9::Options::_shareROMClasses = false;
 int32_t J9::Options::_sharedROMClassCacheNumPartitions = 16;
+bool J9::Options::_shareProfiles = false;
+int32_t J9::Options::_sharedProfileHalfLife = 600000; // ms
+int32_t J9::Options::_aotCachePersistenceSavePeriod = 60000; // ms
 int32_t J9::Options::_highActiveThreadThreshold = -1;
 int32_t J9::Options::_veryHighActiveThreadThreshold = -1;
+int32_t J9::Options::_perClientCompThreadLimit = -1;
+int32_t J9::Options::_perClientScratchSpaceLimitKB = 0;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 int32_t J9::Options::_interpreterSamplingThreshold = 300;
@@ -152,6 +160,7 @@ int32_t J9::Options::_iprofilerIntToTotalSampleRatio=2;
 int32_t J9::Options::_iprofilerSamplesBeforeTurningOff = 1000000; // samples
 int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
+int32_t J9::Options::_numIProfilerThreads = -1; // -1 means: computed from the number of CPUs
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
 #ifdef TR_HOST_64BIT
@@ -676,6 +685,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
 
    {"activeThreadsThresholdForInterpreterSampling=", "M<nnn>\tSampling does not affect invocation count beyond this threshold",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_activeThreadsThreshold, 0, "F%d", NOT_IN_SUBSET },
+#if defined(J9VM_OPT_JITSERVER)
+   {"aotCachePersistenceSavePeriod=", "M<nnn>\tperiod (ms) for saving JITServer AOT cache snapshot files",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_aotCachePersistenceSavePeriod, 0, "F%d", NOT_IN_SUBSET},
+#endif /* defined(J9VM_OPT_JITSERVER) */
    {"aotMethodCompilesThreshold=", "R<nnn>\tIf this many AOT methods are compiled before exceeding aotMethodThreshold, don't stop AOT compiling",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_aotMethodCompilesThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"aotMethodThreshold=", "R<nnn>\tNumber of methods found in shared cache after which we stop AOTing",
@@ -914,6 +927,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numCodeCachesToCreateAtStartup, 0, "F%d", NOT_IN_SUBSET},
     {"numDLTBufferMatchesToEagerlyIssueCompReq=", "R<nnn>\t",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numDLTBufferMatchesToEagerlyIssueCompReq, 0, "F%d", NOT_IN_SUBSET},
+   {"numIProfilerThreads=", "O<nnn>\tnumber of threads that process interpreter profiling buffers",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numIProfilerThreads, 0, "F%d", NOT_IN_SUBSET},
    {"numInterpCompReqToExitIdleMode=", "M<nnn>\tNumber of first time comp. req. that takes the JIT out of idle mode",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numFirstTimeCompilationsToExitIdleMode, 0, "F%d", NOT_IN_SUBSET },
 #if defined(J9VM_OPT_JITSERVER)
@@ -921,6 +936,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_oldAge,  0, "F%d"},
    {"oldAgeUnderLowMemory=", " \tDefines what an old JITServer cache entry means when memory is low",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_oldAgeUnderLowMemory,  0, "F%d" },
+   {"perClientCompThreadLimit=", " \tMaximum number of JITServer compilation threads working for the same client",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_perClientCompThreadLimit, 0, "F%d", NOT_IN_SUBSET},
+   {"perClientScratchSpaceLimitKB=", " \tScratch memory shared by the concurrent JITServer compilations of the same client",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_perClientScratchSpaceLimitKB, 0, "F%d", NOT_IN_SUBSET},
 #endif /* defined(J9VM_OPT_JITSERVER) */
    {"profileAllTheTime=",    "R<nnn>\tInterpreter profiling will be on all the time",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_profileAllTheTime, 0, "F%d", NOT_IN_SUBSET},
@@ -968,6 +987,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"seriousCompFailureThreshold=",     "M<nnn>\tnumber of srious compilation failures after which we write a trace point in the snap file",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_seriousCompFailureThreshold, 0, "F%d", NOT_IN_SUBSET},
 #if defined(J9VM_OPT_JITSERVER)
+   {"sharedProfileHalfLife=", " \ttime in ms after which the counts of the IProfiler data aggregated from all JITServer clients are halved",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_sharedProfileHalfLife, 0, "F%d", NOT_IN_SUBSET},
    {"sharedROMClassCacheNumPartitions=", " \tnumber of JITServer ROMClass cache partitions (each has its own monitor)",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_sharedROMClassCacheNumPartitions, 0, "F%d", NOT_IN_SUBSET},
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -1125,6 +1146,12 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    const char *xxDisableRequireJITServerOption = "-XX:-RequireJITServer";
    const char *xxJITServerLogConnections = "-XX:+JITServerLogConnections";
    const char *xxDisableJITServerLogConnections = "-XX:-JITServerLogConnections";
+   const char *xxJITServerUseCompressionOption = "-XX:+JITServerUseCompression";
+   const char *xxDisableJITServerUseCompressionOption = "-XX:-JITServerUseCompression";
+   const char *xxJITServerCompressionThresholdOption = "-XX:JITServerCompressionThreshold=";
+   const char *xxJITServerUseSharedMemoryOption = "-XX:+JITServerUseSharedMemory";
+   const char *xxDisableJITServerUseSharedMemoryOption = "-XX:-JITServerUseSharedMemory";
+   const char *xxJITServerSharedMemorySocketOption = "-XX:JITServerSharedMemorySocket=";
 
    int32_t xxJITServerPortArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerPortOption, 0);
    int32_t xxJITServerTimeoutArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerTimeoutOption, 0);
@@ -1137,6 +1164,12 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    int32_t xxDisableRequireJITServerArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableRequireJITServerOption, 0);
    int32_t xxJITServerLogConnectionsArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerLogConnections, 0);
    int32_t xxDisableJITServerLogConnectionsArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerLogConnections, 0);
+   int32_t xxJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerUseCompressionOption, 0);
+   int32_t xxDisableJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerUseCompressionOption, 0);
+   int32_t xxJITServerCompressionThresholdArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerCompressionThresholdOption, 0);
+   int32_t xxJITServerUseSharedMemoryArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerUseSharedMemoryOption, 0);
+   int32_t xxDisableJITServerUseSharedMemoryArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerUseSharedMemoryOption, 0);
+   int32_t xxJITServerSharedMemorySocketArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerSharedMemorySocketOption, 0);
 
    if (xxJITServerPortArgIndex >= 0)
       {
@@ -1203,6 +1236,35 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
       TR::Options::setVerboseOption(TR_VerboseJITServerConns);
       }
 
+   if (xxJITServerUseCompressionArgIndex > xxDisableJITServerUseCompressionArgIndex)
+      compInfo->getPersistentInfo()->setJITServerUseCompression(true);
+
+   if (xxJITServerCompressionThresholdArgIndex >= 0)
+      {
+      uint32_t threshold = 0;
+      IDATA ret = GET_INTEGER_VALUE(xxJITServerCompressionThresholdArgIndex, xxJITServerCompressionThresholdOption, threshold);
+      if (ret == OPTION_OK)
+         compInfo->getPersistentInfo()->setJITServerCompressionThreshold(threshold);
+      }
+
+   if (xxJITServerUseSharedMemoryArgIndex > xxDisableJITServerUseSharedMemoryArgIndex)
+      {
+      compInfo->getPersistentInfo()->setJITServerUseSharedMemory(true);
+      if (xxJITServerSharedMemorySocketArgIndex >= 0)
+         {
+         char *path = NULL;
+         GET_OPTION_VALUE(xxJITServerSharedMemorySocketArgIndex, '=', &path);
+         compInfo->getPersistentInfo()->setJITServerSharedMemorySocketPath(path);
+         }
+      else
+         {
+         // Default path depends on the port, so that several servers can run on the same host
+         char path[64];
+         snprintf(path, sizeof(path), "/tmp/.jitserver.%u", compInfo->getPersistentInfo()->getJITServerPort());
+         compInfo->getPersistentInfo()->setJITServerSharedMemorySocketPath(path);
+         }
+      }
+
    return true;
    }
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -1471,6 +1533,44 @@ void J9::Options::preProcessCodeCachePrintCodeCache(J9JavaVM *vm)
       }
    }
 
+void J9::Options::preProcessPerfJitDump(J9JavaVM *vm)
+   {
+   const char *xxPerfJitDumpOption = "-XX:+PerfJitDump";
+   const char *xxDisablePerfJitDumpOption = "-XX:-PerfJitDump";
+   int32_t xxPerfJitDumpArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxPerfJitDumpOption, 0);
+   int32_t xxDisablePerfJitDumpArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisablePerfJitDumpOption, 0);
+
+   if (xxPerfJitDumpArgIndex > xxDisablePerfJitDumpArgIndex)
+      {
+      _generatePerfJitDump = true;
+      }
+   }
+
+void J9::Options::preProcessHotCodeCache(J9JavaVM *vm)
+   {
+   const char *xxHotCodeCacheOption = "-XX:+JITHotCodeCache";
+   const char *xxDisableHotCodeCacheOption = "-XX:-JITHotCodeCache";
+   const char *xxHotCodeCacheHugePagesOption = "-XX:+JITHotCodeCacheHugePages";
+   const char *xxDisableHotCodeCacheHugePagesOption = "-XX:-JITHotCodeCacheHugePages";
+   int32_t xxHotCodeCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxHotCodeCacheOption, 0);
+   int32_t xxDisableHotCodeCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableHotCodeCacheOption, 0);
+   int32_t xxHotCodeCacheHugePagesArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxHotCodeCacheHugePagesOption, 0);
+   int32_t xxDisableHotCodeCacheHugePagesArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableHotCodeCacheHugePagesOption, 0);
+
+   // -XX:+JITHotCodeCacheHugePages implies -XX:+JITHotCodeCache unless the latter is explicitly disabled
+   if (xxHotCodeCacheHugePagesArgIndex > xxDisableHotCodeCacheHugePagesArgIndex)
+      {
+      _useHugePagesForHotCodeCache = true;
+      if (xxHotCodeCacheHugePagesArgIndex > xxDisableHotCodeCacheArgIndex)
+         _useHotCodeCache = true;
+      }
+
+   if (xxHotCodeCacheArgIndex > xxDisableHotCodeCacheArgIndex)
+      {
+      _useHotCodeCache = true;
+      }
+   }
+
 bool J9::Options::preProcessCodeCacheXlpCodeCache(J9JavaVM *vm, J9JITConfig *jitConfig)
    {
    PORT_ACCESS_FROM_JAVAVM(vm);
@@ -1836,6 +1936,8 @@ bool J9::Options::preProcessCodeCache(J9JavaVM *vm, J9JITConfig *jitConfig)
    self()->preProcessCodeCacheIncreaseTotalSize(vm, jitConfig);
 
    self()->preProcessCodeCachePrintCodeCache(vm);
+   self()->preProcessPerfJitDump(vm);
+   self()->preProcessHotCodeCache(vm);
 
    if (!self()->preProcessCodeCacheXlpCodeCache(vm, jitConfig))
       {
@@ -1999,6 +2101,36 @@ bool J9::Options::preProcessJitServer(J9JavaVM *vm, J9JITConfig *jitConfig)
             {
             _shareROMClasses = true;
             }
+
+         // Check if IProfiler data should be aggregated across clients
+         const char *xxJITServerShareProfilesOption = "-XX:+JITServerShareProfiles";
+         const char *xxDisableJITServerShareProfilesOption = "-XX:-JITServerShareProfiles";
+
+         int32_t xxJITServerShareProfilesArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerShareProfilesOption, 0);
+         int32_t xxDisableJITServerShareProfilesArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerShareProfilesOption, 0);
+         if (xxJITServerShareProfilesArgIndex > xxDisableJITServerShareProfilesArgIndex)
+            {
+            _shareProfiles = true;
+            }
+
+         // Check if AOT caches should be saved to snapshot files and loaded from them on restart
+         const char *xxJITServerAOTCachePersistenceOption = "-XX:+JITServerAOTCachePersistence";
+         const char *xxDisableJITServerAOTCachePersistenceOption = "-XX:-JITServerAOTCachePersistence";
+         const char *xxJITServerAOTCacheDirOption = "-XX:JITServerAOTCacheDir=";
+
+         int32_t xxJITServerAOTCachePersistenceArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerAOTCachePersistenceOption, 0);
+         int32_t xxDisableJITServerAOTCachePersistenceArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerAOTCachePersistenceOption, 0);
+         int32_t xxJITServerAOTCacheDirArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerAOTCacheDirOption, 0);
+         if (xxJITServerAOTCachePersistenceArgIndex > xxDisableJITServerAOTCachePersistenceArgIndex)
+            {
+            compInfo->getPersistentInfo()->setJITServerAOTCachePersistence(true);
+            if (xxJITServerAOTCacheDirArgIndex >= 0)
+               {
+               char *dir = NULL;
+               GET_OPTION_VALUE(xxJITServerAOTCacheDirArgIndex, '=', &dir);
+               compInfo->getPersistentInfo()->setJITServerAOTCacheDir(dir);
+               }
+            }
          }
       else
          {
@@ -2354,8 +2486,11 @@ J9::Options::setupJITServerOptions()
       else if (persistentInfo->getRemoteCompilationMode() == JITServer::CLIENT)
          {
          TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "JITServer Client Mode. Server address: %s port: %d. Connection Timeout %ums",
-               persistentInfo->getJITServerAddress().c_str(), persistentInfo->getJITServerPort(),
+               persistentInfo->getJITServerAddress().c_str(), persistentInfo->getJITServerPort(0),
                persistentInfo->getSocketTimeout());
+         for (uint32_t i = 1; i < persistentInfo->getNumJITServerEndpoints(); ++i)
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Alternate server address: %s port: %d",
+                  persistentInfo->getJITServerAddress(i).c_str(), persistentInfo->getJITServerPort(i));
          TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Identifier for current client JVM: %llu\n",
                (unsigned long long) compInfo->getPersistentInfo()->getClientUID());
          }
@@ -2633,6 +2768,13 @@ bool J9::Options::feLatePostProcess(void * base, TR::OptionSet * optionSet)
    if (_highActiveThreadThreshold  > _veryHighActiveThreadThreshold)
       _highActiveThreadThreshold  = _veryHighActiveThreadThreshold;
 
+   // By default a single client can use three quarters of the compilation threads,
+   // so that requests from other clients can start even when one client is very busy
+   if (_perClientCompThreadLimit == -1)
+      _perClientCompThreadLimit = getNumUsableCompilationThreads() * 3 / 4;
+   if (_perClientCompThreadLimit < 1)
+      _perClientCompThreadLimit = 1;
+
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    // Determine whether or not to inline monitor enter/exit
@@ -82,6 +82,14 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
     */
    static inline bool setReportByteCodeInfoAtCatchBlock(bool b = true) { return _reportByteCodeInfoAtCatchBlock = b; }
 
+   static bool _generatePerfJitDump; // -XX:+PerfJitDump; see TR_PerfJitDump
+   static bool getGeneratePerfJitDump() { return _generatePerfJitDump; }
+
+   static bool _useHotCodeCache; // -XX:+JITHotCodeCache; see J9::CodeCacheManager::reserveHotCodeCache
+   static bool getUseHotCodeCache() { return _useHotCodeCache; }
+   static bool _useHugePagesForHotCodeCache; // -XX:+JITHotCodeCacheHugePages
+   static bool getUseHugePagesForHotCodeCache() { return _useHugePagesForHotCodeCache; }
+
    static int32_t _samplingFrequencyInIdleMode;
    static int32_t getSamplingFrequencyInIdleMode() {return _samplingFrequencyInIdleMode;}
 
@@ -185,6 +193,7 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _iprofilerSamplesBeforeTurningOff;
    static int32_t _iprofilerNumOutstandingBuffers;
    static int32_t _iprofilerBufferMaxPercentageToDiscard;
+   static int32_t _numIProfilerThreads;
    static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
    static int32_t _iprofilerBufferSize; //iprofilerbuffer size in kb
 
@@ -269,6 +278,14 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int64_t _timeBetweenPurges;
    static bool _shareROMClasses;
    static int32_t _sharedROMClassCacheNumPartitions;
+   static bool _shareProfiles; // aggregate IProfiler data across clients
+   static int32_t _sharedProfileHalfLife; // ms
+   static int32_t getSharedProfileHalfLife() { return _sharedProfileHalfLife; }
+   static int32_t _aotCachePersistenceSavePeriod; // ms
+   static int32_t _perClientCompThreadLimit; // max number of server compilation threads working for one client
+   static int32_t getPerClientCompThreadLimit() { return _perClientCompThreadLimit; }
+   static int32_t _perClientScratchSpaceLimitKB; // scratch memory shared by the concurrent compilations of one client; 0 for no limit
+   static int32_t getPerClientScratchSpaceLimitKB() { return _perClientScratchSpaceLimitKB; }
    const static uint32_t DEFAULT_JITCLIENT_TIMEOUT = 10000; // ms
    const static uint32_t DEFAULT_JITSERVER_TIMEOUT = 30000; // ms
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -405,6 +422,22 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
     */
    void preProcessCodeCachePrintCodeCache(J9JavaVM *vm);
 
+   /** \brief
+    *     Set the option to write a perf jitdump file.
+    *
+    *  \param vm
+    *     J9JavaVM pointer.
+    */
+   void preProcessPerfJitDump(J9JavaVM *vm);
+
+   /** \brief
+    *     Set the options to place the code of hot compilations in a dedicated code cache.
+    *
+    *  \param vm
+    *     J9JavaVM pointer.
+    */
+   void preProcessHotCodeCache(J9JavaVM *vm);
+
    /** \brief
     *     Set large code page size and flags.
     *
@@ -41,6 +41,7 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/J9VMAccess.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerAOTDeserializer.hpp"
 #include "runtime/JITServerIProfiler.hpp"
 #include "runtime/RelocationTarget.hpp"
 #include "env/TypeLayout.hpp"
@@ -158,8 +159,10 @@ handler_IProfiler_profilingSample(JITServer::ClientStream *client, TR_J9VM *fe,
       }
    }
 
+// Handle a message received from the server; the caller must hold VM access.
+// Return true if the message ends the compilation.
 static bool
-handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::MessageType &response)
+processServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::MessageType response)
    {
    using JITServer::MessageType;
    TR::CompilationInfoPerThread *compInfoPT = fe->_compInfoPT;
@@ -167,36 +170,6 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
    TR_Memory  *trMemory = compInfoPT->getCompilation()->trMemory();
    TR::Compilation *comp = compInfoPT->getCompilation();
    TR::CompilationInfo *compInfo = compInfoPT->getCompilationInfo();
-
-   TR_ASSERT(TR::MonitorTable::get()->getClassUnloadMonitorHoldCount(compInfoPT->getCompThreadId()) == 0, "Must not hold classUnloadMonitor");
-   TR::MonitorTable *table = TR::MonitorTable::get();
-   TR_ASSERT(table && table->isThreadInSafeMonitorState(vmThread), "Must not hold any monitors when waiting for server");
-
-   response = client->read();
-
-   // Acquire VM access and check for possible class unloading
-   acquireVMAccessNoSuspend(vmThread);
-
-   // Update statistics for server message type
-   JITServerHelpers::serverMsgTypeCount[response] += 1;
-
-   // If JVM has unloaded classes inform the server to abort this compilation
-   uint8_t interruptReason = compInfoPT->compilationShouldBeInterrupted();
-   if (interruptReason && response != MessageType::jitDumpPrintIL)
-      {
-      // Inform the server if compilation is not yet complete
-      if ((response != MessageType::compilationCode) &&
-          (response != MessageType::compilationFailure))
-         client->writeError(JITServer::MessageType::compilationInterrupted, 0 /* placeholder */);
-
-      if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
-         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "Interrupting remote compilation (interruptReason %u) in handleServerMessage(%s) for %s @ %s",
-                                                          interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
-
-      Trc_JITServerInterruptRemoteCompile(vmThread, interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
-      comp->failCompilation<TR::CompilationInterrupted>("Compilation interrupted in handleServerMessage");
-      }
-
    TR::KnownObjectTable *knot = comp->getOrCreateKnownObjectTable();
 
    bool done = false;
@@ -214,6 +187,30 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          client->write(response, JITServer::Void());
          }
          break;
+      case MessageType::batchedQueries:
+         {
+         // Answer all the queries of the batch, then send all the replies in one message
+         auto queries = std::get<0>(client->getRecvData<std::vector<std::string>>());
+         std::vector<std::string> replies;
+         replies.reserve(queries.size());
+         try
+            {
+            for (const auto &query : queries)
+               {
+               MessageType queryType = client->beginBatchedQuery(query, &replies);
+               JITServerHelpers::serverMsgTypeCount[queryType] += 1;
+               processServerMessage(client, fe, queryType);
+               client->endBatchedQuery();
+               }
+            }
+         catch (...)
+            {
+            client->endBatchedQuery();
+            throw;
+            }
+         client->write(response, replies);
+         }
+         break;
       case MessageType::getUnloadedClassRangesAndCHTable:
          {
          uint64_t serverUID = std::get<0>(client->getRecvData<uint64_t>());
@@ -236,6 +233,12 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
             OMR::CriticalSection romClassCache(compInfo->getclassesCachedAtServerMonitor());
             compInfo->getclassesCachedAtServer().clear();
             }
+         // A different server instance, or a restarted one, does not know the IDs of our cached AOT records
+         if (previousUID != serverUID)
+            {
+            if (auto deserializer = compInfo->getJITServerAOTDeserializer())
+               deserializer->reset();
+            }
 
          if (previousUID != serverUID && TR::Options::getVerboseOption(TR_VerboseJITServerConns))
             {
@@ -2780,6 +2783,48 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          TR_ASSERT(false, "JITServer: handleServerMessage received an unknown message type: %d\n", response);
       }
 
+   return done;
+   }
+
+static bool
+handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::MessageType &response)
+   {
+   using JITServer::MessageType;
+   TR::CompilationInfoPerThread *compInfoPT = fe->_compInfoPT;
+   J9VMThread *vmThread = compInfoPT->getCompilationThread();
+   TR::Compilation *comp = compInfoPT->getCompilation();
+
+   TR_ASSERT(TR::MonitorTable::get()->getClassUnloadMonitorHoldCount(compInfoPT->getCompThreadId()) == 0, "Must not hold classUnloadMonitor");
+   TR::MonitorTable *table = TR::MonitorTable::get();
+   TR_ASSERT(table && table->isThreadInSafeMonitorState(vmThread), "Must not hold any monitors when waiting for server");
+
+   response = client->read();
+
+   // Acquire VM access and check for possible class unloading
+   acquireVMAccessNoSuspend(vmThread);
+
+   // Update statistics for server message type
+   JITServerHelpers::serverMsgTypeCount[response] += 1;
+
+   // If JVM has unloaded classes inform the server to abort this compilation
+   uint8_t interruptReason = compInfoPT->compilationShouldBeInterrupted();
+   if (interruptReason && response != MessageType::jitDumpPrintIL)
+      {
+      // Inform the server if compilation is not yet complete
+      if ((response != MessageType::compilationCode) &&
+          (response != MessageType::compilationFailure))
+         client->writeError(JITServer::MessageType::compilationInterrupted, 0 /* placeholder */);
+
+      if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "Interrupting remote compilation (interruptReason %u) in handleServerMessage(%s) for %s @ %s",
+                                                          interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
+
+      Trc_JITServerInterruptRemoteCompile(vmThread, interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
+      comp->failCompilation<TR::CompilationInterrupted>("Compilation interrupted in handleServerMessage");
+      }
+
+   bool done = processServerMessage(client, fe, response);
+
    releaseVMAccess(vmThread);
    return done;
    }
@@ -3034,22 +3079,40 @@ remoteCompile(
       enableJITServerPerCompConn && !details.isJitDumpMethod() ? 
       NULL
       : compInfoPT->getClientStream();
+   // The client has moved to another server since this compilation thread last connected
+   if (client && !details.isJitDumpMethod() && client->getServerEndpoint() != JITServerHelpers::getActiveServerEndpoint())
+      {
+      try
+         {
+         client->writeError(JITServer::MessageType::connectionTerminate, 0 /* placeholder */);
+         }
+      catch (const JITServer::StreamFailure &e)
+         {
+         // The connection is discarded anyway
+         }
+      client->~ClientStream();
+      TR_Memory::jitPersistentFree(client);
+      compInfoPT->setClientStream(NULL);
+      client = NULL;
+      }
    if (!client)
       {
+      uint32_t serverEndpoint = JITServerHelpers::getActiveServerEndpoint();
       try
          {
          if (JITServerHelpers::isServerAvailable())
             {
-            client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo());
+            client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo(), serverEndpoint);
             if (!enableJITServerPerCompConn)
                compInfoPT->setClientStream(client);
+            JITServerHelpers::postStreamConnectionSuccess(serverEndpoint);
             }
          else if (JITServerHelpers::shouldRetryConnection(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary)))
             {
-            client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo());
+            client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo(), serverEndpoint);
             if (!enableJITServerPerCompConn)
                compInfoPT->setClientStream(client);
-            JITServerHelpers::postStreamConnectionSuccess();
+            JITServerHelpers::postStreamConnectionSuccess(serverEndpoint);
             }
          else
             {
@@ -3062,7 +3125,7 @@ remoteCompile(
          }
       catch (const JITServer::StreamFailure &e)
          {
-         JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo);
+         JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo, serverEndpoint);
          if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
             TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE,
                "JITServer::StreamFailure: %s for %s @ %s", e.what(), compiler->signature(), compiler->getHotnessName());
@@ -3128,6 +3191,13 @@ remoteCompile(
    
    compInfo->getSequencingMonitor()->exit();
 
+   // Send the information needed to create the resolved method for the method being compiled together with the
+   // compilation request; the server would otherwise ask for it with a separate message in every compilation
+   static bool disableJITServerPrefetch = feGetEnv("TR_DisableJITServerPrefetch") ? true : false;
+   TR_ResolvedJ9JITServerMethodInfo compileeMethodInfo;
+   if (!disableJITServerPrefetch)
+      TR_ResolvedJ9JITServerMethod::createResolvedMethodMirror(compileeMethodInfo, (TR_OpaqueMethodBlock *)method, 0, NULL, compiler->fej9vm(), compiler->trMemory());
+
    uint32_t statusCode = compilationFailure;
    std::string codeCacheStr;
    std::string dataCacheStr;
@@ -3154,10 +3224,13 @@ remoteCompile(
 
       Trc_JITServerRemoteCompileRequest(vmThread, seqNo, compiler->signature(), compiler->getHotnessName());
 
+      uint64_t requestStartTime = compInfo->getPersistentInfo()->getElapsedTime();
+
       client->buildCompileRequest(compiler->getPersistentInfo()->getClientUID(), seqNo, lastCriticalSeqNo, romMethodOffset, method,
                                   clazz, *compInfoPT->getMethodBeingCompiled()->_optimizationPlan, detailsStr,
                                   details.getType(), unloadedClasses, illegalModificationList, classInfoTuple, optionsStr, recompMethodInfoStr,
-                                  chtableUpdates.first, chtableUpdates.second, useAotCompilation, TR::Compiler->vm.isVMInStartupPhase(compInfoPT->getJitConfig()));
+                                  chtableUpdates.first, chtableUpdates.second, useAotCompilation, TR::Compiler->vm.isVMInStartupPhase(compInfoPT->getJitConfig()),
+                                  compileeMethodInfo);
       JITServer::MessageType response;
       while(!handleServerMessage(client, compiler->fej9vm(), response));
 
@@ -3187,6 +3260,9 @@ remoteCompile(
          JITServer::ServerMemoryState nextMemoryState = std::get<9>(recv);
          JITServer::ServerActiveThreadsState nextActiveThreadState = std::get<10>(recv);
          updateCompThreadActivationPolicy(compInfoPT, nextMemoryState, nextActiveThreadState);
+         JITServerHelpers::updateServerEndpointLoad(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo,
+                                                    client->getServerEndpoint(), compInfo->getPersistentInfo()->getElapsedTime() - requestStartTime,
+                                                    nextMemoryState, nextActiveThreadState);
          }
       else if (JITServer::MessageType::jitDumpPrintIL == response)
          {
@@ -3256,7 +3332,7 @@ remoteCompile(
             }
 
          // Since server has crashed, all compilations will switch to local
-         JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo);
+         JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo, client->getServerEndpoint());
          compInfoPT->getMethodBeingCompiled()->_compErrCode = compilationFailure;
          compiler->failCompilation<JITServer::ServerCompilationFailure>("JITServer compilation thread has crashed.");
          }
@@ -3286,7 +3362,9 @@ remoteCompile(
       }
    catch (const JITServer::StreamFailure &e)
       {
-      JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo);
+      // If another server is reachable, this becomes the active server and the
+      // compilation is retried there rather than locally
+      JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo, client->getServerEndpoint());
 
       if (!details.isJitDumpMethod())
          {
@@ -193,11 +193,13 @@ outOfProcessCompilationEnd(
                                       activeThreadState, methodsRequiringTrampolines
                                      );
    compInfoPT->clearPerCompilationCaches();
+   entry->_stream->recordRoundTripStats();
 
    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
       {
-      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d has successfully compiled %s memoryState=%d",
-         compInfoPT->getCompThreadId(), compInfoPT->getCompilation()->signature(), memoryState);
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d has successfully compiled %s memoryState=%d roundTrips=%u roundTripWaitTime=%llu usec",
+         compInfoPT->getCompThreadId(), compInfoPT->getCompilation()->signature(), memoryState,
+         entry->_stream->getNumRoundTrips(), (unsigned long long)entry->_stream->getRoundTripWaitTimeUs());
       }
 
    Trc_JITServerCompileEnd(compInfoPT->getCompilationThread(), compInfoPT->getCompThreadId(),
@@ -218,7 +220,10 @@ TR::CompilationInfoPerThreadRemote::CompilationInfoPerThreadRemote(TR::Compilati
    _fieldAttributesCache(NULL),
    _staticAttributesCache(NULL),
    _isUnresolvedStrCache(NULL),
-   _classUnloadReadMutexDepth(0)
+   _classUnloadReadMutexDepth(0),
+   _clientFairShare(NULL),
+   _prefetchedCompilee(NULL),
+   _prefetchedCompileeIsAOT(false)
    {}
 
 /**
@@ -266,6 +271,29 @@ TR::CompilationInfoPerThreadRemote::waitForMyTurn(ClientSessionData *clientSessi
    uint32_t seqNo = getSeqNo();
    uint32_t criticalSeqNo = getExpectedSeqNo(); // This is the seqNo that I must wait for
 
+   // While parked, this thread does not count against the compilation threads the client may use,
+   // otherwise the request we are waiting for could be kept in the queue by -Xjit:perClientCompThreadLimit
+   TR::CompilationInfo::ClientFairShare *fairShare = getClientFairShare();
+   if (fairShare)
+      {
+      VM_AtomicSupport::add(&fairShare->_numParkedThreads, 1);
+
+      // Wake up the threads that skipped requests of this client because of the limit.
+      // The compilation monitor is acquired before the sequencing monitor elsewhere, so release the latter first.
+      clientSession->getSequencingMonitor()->exit();
+      getCompilationInfo()->acquireCompMonitor(getCompilationThread());
+      getCompilationInfo()->getCompilationMonitor()->notifyAll();
+      getCompilationInfo()->releaseCompMonitor(getCompilationThread());
+      clientSession->getSequencingMonitor()->enter();
+
+      // The request we were waiting for may have been processed in the meantime
+      if (criticalSeqNo <= clientSession->getLastProcessedCriticalSeqNo())
+         {
+         VM_AtomicSupport::subtract(&fairShare->_numParkedThreads, 1);
+         return;
+         }
+      }
+
    // Insert this thread into the list of out of sequence entries
    JITServerHelpers::insertIntoOOSequenceEntryList(clientSession, &entry);
 
@@ -376,6 +404,9 @@ TR::CompilationInfoPerThreadRemote::waitForMyTurn(ClientSessionData *clientSessi
             }
          }
       } while (criticalSeqNo > clientSession->getLastProcessedCriticalSeqNo());
+
+   if (fairShare)
+      VM_AtomicSupport::subtract(&fairShare->_numParkedThreads, 1);
    }
 
 
@@ -419,12 +450,15 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
    // hasIncNumActiveThreads is used to determine if decNumActiveThreads() should be
    // called when an exception is thrown.
    bool hasIncNumActiveThreads = false;
+   // Time when the request was received; used to charge the client for the compilation time it consumes
+   uint64_t requestStartTime = 0;
    try
       {
       auto req = stream->readCompileRequest<uint64_t, uint32_t, uint32_t, uint32_t, J9Method *, J9Class*,
          TR_OptimizationPlan, std::string, J9::IlGeneratorMethodDetailsType,
          std::vector<TR_OpaqueClassBlock*>, std::vector<TR_OpaqueClassBlock*>, 
-         JITServerHelpers::ClassInfoTuple, std::string, std::string, std::string, std::string, bool, bool>();
+         JITServerHelpers::ClassInfoTuple, std::string, std::string, std::string, std::string, bool, bool,
+         TR_ResolvedJ9JITServerMethodInfo>();
 
       clientId                           = std::get<0>(req);
       seqNo                              = std::get<1>(req); // Sequence number at the client
@@ -443,6 +477,7 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       const std::string &chtableUnloads  = std::get<14>(req);
       const std::string &chtableMods     = std::get<15>(req);
       useAotCompilation                  = std::get<16>(req);
+      setPrefetchedCompileeInfo((TR_OpaqueMethodBlock *)ramMethod, useAotCompilation, std::get<18>(req));
 
       TR_ASSERT_FATAL(TR::Compiler->persistentMemory() == compInfo->persistentMemory(), "per-client persistent memory must not be set at this point");
 
@@ -458,6 +493,20 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          || !unloadedClasses.empty())
          && !serverDetails->isJitDumpMethod(); // if this is a JitDump recompilation, ignore any critical updates
 
+      // When memory is very low, refuse the request before creating any session or per-compilation data.
+      // The error sent to the client carries the memory state, so the client backs off by reducing
+      // its number of active compilation threads. Critical requests must be processed to keep the
+      // session consistent, so they are allowed through and may fail later if memory runs out.
+      if (!isCriticalRequest
+          && !serverDetails->isJitDumpMethod()
+          && computeServerMemoryState(compInfo) == JITServer::ServerMemoryState::VERY_LOW)
+         {
+         if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompFailure, TR_VerboseJITServer, TR_VerbosePerformance))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d rejecting request seqNo=%u from clientUID=%llu because memory is very low",
+               getCompThreadId(), seqNo, (unsigned long long)clientId);
+         throw std::bad_alloc();
+         }
+
       if (useAotCompilation)
          {
          _vm = TR_J9VMBase::get(_jitConfig, compThread, TR_J9VMBase::J9_SHARED_CACHE_SERVER_VM);
@@ -490,6 +539,10 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          throw std::bad_alloc();
 
       setClientData(clientSession); // Cache the session data into CompilationInfoPerThreadRemote object
+      // A thread that took a requeued connection was already charged when it dequeued the entry
+      if (!getClientFairShare())
+         setClientFairShare(compInfo->acquireClientFairShare(clientId));
+      requestStartTime = compInfo->getPersistentInfo()->getElapsedTime();
 
       // After this line, all persistent allocations are made per-client,
       // until exitPerClientAllocationRegion is called
@@ -597,9 +650,19 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d will ask for address ranges of unloaded classes and CHTable for clientUID %llu",
                   getCompThreadId(), (unsigned long long)clientId);
 
-            stream->write(JITServer::MessageType::getUnloadedClassRangesAndCHTable, compInfo->getPersistentInfo()->getServerUID());
-            auto response = stream->read<std::vector<TR_AddressRange>, int32_t, std::string>();
-            // TODO: we could send JVM info that is global and does not change together with CHTable
+            // The VM info is global and does not change, so fetch it in the same round trip as the CHTable
+            // if this session does not have it yet
+            bool needVMInfo = !clientSession->hasVMInfo();
+            stream->addBatchedQuery(JITServer::MessageType::getUnloadedClassRangesAndCHTable, compInfo->getPersistentInfo()->getServerUID());
+            if (needVMInfo)
+               stream->addBatchedQuery(JITServer::MessageType::VM_getVMInfo, JITServer::Void());
+            stream->sendBatchedQueries();
+            auto response = stream->getBatchedReply<std::vector<TR_AddressRange>, int32_t, std::string>(0);
+            if (needVMInfo)
+               {
+               auto vmInfoResponse = stream->getBatchedReply<ClientSessionData::VMInfo, std::vector<ClientSessionData::CacheDescriptor>>(1);
+               clientSession->cacheVMInfo(std::get<0>(vmInfoResponse), std::get<1>(vmInfoResponse));
+               }
             auto &unloadedClassRanges = std::get<0>(response);
             auto maxRanges = std::get<1>(response);
             std::string &serializedCHTable = std::get<2>(response);
@@ -855,6 +918,14 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       releaseVMAccess(compThread);
       compInfo->decreaseQueueWeightBy(entry._weight);
 
+      if (getClientFairShare())
+         {
+         // If the read failed, the share charged at dequeue time is given back without charging any time
+         uint64_t compTimeMs = requestStartTime ? compInfo->getPersistentInfo()->getElapsedTime() - requestStartTime : 0;
+         compInfo->releaseClientFairShare(getClientFairShare(), compTimeMs);
+         setClientFairShare(NULL);
+         }
+
       // Put the request back into the pool
       setMethodBeingCompiled(NULL); // Must have the compQmonitor
 
@@ -878,6 +949,8 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          stream->~ServerStream();
          TR::Compiler->persistentGlobalAllocator().deallocate(stream);
          entry._stream = NULL;
+         // Nothing was requeued to wake a thread that skipped requests of this client because of the limit
+         compInfo->getCompilationMonitor()->notifyAll();
          }
 
       // Reset the pointer to the cached client session data
@@ -948,6 +1021,9 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
 
    TR_OptimizationPlan::freeOptimizationPlan(optPlan); // we no longer need the optimization plan
 
+   compInfo->releaseClientFairShare(getClientFairShare(), compInfo->getPersistentInfo()->getElapsedTime() - requestStartTime);
+   setClientFairShare(NULL);
+
    // Put the request back into the pool
    setMethodBeingCompiled(NULL);
 
@@ -966,6 +1042,8 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       stream->~ServerStream();
       TR::Compiler->persistentGlobalAllocator().deallocate(stream);
       entry._stream = NULL;
+      // Nothing was requeued to wake a thread that skipped requests of this client because of the limit
+      compInfo->getCompilationMonitor()->notifyAll();
       }
 
    compInfo->printQueue();
@@ -1382,6 +1460,36 @@ TR::CompilationInfoPerThreadRemote::clearPerCompilationCaches()
    clearPerCompilationCache(_fieldAttributesCache);
    clearPerCompilationCache(_staticAttributesCache);
    clearPerCompilationCache(_isUnresolvedStrCache);
+   _prefetchedCompilee = NULL;
+   _prefetchedCompileeInfo = TR_ResolvedJ9JITServerMethodInfo();
+   }
+
+void
+TR::CompilationInfoPerThreadRemote::setPrefetchedCompileeInfo(TR_OpaqueMethodBlock *method, bool isAOT, const TR_ResolvedJ9JITServerMethodInfo &methodInfo)
+   {
+   // The client does not prefetch the information if TR_DisableJITServerPrefetch is set
+   if (std::get<0>(methodInfo).remoteMirror)
+      {
+      _prefetchedCompilee = method;
+      _prefetchedCompileeIsAOT = isAOT;
+      _prefetchedCompileeInfo = methodInfo;
+      }
+   }
+
+/**
+ * @brief Retrieve the mirror information for the method being compiled that was sent with the compilation request.
+ *        The information can be consumed only once, because it describes a freshly created client-side mirror.
+ * @return true if information for the given method was available, false otherwise
+ */
+bool
+TR::CompilationInfoPerThreadRemote::getPrefetchedCompileeInfo(TR_OpaqueMethodBlock *method, bool isAOT, TR_ResolvedJ9JITServerMethodInfo &methodInfo)
+   {
+   if (!_prefetchedCompilee || (_prefetchedCompilee != method) || (_prefetchedCompileeIsAOT != isAOT))
+      return false;
+   methodInfo = _prefetchedCompileeInfo;
+   _prefetchedCompilee = NULL;
+   _prefetchedCompileeInfo = TR_ResolvedJ9JITServerMethodInfo();
+   return true;
    }
 
 /**
@@ -101,10 +101,17 @@ class CompilationInfoPerThreadRemote : public TR::CompilationInfoPerThread
    void cacheIsUnresolvedStr(TR_OpaqueClassBlock *ramClass, int32_t cpIndex, const TR_IsUnresolvedString &stringAttrs);
    bool getCachedIsUnresolvedStr(TR_OpaqueClassBlock *ramClass, int32_t cpIndex, TR_IsUnresolvedString &stringAttrs);
 
+   void setPrefetchedCompileeInfo(TR_OpaqueMethodBlock *method, bool isAOT, const TR_ResolvedJ9JITServerMethodInfo &methodInfo);
+   bool getPrefetchedCompileeInfo(TR_OpaqueMethodBlock *method, bool isAOT, TR_ResolvedJ9JITServerMethodInfo &methodInfo);
+
    void clearPerCompilationCaches();
    void deleteClientSessionData(uint64_t clientId, TR::CompilationInfo* compInfo, J9VMThread* compThread);
    virtual void freeAllResources() override;
 
+   // Share of the compilation threads of the client this thread is working for; NULL if not known yet
+   TR::CompilationInfo::ClientFairShare *getClientFairShare() const { return _clientFairShare; }
+   void setClientFairShare(TR::CompilationInfo::ClientFairShare *share) { _clientFairShare = share; }
+
    void incrementClassUnloadReadMutexDepth() { _classUnloadReadMutexDepth++; }
    void decrementClassUnloadReadMutexDepth() { _classUnloadReadMutexDepth--; }
    int32_t getClassUnloadReadMutexDepth() { return _classUnloadReadMutexDepth; }
@@ -179,6 +186,10 @@ class CompilationInfoPerThreadRemote : public TR::CompilationInfoPerThread
    FieldOrStaticAttrTable_t *_staticAttributesCache;
    UnorderedMap<std::pair<TR_OpaqueClassBlock *, int32_t>, TR_IsUnresolvedString> *_isUnresolvedStrCache;
    int32_t _classUnloadReadMutexDepth;
+   TR::CompilationInfo::ClientFairShare *_clientFairShare; // accessed with the compilation monitor in hand
+   TR_OpaqueMethodBlock *_prefetchedCompilee; // method whose mirror information was sent with the compilation request
+   bool _prefetchedCompileeIsAOT; // whether the prefetched mirror is relocatable
+   TR_ResolvedJ9JITServerMethodInfo _prefetchedCompileeInfo;
    static int32_t _numClearedCaches; //number of instances JITServer was forced to clear its internal per-client caches
 
    }; // class CompilationInfoPerThreadRemote
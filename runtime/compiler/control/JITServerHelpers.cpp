@@ -30,16 +30,19 @@
 #include "infra/Statistics.hpp"
 #include "net/CommunicationStream.hpp"
 #include "OMR/Bytes.hpp"// for OMR::alignNoCheck()
+#include "runtime/JITServerAOTDeserializer.hpp"
 #include "runtime/JITServerSharedROMClassCache.hpp"
 #include "romclasswalk.h"
 #include "util_api.h"// for allSlotsInROMClassDo()
 
 
 uint32_t     JITServerHelpers::serverMsgTypeCount[] = {};
-uint64_t     JITServerHelpers::_waitTimeMs = 1000;
 bool         JITServerHelpers::_serverAvailable = true;
 uint64_t     JITServerHelpers::_nextConnectionRetryTime = 0;
 TR::Monitor *JITServerHelpers::_clientStreamMonitor = NULL;
+JITServerHelpers::ServerEndpointState JITServerHelpers::_serverEndpoints[] = {};
+uint32_t     JITServerHelpers::_activeServerEndpoint = 0;
+uint64_t     JITServerHelpers::_lastServerEndpointSwitchTime = 0;
 
 
 // To ensure that the length fields in UTF8 strings appended at the end of the
@@ -451,6 +454,25 @@ JITServerHelpers::printJITServerMsgStats(J9JITConfig *jitConfig, TR::Compilation
       j9tty_printf(PORTLIB, "Total number of messages: %u\n", totalMsgCount);
 #endif // defined(MESSAGE_SIZE_STATS)
       }
+
+   bool headerPrinted = false;
+   for (int i = 0; i < JITServer::MessageType_MAXTYPE; ++i)
+      {
+      const JITServer::MessageCompressionStats &stats = JITServer::CommunicationStream::compressionStats[i];
+      if (stats._numCompressed == 0 && stats._numNotCompressible == 0)
+         continue;
+      if (!headerPrinted)
+         {
+         j9tty_printf(PORTLIB, "JITServer Message Compression Statistics (messages sent):\n");
+         j9tty_printf(PORTLIB, "Type# #compressed #notCompressible\tUncompressedBytes\tCompressedBytes\tRatio\tTypeName\n");
+         headerPrinted = true;
+         }
+      j9tty_printf(PORTLIB, "#%04d %11llu %16llu\t%17llu\t%15llu\t%5.2f\t%s\n", i,
+                   (unsigned long long)stats._numCompressed, (unsigned long long)stats._numNotCompressible,
+                   (unsigned long long)stats._uncompressedBytes, (unsigned long long)stats._compressedBytes,
+                   stats._compressedBytes ? (double)stats._uncompressedBytes / stats._compressedBytes : 0.0,
+                   JITServer::messageNames[i]);
+      }
    }
 
 void
@@ -910,17 +932,24 @@ JITServerHelpers::romMethodOfRamMethod(J9Method* method)
    }
 
 void
-JITServerHelpers::postStreamFailure(OMRPortLibrary *portLibrary, TR::CompilationInfo *compInfo)
+JITServerHelpers::postStreamFailure(OMRPortLibrary *portLibrary, TR::CompilationInfo *compInfo, uint32_t serverEndpoint)
    {
    OMR::CriticalSection postStreamFailure(getClientStreamMonitor());
 
    OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
    uint64_t current_time = omrtime_current_time_millis();
-   if (current_time >= _nextConnectionRetryTime)
+   ServerEndpointState &failedEndpoint = _serverEndpoints[serverEndpoint];
+   if (!failedEndpoint._waitTimeMs)
+      failedEndpoint._waitTimeMs = INITIAL_CONNECTION_RETRY_WAIT_MS;
+   if (current_time >= failedEndpoint._nextConnectionRetryTime)
       {
-      _waitTimeMs *= 2; // Exponential backoff
+      failedEndpoint._waitTimeMs *= 2; // Exponential backoff
       }
-   _nextConnectionRetryTime = current_time + _waitTimeMs;
+   failedEndpoint._nextConnectionRetryTime = current_time + failedEndpoint._waitTimeMs;
+
+   // A connection to a server we already moved away from does not affect the active server
+   if (serverEndpoint != _activeServerEndpoint)
+      return;
 
    if (_serverAvailable && TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseJITServerConns))
       {
@@ -931,6 +960,20 @@ JITServerHelpers::postStreamFailure(OMRPortLibrary *portLibrary, TR::Compilation
       compInfo->getPersistentInfo()->setServerUID(0);
       }
 
+   // Move to another server if one is not backing off; the compilation that failed
+   // will be retried remotely on that server instead of locally
+   if (_serverAvailable && switchServerEndpoint(compInfo, current_time, true))
+      return;
+
+   // No server is reachable. Retry the connection with the server whose backoff expires first.
+   uint32_t numEndpoints = compInfo->getPersistentInfo()->getNumJITServerEndpoints();
+   for (uint32_t i = 0; i < numEndpoints; ++i)
+      {
+      if (_serverEndpoints[i]._nextConnectionRetryTime < _serverEndpoints[_activeServerEndpoint]._nextConnectionRetryTime)
+         _activeServerEndpoint = i;
+      }
+   _nextConnectionRetryTime = _serverEndpoints[_activeServerEndpoint]._nextConnectionRetryTime;
+
    _serverAvailable = false;
 
    // Reset the activation policy flag in case we never reconnect to the server
@@ -946,10 +989,13 @@ JITServerHelpers::postStreamFailure(OMRPortLibrary *portLibrary, TR::Compilation
    }
 
 void
-JITServerHelpers::postStreamConnectionSuccess()
+JITServerHelpers::postStreamConnectionSuccess(uint32_t serverEndpoint)
    {
+   OMR::CriticalSection postStreamConnectionSuccess(getClientStreamMonitor());
+
+   _serverEndpoints[serverEndpoint]._waitTimeMs = INITIAL_CONNECTION_RETRY_WAIT_MS;
+   _serverEndpoints[serverEndpoint]._used = true;
    _serverAvailable = true;
-   _waitTimeMs = 1000;
    }
 
 bool
@@ -959,6 +1005,107 @@ JITServerHelpers::shouldRetryConnection(OMRPortLibrary *portLibrary)
    return omrtime_current_time_millis() > _nextConnectionRetryTime;
    }
 
+uint64_t
+JITServerHelpers::getServerEndpointScore(const ServerEndpointState &endpoint, uint64_t defaultResponseTimeMs)
+   {
+   // A server we have not compiled with yet is assumed to be as fast as the active one, but not loaded
+   uint64_t responseTimeMs = endpoint._numResponses ? endpoint._avgResponseTimeMs : defaultResponseTimeMs;
+   return (responseTimeMs + 1) * (endpoint._loadFactor ? endpoint._loadFactor : 1);
+   }
+
+bool
+JITServerHelpers::switchServerEndpoint(TR::CompilationInfo *compInfo, uint64_t currentTime, bool activeEndpointFailed)
+   {
+   // Must be called with the clientStreamMonitor held
+   const ServerEndpointState &active = _serverEndpoints[_activeServerEndpoint];
+   uint32_t numEndpoints = compInfo->getPersistentInfo()->getNumJITServerEndpoints();
+   uint32_t bestEndpoint = _activeServerEndpoint;
+   uint64_t bestScore = 0;
+   for (uint32_t i = 0; i < numEndpoints; ++i)
+      {
+      // Skip servers we failed to reach recently
+      if (i == _activeServerEndpoint || _serverEndpoints[i]._nextConnectionRetryTime > currentTime)
+         continue;
+      uint64_t score = getServerEndpointScore(_serverEndpoints[i], active._avgResponseTimeMs);
+      if (bestEndpoint == _activeServerEndpoint || score < bestScore)
+         {
+         bestEndpoint = i;
+         bestScore = score;
+         }
+      }
+   if (bestEndpoint == _activeServerEndpoint)
+      return false;
+   // Leaving a working server discards the caches it built for us, so only do it
+   // when the other server is expected to be at least twice as fast
+   if (!activeEndpointFailed && bestScore * 2 > getServerEndpointScore(active, active._avgResponseTimeMs))
+      return false;
+
+   TR::PersistentInfo *persistentInfo = compInfo->getPersistentInfo();
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseJITServerConns))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                                     "t=%6u Switching from server %s:%u to server %s:%u (%s)",
+                                     (uint32_t) persistentInfo->getElapsedTime(),
+                                     persistentInfo->getJITServerAddress(_activeServerEndpoint).c_str(),
+                                     persistentInfo->getJITServerPort(_activeServerEndpoint),
+                                     persistentInfo->getJITServerAddress(bestEndpoint).c_str(),
+                                     persistentInfo->getJITServerPort(bestEndpoint),
+                                     activeEndpointFailed ? "connection lost" : "server overloaded");
+      }
+
+   _activeServerEndpoint = bestEndpoint;
+   _lastServerEndpointSwitchTime = currentTime;
+   persistentInfo->setServerUID(0);
+   // The new server has not necessarily seen the ROMClasses sent to the previous one
+      {
+      OMR::CriticalSection romClassCache(compInfo->getclassesCachedAtServerMonitor());
+      compInfo->getclassesCachedAtServer().clear();
+      }
+   // AOT cache record IDs are specific to a server instance
+   if (auto deserializer = compInfo->getJITServerAOTDeserializer())
+      deserializer->reset();
+   return true;
+   }
+
+void
+JITServerHelpers::updateServerEndpointLoad(OMRPortLibrary *portLibrary, TR::CompilationInfo *compInfo, uint32_t serverEndpoint, uint64_t responseTimeMs,
+                                           JITServer::ServerMemoryState memoryState, JITServer::ServerActiveThreadsState activeThreadsState)
+   {
+   // With a single server there is nothing to choose from
+   if (compInfo->getPersistentInfo()->getNumJITServerEndpoints() <= 1)
+      return;
+
+   OMR::CriticalSection updateServerEndpointLoad(getClientStreamMonitor());
+
+   ServerEndpointState &endpoint = _serverEndpoints[serverEndpoint];
+   if (endpoint._numResponses)
+      endpoint._avgResponseTimeMs = (endpoint._avgResponseTimeMs * 7 + responseTimeMs) / 8;
+   else
+      endpoint._avgResponseTimeMs = responseTimeMs;
+   endpoint._numResponses++;
+
+   uint32_t loadFactor = 1;
+   if (memoryState == JITServer::ServerMemoryState::VERY_LOW)
+      loadFactor *= 4;
+   else if (memoryState == JITServer::ServerMemoryState::LOW)
+      loadFactor *= 2;
+   if (activeThreadsState == JITServer::ServerActiveThreadsState::VERY_HIGH_THREAD)
+      loadFactor *= 4;
+   else if (activeThreadsState == JITServer::ServerActiveThreadsState::HIGH_THREAD)
+      loadFactor *= 2;
+   endpoint._loadFactor = loadFactor;
+
+   // Only an overloaded server is left for a better one, and not too soon after we moved to it
+   OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+   uint64_t current_time = omrtime_current_time_millis();
+   if (serverEndpoint == _activeServerEndpoint &&
+       loadFactor > 1 &&
+       current_time - _lastServerEndpointSwitchTime >= MIN_SERVER_ENDPOINT_RESIDENCY_MS)
+      {
+      switchServerEndpoint(compInfo, current_time, false);
+      }
+   }
+
 bool
 JITServerHelpers::isAddressInROMClass(const void *address, const J9ROMClass *romClass)
    {
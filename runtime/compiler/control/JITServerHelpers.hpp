@@ -23,6 +23,7 @@
 #ifndef JITSERVER_HELPERS_H
 #define JITSERVER_HELPERS_H
 
+#include "env/PersistentInfo.hpp"
 #include "net/MessageTypes.hpp"
 #include "runtime/JITClientSession.hpp"
 
@@ -97,11 +98,22 @@ class JITServerHelpers
 
    // Functions used for allowing the client to compile locally when server is unavailable.
    // Should be used only on the client side.
-   static void postStreamFailure(OMRPortLibrary *portLibrary, TR::CompilationInfo *compInfo);
+   static void postStreamFailure(OMRPortLibrary *portLibrary, TR::CompilationInfo *compInfo, uint32_t serverEndpoint);
    static bool shouldRetryConnection(OMRPortLibrary *portLibrary);
-   static void postStreamConnectionSuccess();
+   static void postStreamConnectionSuccess(uint32_t serverEndpoint);
    static bool isServerAvailable() { return _serverAvailable; }
 
+   // Functions used for choosing among the servers given with -XX:JITServerAddress.
+   // All remote compilations go to a single active server: the per-client caches of a server
+   // (ROMClasses, CHTable, AOT cache records) are only useful if consecutive requests reach it.
+   // The client moves to another server when the active one fails, which keeps compilations
+   // remote as long as any server is reachable, or when the active one reports it is overloaded.
+   // Should be used only on the client side.
+   static uint32_t getActiveServerEndpoint() { return _activeServerEndpoint; }
+   static bool wasServerEndpointUsed(uint32_t serverEndpoint) { return _serverEndpoints[serverEndpoint]._used; }
+   static void updateServerEndpointLoad(OMRPortLibrary *portLibrary, TR::CompilationInfo *compInfo, uint32_t serverEndpoint, uint64_t responseTimeMs,
+                                        JITServer::ServerMemoryState memoryState, JITServer::ServerActiveThreadsState activeThreadsState);
+
    static void printJITServerMsgStats(J9JITConfig *, TR::CompilationInfo *);
    static void printJITServerCHTableStats(J9JITConfig *, TR::CompilationInfo *);
    static void printJITServerCacheStats(J9JITConfig *, TR::CompilationInfo *);
@@ -121,10 +133,28 @@ class JITServerHelpers
       return _clientStreamMonitor;
       }
 
-   static uint64_t _waitTimeMs;
+   struct ServerEndpointState
+      {
+      uint64_t _waitTimeMs; // backoff before the next connection attempt; 0 until the first failure
+      uint64_t _nextConnectionRetryTime;
+      uint64_t _avgResponseTimeMs; // moving average of the duration of successful remote compilations
+      uint32_t _numResponses;
+      uint32_t _loadFactor; // 1 for a server with enough memory and threads, higher when the server reports pressure
+      bool _used; // the client connected to this server, so the server may hold a session for it
+      };
+
+   static uint64_t getServerEndpointScore(const ServerEndpointState &endpoint, uint64_t defaultResponseTimeMs);
+   static bool switchServerEndpoint(TR::CompilationInfo *compInfo, uint64_t currentTime, bool activeEndpointFailed);
+
+   static const uint64_t INITIAL_CONNECTION_RETRY_WAIT_MS = 1000;
+   static const uint64_t MIN_SERVER_ENDPOINT_RESIDENCY_MS = 30000; // (ms) do not leave a working server sooner than this
+
    static uint64_t _nextConnectionRetryTime;
    static bool _serverAvailable;
    static TR::Monitor * _clientStreamMonitor;
+   static ServerEndpointState _serverEndpoints[TR::PersistentInfo::MAX_JITSERVER_ENDPOINTS];
+   static uint32_t _activeServerEndpoint;
+   static uint64_t _lastServerEndpointSwitchTime;
    }; // class JITServerHelpers
 
 #endif // defined(JITSERVER_HELPERS_H)
@@ -57,6 +57,9 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails & details, v
    _methodDetails = TR::IlGeneratorMethodDetails::clone(_methodDetailsStorage, details);
    _optimizationPlan = optimizationPlan;
    _next = NULL;
+   _prev = NULL;
+   _nextInIndex = NULL;
+   _indexedMethod = NULL;
    _oldStartPC = oldStartPC;
    _newStartPC = NULL;
    _priority = p;
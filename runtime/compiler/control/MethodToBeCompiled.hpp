@@ -92,6 +92,9 @@ struct TR_MethodToBeCompiled
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    TR_MethodToBeCompiled *_next;
+   TR_MethodToBeCompiled *_prev;        // only maintained while the entry is in the main compilation queue
+   TR_MethodToBeCompiled *_nextInIndex; // chaining in the J9Method index of the main compilation queue
+   J9Method              *_indexedMethod; // J9Method the entry was indexed under when queued; NULL if not indexed
    TR::IlGeneratorMethodDetails _methodDetailsStorage;
    TR::IlGeneratorMethodDetails *_methodDetails;
    void                  *_oldStartPC;
@@ -120,6 +120,7 @@
 #include "runtime/JITServerAOTDeserializer.hpp"
 #include "runtime/JITServerIProfiler.hpp"
 #include "runtime/JITServerSharedROMClassCache.hpp"
+#include "runtime/JITServerSharedProfileCache.hpp"
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/Listener.hpp"
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -1715,13 +1716,16 @@ onLoadInternal(
       {
       bool shareROMClasses = TR::Options::_shareROMClasses &&
                              (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER);
+      bool shareProfiles = TR::Options::_shareProfiles &&
+                           (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER);
       bool useAOTCache = compInfo->getPersistentInfo()->getJITServerUseAOTCache();
 
-      // ROMClass sharing and AOT cache use a hash implementation from SSL.
+      // ROMClass sharing, profile sharing and AOT cache use a hash implementation from SSL.
       // Disable them (with an error message to vlog) if we can't load the library.
-      if ((shareROMClasses || useAOTCache) && !JITServer::loadLibsslAndFindSymbols())
+      if ((shareROMClasses || shareProfiles || useAOTCache) && !JITServer::loadLibsslAndFindSymbols())
          {
          TR::Options::_shareROMClasses = false;
+         TR::Options::_shareProfiles = false;
          compInfo->getPersistentInfo()->setJITServerUseAOTCache(false);
 
          if (TR::Options::getVerboseOption(TR_VerboseJITServer))
@@ -1729,6 +1733,9 @@ onLoadInternal(
             if (shareROMClasses)
                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                                               "ERROR: Failed to load SSL library, disabling ROMClass sharing");
+            if (shareProfiles)
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                                              "ERROR: Failed to load SSL library, disabling profile sharing");
             if (useAOTCache)
                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                                               "ERROR: Failed to load SSL library, disabling AOT cache");
@@ -1775,6 +1782,15 @@ onLoadInternal(
          compInfo->setJITServerSharedROMClassCache(cache);
          }
 
+      //NOTE: This must be done only after the SSL library has been successfully loaded
+      if (TR::Options::_shareProfiles)
+         {
+         auto cache = new (PERSISTENT_NEW) JITServerSharedProfileCache();
+         if (!cache)
+            return -1;
+         compInfo->setJITServerSharedProfileCache(cache);
+         }
+
       //NOTE: This must be done only after the SSL library has been successfully loaded
       if (compInfo->getPersistentInfo()->getJITServerUseAOTCache())
          {
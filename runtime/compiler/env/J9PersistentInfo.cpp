@@ -22,7 +22,10 @@
 #include "j9cfg.h" // for J9VM_OPT_JITSERVER
 #include "env/PersistentInfo.hpp"
 #if defined(J9VM_OPT_JITSERVER)
+#include <stdlib.h>
 #include "control/CompilationThread.hpp"
+#include "control/Options.hpp"
+#include "env/VerboseLog.hpp"
 #include "runtime/JITClientSession.hpp"
 
 
@@ -51,3 +54,50 @@ J9::PersistentInfo::setPersistentCHTable(TR_PersistentCHTable *table)
 #endif
    _persistentCHTable = table;
    }
+
+#if defined(J9VM_OPT_JITSERVER)
+void
+J9::PersistentInfo::setJITServerAddress(char *addr)
+   {
+   _JITServerAddresses.clear();
+   _JITServerEndpointPorts.clear();
+   std::string list(addr);
+   size_t start = 0;
+   while (start <= list.size())
+      {
+      size_t end = list.find(',', start);
+      if (end == std::string::npos)
+         end = list.size();
+      std::string entry = list.substr(start, end - start);
+      start = end + 1;
+      if (entry.empty())
+         continue;
+
+      if (_JITServerAddresses.size() >= MAX_JITSERVER_ENDPOINTS)
+         {
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Ignoring server %s: at most %u servers can be specified",
+                                           entry.c_str(), MAX_JITSERVER_ENDPOINTS);
+         continue;
+         }
+
+      // An optional port follows the last ':'; IPv6 addresses contain more than one ':' and cannot specify a port
+      uint32_t port = 0;
+      size_t colon = entry.find(':');
+      if (colon != std::string::npos && colon == entry.rfind(':') && colon + 1 < entry.size() &&
+          entry.find_first_not_of("0123456789", colon + 1) == std::string::npos)
+         {
+         port = (uint32_t)strtoul(entry.c_str() + colon + 1, NULL, 10);
+         entry.resize(colon);
+         }
+      _JITServerAddresses.push_back(entry);
+      _JITServerEndpointPorts.push_back(port);
+      }
+
+   if (_JITServerAddresses.empty())
+      {
+      _JITServerAddresses.push_back("localhost");
+      _JITServerEndpointPorts.push_back(0);
+      }
+   }
+#endif /* defined(J9VM_OPT_JITSERVER) */
@@ -35,6 +35,7 @@ namespace J9 { typedef J9::PersistentInfo PersistentInfoConnector; }
 #include <stdint.h>
 #if defined(J9VM_OPT_JITSERVER)
 #include <string>
+#include <vector>
 #endif /* defined(J9VM_OPT_JITSERVER) */
 #include "env/jittypes.h"
 
@@ -159,11 +160,16 @@ class PersistentInfo : public OMR::PersistentInfoConnector
          _runtimeInstrumentationEnabled(false),
          _runtimeInstrumentationRecompilationEnabled(false),
 #if defined(J9VM_OPT_JITSERVER)
-         _JITServerAddress("localhost"),
+         _JITServerAddresses(1, std::string("localhost")),
+         _JITServerEndpointPorts(1, 0),
          _JITServerPort(38400),
          _socketTimeoutMs(2000),
          _clientUID(0),
          _JITServerUseAOTCache(false),
+         _JITServerAOTCachePersistence(false),
+         _JITServerUseCompression(false),
+         _JITServerCompressionThreshold(4096),
+         _JITServerUseSharedMemory(false),
          _requireJITServer(false),
          _localSyncCompiles(false),
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -331,8 +337,16 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    static JITServer::RemoteCompilationModes _remoteCompilationMode; // JITServer::NONE, JITServer::CLIENT, JITServer::SERVER
 
    static JITServer::RemoteCompilationModes getRemoteCompilationMode() { return _remoteCompilationMode; }
-   const std::string &getJITServerAddress() const { return _JITServerAddress; }
-   void setJITServerAddress(char *addr) { _JITServerAddress = addr; }
+   static const uint32_t MAX_JITSERVER_ENDPOINTS = 8;
+   /**
+    * @brief Set the list of servers the client can connect to
+    * @param addr Comma separated list of "host" or "host:port" entries, in order of preference;
+    *             entries without a port use the port given by -XX:JITServerPort
+    */
+   void setJITServerAddress(char *addr);
+   uint32_t getNumJITServerEndpoints() const { return (uint32_t)_JITServerAddresses.size(); }
+   const std::string &getJITServerAddress(uint32_t endpoint = 0) const { return _JITServerAddresses[endpoint]; }
+   uint32_t getJITServerPort(uint32_t endpoint) const { return _JITServerEndpointPorts[endpoint] ? _JITServerEndpointPorts[endpoint] : _JITServerPort; }
    uint32_t getSocketTimeout() const { return _socketTimeoutMs; }
    void setSocketTimeout(uint32_t t) { _socketTimeoutMs = t; }
    uint32_t getJITServerPort() const { return _JITServerPort; }
@@ -343,6 +357,18 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    void setServerUID(uint64_t val) { _serverUID = val; }
    bool getJITServerUseAOTCache() const { return _JITServerUseAOTCache; }
    void setJITServerUseAOTCache(bool use) { _JITServerUseAOTCache = use; }
+   bool getJITServerAOTCachePersistence() const { return _JITServerAOTCachePersistence; }
+   void setJITServerAOTCachePersistence(bool persist) { _JITServerAOTCachePersistence = persist; }
+   const std::string &getJITServerAOTCacheDir() const { return _JITServerAOTCacheDir; }
+   void setJITServerAOTCacheDir(const char *dir) { _JITServerAOTCacheDir = dir; }
+   bool getJITServerUseCompression() const { return _JITServerUseCompression; }
+   void setJITServerUseCompression(bool use) { _JITServerUseCompression = use; }
+   uint32_t getJITServerCompressionThreshold() const { return _JITServerCompressionThreshold; }
+   void setJITServerCompressionThreshold(uint32_t threshold) { _JITServerCompressionThreshold = threshold; }
+   bool getJITServerUseSharedMemory() const { return _JITServerUseSharedMemory; }
+   void setJITServerUseSharedMemory(bool use) { _JITServerUseSharedMemory = use; }
+   const std::string &getJITServerSharedMemorySocketPath() const { return _JITServerSharedMemorySocketPath; }
+   void setJITServerSharedMemorySocketPath(const char *path) { _JITServerSharedMemorySocketPath = path; }
    bool getRequireJITServer() const { return _requireJITServer; }
    void setRequireJITServer(bool requireJITServer) { _requireJITServer = requireJITServer; }
    bool isLocalSyncCompiles() const { return _localSyncCompiles; }
@@ -432,12 +458,19 @@ class PersistentInfo : public OMR::PersistentInfoConnector
 
    int32_t _numLoadedClasses; ///< always increasing
 #if defined(J9VM_OPT_JITSERVER)
-   std::string _JITServerAddress;
+   std::vector<std::string> _JITServerAddresses; // at the client, all the servers that can be used, in order of preference
+   std::vector<uint32_t> _JITServerEndpointPorts; // 0 for servers listening on the default _JITServerPort
    uint32_t    _JITServerPort;
    uint32_t    _socketTimeoutMs; // timeout for communication sockets used in out-of-process JIT compilation
    uint64_t    _clientUID;
    uint64_t    _serverUID; // At the client, this represents the UID of the server the client is connected to
    bool        _JITServerUseAOTCache;
+   bool        _JITServerAOTCachePersistence; // save AOT caches to snapshot files and load them on restart
+   std::string _JITServerAOTCacheDir; // directory for AOT cache snapshot files
+   bool        _JITServerUseCompression; // compress large messages if the other party agrees
+   uint32_t    _JITServerCompressionThreshold; // messages smaller than this (bytes) are never compressed
+   bool        _JITServerUseSharedMemory; // use shared memory for connections between processes on the same host
+   std::string _JITServerSharedMemorySocketPath; // Unix domain socket used to set up shared memory connections
    bool        _requireJITServer;
    bool        _localSyncCompiles;
 #endif /* defined(J9VM_OPT_JITSERVER) */
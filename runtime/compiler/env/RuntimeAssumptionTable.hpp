@@ -124,6 +124,9 @@ class TR_RuntimeAssumptionTable
 
    int32_t countRatAssumptions();
 
+   /// Number of assumptions marked for detach and still waiting to be reclaimed
+   uint32_t getMarkedAssumptionCount() const { return _marked; }
+
    private:
    friend class OMR::RuntimeAssumption;
    void addAssumption(OMR::RuntimeAssumption *a, TR_RuntimeAssumptionKind kind, TR_FrontEnd *fe, OMR::RuntimeAssumption **sentinel);
@@ -5502,7 +5502,12 @@ TR_J9VMBase::getDesignatedCodeCache(TR::Compilation *comp) // MCT
    bool hadClassUnloadMonitor;
    bool hadVMAccess = releaseClassUnloadMonitorAndAcquireVMaccessIfNeeded(comp, &hadClassUnloadMonitor);
 
-   TR::CodeCache * result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   TR::CodeCache * result = NULL;
+   // Hot and scorching bodies go to a dedicated code cache; the sampling thread drives methods to these levels
+   if (comp && comp->getMethodHotness() >= hot && !comp->compileRelocatableCode())
+      result = TR::CodeCacheManager::instance()->reserveHotCodeCache(compThreadID);
+   if (!result)
+      result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
 
    acquireClassUnloadMonitorAndReleaseVMAccessIfNeeded(comp, hadVMAccess, hadClassUnloadMonitor);
    if (!result)
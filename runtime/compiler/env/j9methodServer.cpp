@@ -71,10 +71,16 @@ TR_ResolvedJ9JITServerMethod::TR_ResolvedJ9JITServerMethod(TR_OpaqueMethodBlock
    // Create client side mirror of this object to use for calls involving RAM data
    TR_ResolvedJ9Method* owningMethodMirror = owningMethod ? ((TR_ResolvedJ9JITServerMethod*) owningMethod)->_remoteMirror : NULL;
 
-   // If in AOT mode, will actually create relocatable version of resolved method on the client
-   _stream->write(JITServer::MessageType::mirrorResolvedJ9Method, aMethod, owningMethodMirror, vTableSlot, fej9->isAOT_DEPRECATED_DO_NOT_USE());
-   auto recv = _stream->read<TR_ResolvedJ9JITServerMethodInfo>();
-   auto &methodInfo = std::get<0>(recv);
+   // The client sends the mirror of the method being compiled together with the compilation request
+   TR_ResolvedJ9JITServerMethodInfo methodInfo;
+   if (owningMethod || vTableSlot ||
+       !static_cast<TR::CompilationInfoPerThreadRemote *>(threadCompInfo)->getPrefetchedCompileeInfo(aMethod, fej9->isAOT_DEPRECATED_DO_NOT_USE(), methodInfo))
+      {
+      // If in AOT mode, will actually create relocatable version of resolved method on the client
+      _stream->write(JITServer::MessageType::mirrorResolvedJ9Method, aMethod, owningMethodMirror, vTableSlot, fej9->isAOT_DEPRECATED_DO_NOT_USE());
+      auto recv = _stream->read<TR_ResolvedJ9JITServerMethodInfo>();
+      methodInfo = std::get<0>(recv);
+      }
 
    unpackMethodInfo(aMethod, fe, trMemory, vTableSlot, threadCompInfo, methodInfo);
    }
@@ -43,6 +43,36 @@ J9::ResolvedMethodSymbol::ResolvedMethodSymbol(TR_ResolvedMethod *method, TR::Co
          self()->setCanReplaceWithHWInstr(true);
          }
       }
+   else if (comp->target().cpu.isX86())
+      {
+      switch (method->getRecognizedMethod())
+         {
+         case TR::java_lang_Math_floor:
+         case TR::java_lang_StrictMath_floor:
+         case TR::java_lang_Math_ceil:
+         case TR::java_lang_StrictMath_ceil:
+            // roundsd
+            if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSE4_1))
+               self()->setCanReplaceWithHWInstr(true);
+            break;
+         case TR::java_lang_Math_copySign_F:
+         case TR::java_lang_Math_copySign_D:
+            // StrictMath copySign treats a NaN sign as positive, which a bitwise copy of the sign does not
+            self()->setCanReplaceWithHWInstr(true);
+            break;
+         case TR::java_lang_Math_fma_D:
+         case TR::java_lang_Math_fma_F:
+         case TR::java_lang_StrictMath_fma_D:
+         case TR::java_lang_StrictMath_fma_F:
+            // vfmadd231sd/vfmadd231ss are VEX encoded
+            if (comp->target().cpu.supportsFeature(OMR_FEATURE_X86_FMA) &&
+                comp->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX))
+               self()->setCanReplaceWithHWInstr(true);
+            break;
+         default:
+            break;
+         }
+      }
 
    if (method->isJNINative())
       {
@@ -49,6 +49,11 @@ uint64_t ClientStream::_incompatibleStartTime = 0;
 const uint64_t ClientStream::RETRY_COMPATIBILITY_INTERVAL_MS = 10000; //ms
 const int ClientStream::INCOMPATIBILITY_COUNT_LIMIT = 5;
 
+// used for falling back to TCP when a shared memory connection cannot be established
+uint64_t ClientStream::_sharedMemoryFailureTime = 0;
+bool ClientStream::_sharedMemoryFailed = false;
+const uint64_t ClientStream::SHARED_MEMORY_RETRY_INTERVAL_MS = 10000; //ms
+
 // Create SSL context, load certs and keys. Only needs to be done once.
 // This is called during startup from rossa.cpp
 int ClientStream::static_init(TR::PersistentInfo *info)
@@ -267,12 +272,38 @@ BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
    return bio;
    }
 
-ClientStream::ClientStream(TR::PersistentInfo *info)
-   : CommunicationStream(), _versionCheckStatus(NOT_DONE)
+ClientStream::ClientStream(TR::PersistentInfo *info, uint32_t serverEndpoint)
+   : CommunicationStream(), _versionCheckStatus(NOT_DONE), _compressionRequested(info->getJITServerUseCompression()),
+     _batchedReplies(NULL), _serverEndpoint(serverEndpoint)
    {
-   int connfd = openConnection(info->getJITServerAddress(), info->getJITServerPort(), info->getSocketTimeout());
-   BIO *ssl = openSSLConnection(_sslCtx, connfd);
-   initStream(connfd, ssl);
+   int connfd = -1;
+   SharedMemoryChannel *sharedMemory = NULL;
+   // Encrypted connections always use TCP
+   if (info->getJITServerUseSharedMemory() && !_sslCtx && (serverEndpoint == 0) &&
+       (!_sharedMemoryFailed || ((info->getElapsedTime() - _sharedMemoryFailureTime) > SHARED_MEMORY_RETRY_INTERVAL_MS)))
+      {
+      try
+         {
+         sharedMemory = SharedMemoryChannel::connect(info->getJITServerSharedMemorySocketPath(), info->getSocketTimeout(), connfd);
+         _sharedMemoryFailed = false;
+         }
+      catch (const StreamFailure &e)
+         {
+         // The server is not running on this host or does not accept shared memory connections
+         if (TR::Options::getVerboseOption(TR_VerboseJITServerConns))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Cannot use shared memory transport (%s), falling back to TCP", e.what());
+         _sharedMemoryFailureTime = info->getElapsedTime();
+         _sharedMemoryFailed = true;
+         }
+      }
+
+   BIO *ssl = NULL;
+   if (!sharedMemory)
+      {
+      connfd = openConnection(info->getJITServerAddress(serverEndpoint), info->getJITServerPort(serverEndpoint), info->getSocketTimeout());
+      ssl = openSSLConnection(_sslCtx, connfd);
+      }
+   initStream(connfd, ssl, sharedMemory);
    _numConnectionsOpened++;
    }
 };
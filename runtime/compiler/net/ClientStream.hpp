@@ -27,6 +27,7 @@
 #include "ilgen/J9IlGeneratorMethodDetails.hpp"
 #include "net/RawTypeConvert.hpp"
 #include "net/CommunicationStream.hpp"
+#include "control/Options.hpp"
 
 class SSLOutputStream;
 class SSLInputStream;
@@ -69,7 +70,12 @@ public:
    */
    static int static_init(TR::PersistentInfo *info);
 
-   explicit ClientStream(TR::PersistentInfo *info);
+   /**
+      @brief Connect to one of the servers given with -XX:JITServerAddress
+
+      @param [in] serverEndpoint Index of the server in the list; shared memory is only tried for the first one
+   */
+   explicit ClientStream(TR::PersistentInfo *info, uint32_t serverEndpoint = 0);
    virtual ~ClientStream()
       {
       _numConnectionsClosed++;
@@ -79,14 +85,15 @@ public:
       @brief Send a compilation request to the JITServer
 
       As a side-effect, this function may also embed version information in the message
-      if this is the first message sent after a connection request.
+      if this is the first message sent after a connection request. The version information
+      also carries the request to compress large messages on this connection, if enabled.
    */
    template <typename... T>
    void buildCompileRequest(T... args)
       {
       if (getVersionCheckStatus() == NOT_DONE)
          {
-         _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS);
+         _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS | (_compressionRequested ? JITServerCompression : 0));
          write(MessageType::compilationRequest, args...);
          _cMsg.clearFullVersion();
          }
@@ -109,7 +116,35 @@ public:
       _cMsg.setType(type);
       setArgsRaw<T...>(_cMsg, args...);
 
-      writeMessage(_cMsg);
+      if (_batchedReplies)
+         _batchedReplies->push_back(serializeToString(_cMsg));
+      else
+         writeMessage(_cMsg);
+      }
+
+   /**
+      @brief Load a query from a batch sent by the server, so that it can be handled like a regular message
+
+      Until endBatchedQuery() is called, the reply written for the query is appended to
+      `replies` instead of being sent to the server.
+
+      @param [in] query Serialized query extracted from a `batchedQueries` message
+      @param [out] replies Collects the serialized replies to all the queries in the batch
+
+      @return Returns the type of the query
+   */
+   MessageType beginBatchedQuery(const std::string &query, std::vector<std::string> *replies)
+      {
+      deserializeFromString(_sMsg, query);
+      if (!isBatchableQuery(_sMsg.type()))
+         throw StreamMessageTypeMismatch(MessageType::batchedQueries, _sMsg.type());
+      _batchedReplies = replies;
+      return _sMsg.type();
+      }
+
+   void endBatchedQuery()
+      {
+      _batchedReplies = NULL;
       }
 
    /**
@@ -122,6 +157,13 @@ public:
    MessageType read()
       {
       readMessage(_sMsg);
+      // The server acknowledges our request for compression by flagging its messages
+      if (_compressionRequested && !isCompressionEnabled() && (_sMsg.getMetaData()->_config & JITServerCompression))
+         {
+         enableCompression();
+         if (TR::Options::getVerboseOption(TR_VerboseJITServerConns))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Server accepted to compress messages on this connection");
+         }
       return _sMsg.type();
       }
 
@@ -154,6 +196,8 @@ public:
       writeMessage(_cMsg);
       }
 
+   uint32_t getServerEndpoint() const { return _serverEndpoint; }
+
    VersionCheckStatus getVersionCheckStatus()
       {
       return _versionCheckStatus;
@@ -207,10 +251,16 @@ private:
    static int _numConnectionsOpened;
    static int _numConnectionsClosed;
    VersionCheckStatus _versionCheckStatus; // indicates whether a version checking has been performed
+   const bool _compressionRequested; // whether we ask the server to compress large messages
+   std::vector<std::string> *_batchedReplies; // not NULL while answering a query from a batch
+   const uint32_t _serverEndpoint; // index of the server this stream is connected to
    static int _incompatibilityCount;
    static uint64_t _incompatibleStartTime; // Time when version incomptibility has been detected
    static const uint64_t RETRY_COMPATIBILITY_INTERVAL_MS; // (ms) When we should perform again a version compatibilty check
    static const int INCOMPATIBILITY_COUNT_LIMIT;
+   static uint64_t _sharedMemoryFailureTime; // Elapsed time when a shared memory connection last failed
+   static bool _sharedMemoryFailed;
+   static const uint64_t SHARED_MEMORY_RETRY_INTERVAL_MS; // (ms) When we should try again to use shared memory
 
    static SSL_CTX *_sslCtx;
    };
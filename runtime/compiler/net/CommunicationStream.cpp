@@ -24,6 +24,8 @@
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
 #include "net/CommunicationStream.hpp"
+#include <cstring>
+#include "zlib.h"
 
 
 namespace JITServer
@@ -32,6 +34,7 @@ uint32_t CommunicationStream::CONFIGURATION_FLAGS = 0;
 #ifdef MESSAGE_SIZE_STATS
 TR_Stats JITServer::CommunicationStream::collectMsgStat[];
 #endif
+MessageCompressionStats CommunicationStream::compressionStats[];
 
 void
 CommunicationStream::initConfigurationFlags()
@@ -60,22 +63,143 @@ void CommunicationStream::initSSL()
    // OpenSSL_add_ssl_algorithms();
    }
 
+void
+CommunicationStream::enableCompression()
+   {
+   _compressionThreshold = TR::CompilationInfo::get()->getPersistentInfo()->getJITServerCompressionThreshold();
+   _compressionEnabled = true;
+   }
+
+char *
+CommunicationStream::getCompressionBuffer(uint32_t requiredSize)
+   {
+   if (requiredSize > _compressionBufferCapacity)
+      {
+      TR::PersistentAllocator &allocator = TR::Compiler->persistentGlobalAllocator();
+      if (_compressionBuffer)
+         {
+         allocator.deallocate(_compressionBuffer);
+         _compressionBuffer = NULL;
+         _compressionBufferCapacity = 0;
+         }
+      _compressionBuffer = static_cast<char *>(allocator.allocate(requiredSize));
+      if (!_compressionBuffer)
+         throw std::bad_alloc();
+      _compressionBufferCapacity = requiredSize;
+      }
+   return _compressionBuffer;
+   }
+
+uint32_t
+CommunicationStream::compressMessage(const char *serialMsg, uint32_t serializedSize)
+   {
+   // Only keep the compressed version if it is smaller than the original message,
+   // so the output never needs more space than the original size
+   char *frame = getCompressionBuffer(serializedSize);
+   uLongf compressedSize = serializedSize - COMPRESSED_FRAME_HEADER_SIZE;
+   int ret = compress2((Bytef *)(frame + COMPRESSED_FRAME_HEADER_SIZE), &compressedSize,
+                       (const Bytef *)(serialMsg + sizeof(uint32_t)), serializedSize - sizeof(uint32_t), Z_BEST_SPEED);
+   if (ret != Z_OK)
+      return 0; // Z_BUF_ERROR: the message is not compressible enough
+
+   uint32_t frameSize = COMPRESSED_FRAME_HEADER_SIZE + compressedSize;
+   ((uint32_t *)frame)[0] = frameSize | COMPRESSED_FRAME_FLAG;
+   ((uint32_t *)frame)[1] = serializedSize;
+   return frameSize;
+   }
+
+uint32_t
+CommunicationStream::decompressMessage(Message &msg, uint32_t frameSize)
+   {
+   if (frameSize < COMPRESSED_FRAME_HEADER_SIZE)
+      throw JITServer::StreamFailure("JITServer I/O error: invalid compressed message size");
+
+   // Move the compressed data out of the message buffer, which will receive the original message
+   char *frame = msg.getBufferStartForRead();
+   uint32_t serializedSize = ((uint32_t *)frame)[1];
+   uint32_t compressedSize = frameSize - COMPRESSED_FRAME_HEADER_SIZE;
+   char *compressedData = getCompressionBuffer(compressedSize);
+   memcpy(compressedData, frame + COMPRESSED_FRAME_HEADER_SIZE, compressedSize);
+
+   if (serializedSize < sizeof(uint32_t))
+      throw JITServer::StreamFailure("JITServer I/O error: invalid decompressed message size");
+   // The buffer is empty at this point, so nothing is copied if it gets expanded
+   msg.expandBufferIfNeeded(serializedSize);
+   char *buffer = msg.getBufferStartForRead();
+
+   uLongf uncompressedSize = serializedSize - sizeof(uint32_t);
+   int ret = uncompress((Bytef *)(buffer + sizeof(uint32_t)), &uncompressedSize, (const Bytef *)compressedData, compressedSize);
+   if ((ret != Z_OK) || (uncompressedSize != serializedSize - sizeof(uint32_t)))
+      throw JITServer::StreamFailure("JITServer I/O error: failed to decompress message");
+
+   return serializedSize;
+   }
+
+std::string
+CommunicationStream::serializeToString(Message &msg)
+   {
+   char *serialMsg = msg.serialize();
+   std::string str(serialMsg, msg.serializedSize());
+   msg.clearForWrite();
+   return str;
+   }
+
+void
+CommunicationStream::deserializeFromString(Message &msg, const std::string &serializedMsg)
+   {
+   uint32_t serializedSize = serializedMsg.size();
+   if ((serializedSize < sizeof(uint32_t) + sizeof(Message::MetaData)) || (serializedSize != ((const uint32_t *)serializedMsg.data())[0]))
+      throw JITServer::StreamFailure("JITServer I/O error: invalid batched message");
+
+   msg.clearForRead();
+   // The buffer is empty, so nothing is copied if it gets expanded
+   msg.expandBufferIfNeeded(serializedSize);
+   memcpy(msg.getBufferStartForRead(), serializedMsg.data(), serializedSize);
+   msg.setSerializedSize(serializedSize);
+   msg.deserialize();
+   }
+
+bool
+CommunicationStream::isBatchableQuery(MessageType type)
+   {
+   switch (type)
+      {
+      case MessageType::getUnloadedClassRangesAndCHTable:
+      case MessageType::VM_getVMInfo:
+      case MessageType::VM_isClassLibraryClass:
+      case MessageType::VM_isClassLibraryMethod:
+      case MessageType::VM_isMethodTracingEnabled:
+      case MessageType::VM_getClassClassPointer:
+      case MessageType::VM_getClassOfMethod:
+      case MessageType::VM_getSystemClassFromClassName:
+         return true;
+      default:
+         return false;
+      }
+   }
+
 void
 CommunicationStream::readMessage2(Message &msg)
    {
    msg.clearForRead();
 
    // read message size
-   uint32_t serializedSize;
-   readBlocking(serializedSize);
+   uint32_t frameSize;
+   readBlocking(frameSize);
+   bool isCompressed = (frameSize & COMPRESSED_FRAME_FLAG) != 0;
+   frameSize &= ~COMPRESSED_FRAME_FLAG;
+   if (frameSize < sizeof(uint32_t))
+      throw JITServer::StreamFailure("JITServer I/O error: invalid message size");
 
-   msg.expandBufferIfNeeded(serializedSize);
-   msg.setSerializedSize(serializedSize);
+   msg.expandBufferIfNeeded(frameSize);
 
    // read the rest of the message
-   uint32_t messageSize = serializedSize - sizeof(uint32_t);
+   uint32_t messageSize = frameSize - sizeof(uint32_t);
    readBlocking(msg.getBufferStartForRead() + sizeof(uint32_t), messageSize);
 
+   uint32_t serializedSize = isCompressed ? decompressMessage(msg, frameSize) : frameSize;
+   msg.setSerializedSize(serializedSize);
+
    // rebuild the message
    msg.deserialize();
 
@@ -105,21 +229,23 @@ CommunicationStream::readMessage(Message &msg)
       }
 
    // bytesRead >= sizeof(uint32_t)
-   uint32_t serializedSize = ((uint32_t *)buffer)[0];
-   if (bytesRead > serializedSize)
+   uint32_t frameSize = ((uint32_t *)buffer)[0];
+   bool isCompressed = (frameSize & COMPRESSED_FRAME_FLAG) != 0;
+   frameSize &= ~COMPRESSED_FRAME_FLAG;
+   if (bytesRead > frameSize)
       {
       throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
       }
 
-   // serializedSize >= bytesRead
-   uint32_t bytesLeftToRead = serializedSize - bytesRead;
+   // frameSize >= bytesRead
+   uint32_t bytesLeftToRead = frameSize - bytesRead;
 
    if (bytesLeftToRead > 0)
       {
-      if (serializedSize > bufferCapacity)
+      if (frameSize > bufferCapacity)
          {
          // bytesRead could be less than the buffer capacity.
-         msg.expandBuffer(serializedSize, bytesRead);
+         msg.expandBuffer(frameSize, bytesRead);
 
          // The buffer storage will change after the buffer is expanded.
          buffer = msg.getBufferStartForRead();
@@ -128,6 +254,7 @@ CommunicationStream::readMessage(Message &msg)
       readBlocking(buffer + bytesRead, bytesLeftToRead);
       }
 
+   uint32_t serializedSize = isCompressed ? decompressMessage(msg, frameSize) : frameSize;
    msg.setSerializedSize(serializedSize);
 
    // rebuild the message
@@ -142,8 +269,27 @@ void
 CommunicationStream::writeMessage(Message &msg)
    {
    char *serialMsg = msg.serialize();
+   uint32_t serializedSize = msg.serializedSize();
+
+   if (_compressionEnabled && (serializedSize >= _compressionThreshold) && (serializedSize > COMPRESSED_FRAME_HEADER_SIZE))
+      {
+      MessageCompressionStats &stats = compressionStats[int(msg.type())];
+      uint32_t frameSize = compressMessage(serialMsg, serializedSize);
+      if (frameSize)
+         {
+         stats._numCompressed++;
+         stats._uncompressedBytes += serializedSize;
+         stats._compressedBytes += frameSize;
+         // write compressed message to the socket
+         writeBlocking(_compressionBuffer, frameSize);
+         msg.clearForWrite();
+         return;
+         }
+      stats._numNotCompressible++;
+      }
+
    // write serialized message to the socket
-   writeBlocking(serialMsg, msg.serializedSize());
+   writeBlocking(serialMsg, serializedSize);
    msg.clearForWrite();
    }
 }
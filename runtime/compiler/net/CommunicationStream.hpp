@@ -26,6 +26,7 @@
 #include <unistd.h>
 #include "net/LoadSSLLibs.hpp"
 #include "net/Message.hpp"
+#include "net/SharedMemoryChannel.hpp"
 #include "infra/Statistics.hpp"
 #include "env/VerboseLog.hpp"
 
@@ -35,6 +36,23 @@ enum JITServerCompatibilityFlags
    {
    JITServerJavaVersionMask    = 0x00000FFF,
    JITServerCompressedRef      = 0x00001000,
+   // Not a compatibility flag: excluded from the version check.
+   // Set by the client in the first message to ask for compression
+   // and by the server in its replies to acknowledge it.
+   JITServerCompression        = 0x80000000,
+   };
+
+/**
+   @brief Per message type statistics about compressed messages sent by this process.
+
+   Updated without synchronization, so the numbers are approximate.
+*/
+struct MessageCompressionStats
+   {
+   uint64_t _numCompressed; // number of messages sent compressed
+   uint64_t _numNotCompressible; // messages above the threshold that did not shrink
+   uint64_t _uncompressedBytes; // original size of messages sent compressed
+   uint64_t _compressedBytes; // size of the compressed frames actually written
    };
 
 class CommunicationStream
@@ -46,6 +64,7 @@ public:
 #ifdef MESSAGE_SIZE_STATS
    static TR_Stats collectMsgStat[JITServer::MessageType_MAXTYPE];
 #endif
+   static MessageCompressionStats compressionStats[JITServer::MessageType_MAXTYPE];
 
    static void initConfigurationFlags();
 
@@ -66,21 +85,34 @@ public:
       }
 
 protected:
-   CommunicationStream() : _ssl(NULL), _connfd(-1) { }
+   CommunicationStream() :
+      _ssl(NULL), _connfd(-1), _sharedMemory(NULL), _compressionEnabled(false), _compressionThreshold(0),
+      _compressionBuffer(NULL), _compressionBufferCapacity(0)
+      { }
 
    virtual ~CommunicationStream()
       {
+      if (_sharedMemory)
+         {
+         _sharedMemory->~SharedMemoryChannel();
+         TR::Compiler->persistentGlobalAllocator().deallocate(_sharedMemory);
+         }
+
       if (_connfd != -1)
          close(_connfd);
 
       if (_ssl)
          (*OBIO_free_all)(_ssl);
+
+      if (_compressionBuffer)
+         TR::Compiler->persistentGlobalAllocator().deallocate(_compressionBuffer);
       }
 
-   void initStream(int connfd, BIO *ssl)
+   void initStream(int connfd, BIO *ssl, SharedMemoryChannel *sharedMemory = NULL)
       {
       _connfd = connfd;
       _ssl = ssl;
+      _sharedMemory = sharedMemory;
       }
 
    // Build a message sent by a remote party by reading from the socket
@@ -92,18 +124,69 @@ protected:
    void writeMessage(Message &msg);
 
    int getConnFD() const { return _connfd; }
+   bool isUsingSharedMemory() const { return _sharedMemory != NULL; }
+
+   /**
+      @brief Start compressing outgoing messages larger than the configured threshold.
+
+      Must be called only after both parties agreed to use compression on this connection.
+      Incoming compressed frames are always accepted, regardless of this setting.
+   */
+   void enableCompression();
+   bool isCompressionEnabled() const { return _compressionEnabled; }
+
+   /**
+      @brief Serialize a message into a string that can be embedded into another message.
+
+      Used for batching several queries, or their replies, in a single message.
+      The message is cleared for writing afterwards.
+   */
+   static std::string serializeToString(Message &msg);
+   /**
+      @brief Rebuild a message from a string produced by serializeToString().
+   */
+   static void deserializeFromString(Message &msg, const std::string &serializedMsg);
+
+   /**
+      @brief Whether a query of the given type can be sent by the server in a batch.
+
+      The client must be able to answer such queries with exactly one reply
+      and without sending any other message to the server.
+   */
+   static bool isBatchableQuery(MessageType type);
 
    BIO *_ssl; // SSL connection, null if not using SSL
    int _connfd;
+   SharedMemoryChannel *_sharedMemory; // same-host transport, null if using a TCP socket
+   bool _compressionEnabled;
+   uint32_t _compressionThreshold;
    ServerMessage _sMsg;
    ClientMessage _cMsg;
 
    static const uint8_t MAJOR_NUMBER = 1;
-   static const uint16_t MINOR_NUMBER = 28;
+   static const uint16_t MINOR_NUMBER = 30;
    static const uint8_t PATCH_NUMBER = 0;
    static uint32_t CONFIGURATION_FLAGS;
 
 private:
+   // The most significant bit of the size word at the beginning of a frame marks
+   // a compressed message. A compressed frame has the following layout:
+   // [uint32_t frameSize | COMPRESSED_FRAME_FLAG][uint32_t serializedSize][zlib stream]
+   // where the zlib stream holds the serialized message without its size word.
+   static const uint32_t COMPRESSED_FRAME_FLAG = 0x80000000;
+   static const uint32_t COMPRESSED_FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+   char *getCompressionBuffer(uint32_t requiredSize);
+   // Return the size of the compressed frame built in _compressionBuffer,
+   // or 0 if compressing the message would not make it smaller
+   uint32_t compressMessage(const char *serialMsg, uint32_t serializedSize);
+   // Replace the compressed frame of the given size found in the message
+   // buffer with the original message and return its serialized size
+   uint32_t decompressMessage(Message &msg, uint32_t frameSize);
+
+   char *_compressionBuffer; // scratch space for compressing/decompressing messages
+   uint32_t _compressionBufferCapacity;
+
    // readBlocking and writeBlocking are functions that directly read/write
    // passed object from/to the socket. For the object to be correctly written,
    // it needs to be contiguous.
@@ -116,7 +199,11 @@ private:
 
    void readBlocking(char *data, size_t size)
       {
-      if (_ssl)
+      if (_sharedMemory)
+         {
+         _sharedMemory->readBlocking(data, size);
+         }
+      else if (_ssl)
          {
          int32_t totalBytesRead = 0;
          while (totalBytesRead < size)
@@ -148,7 +235,11 @@ private:
    int32_t readOnceBlocking(char *data, size_t size)
       {
       int32_t bytesRead = -1;
-      if (_ssl)
+      if (_sharedMemory)
+         {
+         return _sharedMemory->readOnceBlocking(data, size);
+         }
+      else if (_ssl)
          {
          bytesRead = (*OBIO_read)(_ssl, data, size);
          }
@@ -177,7 +268,11 @@ private:
 
    void writeBlocking(const char* data, size_t size)
       {
-      if (_ssl)
+      if (_sharedMemory)
+         {
+         _sharedMemory->writeBlocking(data, size);
+         }
+      else if (_ssl)
          {
          int32_t totalBytesWritten = 0;
          while (totalBytesWritten < size)
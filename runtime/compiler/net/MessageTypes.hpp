@@ -40,6 +40,7 @@ enum MessageType : uint16_t
    connectionTerminate, // type used when client informs the server to close the connection
    compilationThreadCrashed, 
    jitDumpPrintIL,
+   batchedQueries, // type used when server sends several independent queries in one message
 
    // For TR_ResolvedJ9JITServerMethod methods
    ResolvedMethod_setRecognizedMethodInfo,
@@ -290,6 +291,7 @@ static const char *messageNames[] =
    "connectionTerminate",
    "compilationThreadCrashed", 
    "jitDumpPrintIL",
+   "batchedQueries",
    "ResolvedMethod_setRecognizedMethodInfo",
    "ResolvedMethod_startAddressForInterpreterOfJittedMethod",
    "ResolvedMethod_staticAttributes",
@@ -21,17 +21,51 @@
  *******************************************************************************/
 
 #include "ServerStream.hpp"
+#include "AtomicSupport.hpp"
+#include "control/CompilationRuntime.hpp"
 
 namespace JITServer
 {
 int ServerStream::_numConnectionsOpened = 0;
 int ServerStream::_numConnectionsClosed = 0;
+volatile uint64_t ServerStream::_totalNumRoundTrips = 0;
+volatile uint64_t ServerStream::_totalRoundTripWaitTimeUs = 0;
+volatile uint64_t ServerStream::_numCompilationsWithRoundTripStats = 0;
 
-ServerStream::ServerStream(int connfd, BIO *ssl)
-   : CommunicationStream()
+ServerStream::ServerStream(int connfd, BIO *ssl, SharedMemoryChannel *sharedMemory)
+   : CommunicationStream(), _numRoundTrips(0), _roundTripWaitTimeUs(0), _batchSent(false)
    {
-   initStream(connfd, ssl);
+   initStream(connfd, ssl, sharedMemory);
    _numConnectionsOpened++;
    _pClientSessionData = NULL;
    }
+
+void
+ServerStream::readReply()
+   {
+   PORT_ACCESS_FROM_JITCONFIG(TR::CompilationInfo::get()->getJITConfig());
+   uint64_t startTime = j9time_usec_clock();
+   readMessage(_cMsg);
+   _roundTripWaitTimeUs += j9time_usec_clock() - startTime;
+   _numRoundTrips++;
+   }
+
+void
+ServerStream::recordRoundTripStats()
+   {
+   VM_AtomicSupport::addU64(&_totalNumRoundTrips, _numRoundTrips);
+   VM_AtomicSupport::addU64(&_totalRoundTripWaitTimeUs, _roundTripWaitTimeUs);
+   VM_AtomicSupport::addU64(&_numCompilationsWithRoundTripStats, 1);
+   }
+
+void
+ServerStream::acceptCompressionRequest()
+   {
+   if (TR::CompilationInfo::get()->getPersistentInfo()->getJITServerUseCompression())
+      {
+      enableCompression();
+      if (TR::Options::getVerboseOption(TR_VerboseJITServerConns))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Client requested compression of messages; request accepted");
+      }
+   }
 }
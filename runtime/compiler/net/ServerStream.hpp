@@ -68,9 +68,10 @@ public:
 
       @param connfd socket descriptor for the communication channel
       @param ssl  BIO for the SSL enabled stream
+      @param sharedMemory shared memory transport for a same-host client, or NULL to use the socket
       @param timeout timeout value (ms) to be set for connfd
    */
-   explicit ServerStream(int connfd, BIO *ssl);
+   explicit ServerStream(int connfd, BIO *ssl, SharedMemoryChannel *sharedMemory = NULL);
    virtual ~ServerStream()
       {
       _numConnectionsClosed++;
@@ -100,6 +101,8 @@ public:
          }
 
       _sMsg.setType(type);
+      // Acknowledge the client's request for compression in every message
+      _sMsg.getMetaData()->_config = isCompressionEnabled() ? JITServerCompression : 0;
       setArgsRaw<Args...>(_sMsg, args...);
       writeMessage(_sMsg);
       }
@@ -119,7 +122,7 @@ public:
    template <typename ...T>
    std::tuple<T...> read()
       {
-      readMessage(_cMsg);
+      readReply();
       switch (_cMsg.type())
          {
          case MessageType::compilationInterrupted:
@@ -152,7 +155,8 @@ public:
       the one sent by the client. In order to ensure this, the client will embed
       version information in the first message it sends after a connection is established.
       The server will check whether its version matches the client's version and throw
-      `StreamVersionIncompatible` if it doesn't.
+      `StreamVersionIncompatible` if it doesn't. If the client also asks for compression and
+      compression is enabled at the server, large messages will be compressed on this connection.
 
       Exceptions thrown: StreamConnectionTerminate, StreamClientSessionTerminate, StreamVersionIncompatible, StreamMessageTypeMismatch
 
@@ -162,9 +166,19 @@ public:
    std::tuple<T...> readCompileRequest()
       {
       readMessage(_cMsg);
-      if (_cMsg.fullVersion() != 0 && _cMsg.fullVersion() != getJITServerFullVersion())
+      // A new compilation starts on this stream
+      _numRoundTrips = 0;
+      _roundTripWaitTimeUs = 0;
+      clearBatchedQueries();
+      if (_cMsg.fullVersion() != 0)
          {
-         throw StreamVersionIncompatible(getJITServerFullVersion(), _cMsg.fullVersion());
+         // The compression request is not part of the compatibility check
+         uint64_t clientFullVersion = _cMsg.fullVersion() & ~Message::buildFullVersion(0, JITServerCompression);
+         if (clientFullVersion != getJITServerFullVersion())
+            throw StreamVersionIncompatible(getJITServerFullVersion(), clientFullVersion);
+
+         if ((_cMsg.getMetaData()->_config & JITServerCompression) && !isCompressionEnabled())
+            acceptCompressionRequest();
          }
 
       switch (_cMsg.type())
@@ -198,6 +212,91 @@ public:
       return getArgsRaw<T...>(_cMsg);
       }
 
+   /**
+      @brief Add a query to the batch sent by the next call to sendBatchedQueries()
+
+      Queries in a batch must not depend on each other's answers. Only the message types
+      accepted by isBatchableQuery() can be batched, because the client must be able to
+      answer them with a single reply and without any further interaction with the server.
+      Typical usage:
+         stream->addBatchedQuery(MessageType::VM_getVMInfo, JITServer::Void());
+         stream->addBatchedQuery(MessageType::VM_isClassLibraryClass, clazz);
+         stream->sendBatchedQueries();
+         auto vmInfo = stream->getBatchedReply<VMInfo, ...>(0);
+         auto isClassLibraryClass = std::get<0>(stream->getBatchedReply<bool>(1));
+
+      @param [in] type Message type of the query
+      @param [in] args Arguments of the query
+   */
+   template <typename ...Args>
+   void addBatchedQuery(MessageType type, Args... args)
+      {
+      TR_ASSERT_FATAL(isBatchableQuery(type), "MessageType[%u] %s cannot be batched", type, messageNames[type]);
+      if (_batchSent)
+         clearBatchedQueries();
+
+      _sMsg.setType(type);
+      setArgsRaw<Args...>(_sMsg, args...);
+      _batchedQueryTypes.push_back(type);
+      _batchedMessages.push_back(serializeToString(_sMsg));
+      }
+
+   /**
+      @brief Send all the queries added with addBatchedQuery() in one message
+      and wait for the client to answer all of them in one reply
+
+      This counts as a single round trip.
+   */
+   void sendBatchedQueries()
+      {
+      TR_ASSERT(!_batchSent && !_batchedMessages.empty(), "There are no batched queries to send");
+      std::vector<std::string> queries;
+      queries.swap(_batchedMessages);
+      _batchSent = true;
+
+      write(MessageType::batchedQueries, queries);
+      _batchedMessages = std::get<0>(read<std::vector<std::string>>());
+      if (_batchedMessages.size() != _batchedQueryTypes.size())
+         throw StreamFailure("JITServer I/O error: unexpected number of replies to batched queries");
+      }
+
+   /**
+      @brief Extract the reply to the batched query at the given index
+
+      @param [in] idx Index of the query in the order it was added to the batch
+
+      @return Returns a tuple of arguments sent by the client in reply to the query
+   */
+   template <typename ...T>
+   std::tuple<T...> getBatchedReply(size_t idx)
+      {
+      TR_ASSERT(_batchSent && (idx < _batchedMessages.size()), "Invalid batched reply index %zu", idx);
+      deserializeFromString(_cMsg, _batchedMessages[idx]);
+      if (_cMsg.type() != _batchedQueryTypes[idx])
+         throw StreamMessageTypeMismatch(_batchedQueryTypes[idx], _cMsg.type());
+      return getArgsRaw<T...>(_cMsg);
+      }
+
+   void clearBatchedQueries()
+      {
+      _batchedQueryTypes.clear();
+      _batchedMessages.clear();
+      _batchSent = false;
+      }
+
+   // Round trips to the client for the current compilation: queries sent and
+   // time spent waiting for their replies (includes the time the client takes to answer)
+   uint32_t getNumRoundTrips() const { return _numRoundTrips; }
+   uint64_t getRoundTripWaitTimeUs() const { return _roundTripWaitTimeUs; }
+
+   /**
+      @brief Add the round trips of the current compilation to the global statistics
+   */
+   void recordRoundTripStats();
+   static uint64_t getTotalNumRoundTrips() { return _totalNumRoundTrips; }
+   static uint64_t getTotalRoundTripWaitTimeUs() { return _totalRoundTripWaitTimeUs; }
+   static uint64_t getNumCompilationsWithRoundTripStats() { return _numCompilationsWithRoundTripStats; }
+
    /**
       @brief Function invoked by server when compilation is completed successfully
 
@@ -266,8 +365,21 @@ public:
    static int getNumConnectionsClosed() { return _numConnectionsClosed; }
 
 private:
+   // Enable compression on this connection if allowed by the server options
+   void acceptCompressionRequest();
+   // Read the reply to a query and update the round trip statistics
+   void readReply();
+
    static int _numConnectionsOpened;
    static int _numConnectionsClosed;
+   static volatile uint64_t _totalNumRoundTrips;
+   static volatile uint64_t _totalRoundTripWaitTimeUs;
+   static volatile uint64_t _numCompilationsWithRoundTripStats;
+   uint32_t _numRoundTrips;
+   uint64_t _roundTripWaitTimeUs;
+   std::vector<MessageType> _batchedQueryTypes;
+   std::vector<std::string> _batchedMessages; // serialized queries until sent, then serialized replies
+   bool _batchSent;
    uint64_t _clientId;  // UID of client connected to this communication stream
    ClientSessionData *_pClientSessionData;
    };
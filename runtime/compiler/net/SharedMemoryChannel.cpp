@@ -0,0 +1,347 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "AtomicSupport.hpp"
+#include "env/CompilerEnv.hpp"
+#include "net/SharedMemoryChannel.hpp"
+#include "net/StreamExceptions.hpp"
+
+namespace JITServer
+{
+static bool
+setUnixSocketAddress(struct sockaddr_un &addr, const std::string &socketPath)
+   {
+   memset(&addr, 0, sizeof(addr));
+   addr.sun_family = AF_UNIX;
+   if (socketPath.empty() || (socketPath.size() >= sizeof(addr.sun_path)))
+      return false;
+   memcpy(addr.sun_path, socketPath.c_str(), socketPath.size() + 1);
+   return true;
+   }
+
+// Create an anonymous file for the shared memory region. The file is unlinked right away,
+// the server gets access to it only through the file descriptor passed over the socket.
+static int
+createSharedMemoryFile(size_t size)
+   {
+   char fileName[] = "/dev/shm/jitserver-XXXXXX";
+   int fd = mkstemp(fileName);
+   if (fd < 0)
+      return -1;
+   unlink(fileName);
+   if ((fcntl(fd, F_SETFD, FD_CLOEXEC) < 0) || (ftruncate(fd, size) < 0))
+      {
+      close(fd);
+      return -1;
+      }
+   return fd;
+   }
+
+SharedMemoryChannel::SharedMemoryChannel(int sockfd, void *region, size_t regionSize, uint32_t ringSize, bool isClient) :
+   _sockfd(sockfd), _region(region), _regionSize(regionSize), _ringSize(ringSize)
+   {
+   // Layout: [client->server header][server->client header][client->server data][server->client data]
+   RingHeader *headers = (RingHeader *)region;
+   char *data = (char *)region + 2 * sizeof(RingHeader);
+   _out = isClient ? &headers[0] : &headers[1];
+   _in = isClient ? &headers[1] : &headers[0];
+   _outData = isClient ? data : data + ringSize;
+   _inData = isClient ? data + ringSize : data;
+   }
+
+SharedMemoryChannel::~SharedMemoryChannel()
+   {
+   munmap(_region, _regionSize);
+   }
+
+SharedMemoryChannel *
+SharedMemoryChannel::connect(const std::string &socketPath, uint32_t timeoutMs, int &sockfd)
+   {
+   struct sockaddr_un addr;
+   if (!setUnixSocketAddress(addr, socketPath))
+      throw StreamFailure("Invalid JITServer shared memory socket path");
+
+   int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+   if (fd < 0)
+      throw StreamFailure("Cannot create Unix domain socket for JITServer");
+
+   struct timeval timeout = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
+   if ((setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeout, sizeof(timeout)) < 0) ||
+       (setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeout, sizeof(timeout)) < 0))
+      {
+      close(fd);
+      throw StreamFailure("Cannot set timeouts on Unix domain socket");
+      }
+
+   if (::connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+      {
+      close(fd);
+      throw StreamFailure("Connect to JITServer Unix domain socket failed");
+      }
+
+   uint32_t ringSize = DEFAULT_RING_SIZE;
+   size_t size = regionSize(ringSize);
+   int shmfd = createSharedMemoryFile(size);
+   if (shmfd < 0)
+      {
+      close(fd);
+      throw StreamFailure("Cannot create JITServer shared memory region");
+      }
+   void *region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, shmfd, 0);
+   if (MAP_FAILED == region)
+      {
+      close(shmfd);
+      close(fd);
+      throw StreamFailure("Cannot map JITServer shared memory region");
+      }
+   // The new file is filled with zeros, so both rings start empty
+
+   // Pass the shared memory file descriptor to the server
+   Handshake handshake = { HANDSHAKE_MAGIC, ringSize };
+   struct iovec iov = { &handshake, sizeof(handshake) };
+   char control[CMSG_SPACE(sizeof(int))];
+   memset(control, 0, sizeof(control));
+   struct msghdr msg;
+   memset(&msg, 0, sizeof(msg));
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   msg.msg_control = control;
+   msg.msg_controllen = sizeof(control);
+   struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+   cmsg->cmsg_level = SOL_SOCKET;
+   cmsg->cmsg_type = SCM_RIGHTS;
+   cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+   memcpy(CMSG_DATA(cmsg), &shmfd, sizeof(int));
+
+   ssize_t bytesSent = sendmsg(fd, &msg, 0);
+   // The mapping keeps the region alive; the file descriptor is not needed anymore
+   close(shmfd);
+
+   // Wait for the server to confirm that it mapped the region
+   char ack = 0;
+   if ((bytesSent != sizeof(handshake)) || (read(fd, &ack, 1) != 1) || (ack != 1))
+      {
+      munmap(region, size);
+      close(fd);
+      throw StreamFailure("JITServer shared memory handshake failed");
+      }
+
+   sockfd = fd;
+   return new (TR::Compiler->persistentGlobalAllocator()) SharedMemoryChannel(fd, region, size, ringSize, true);
+   }
+
+SharedMemoryChannel *
+SharedMemoryChannel::accept(int sockfd)
+   {
+   Handshake handshake = {0};
+   struct iovec iov = { &handshake, sizeof(handshake) };
+   char control[CMSG_SPACE(sizeof(int))];
+   memset(control, 0, sizeof(control));
+   struct msghdr msg;
+   memset(&msg, 0, sizeof(msg));
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   msg.msg_control = control;
+   msg.msg_controllen = sizeof(control);
+
+   ssize_t bytesReceived = recvmsg(sockfd, &msg, MSG_CMSG_CLOEXEC);
+   int shmfd = -1;
+   struct cmsghdr *cmsg = (bytesReceived > 0) ? CMSG_FIRSTHDR(&msg) : NULL;
+   if (cmsg && (cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_RIGHTS) && (cmsg->cmsg_len == CMSG_LEN(sizeof(int))))
+      memcpy(&shmfd, CMSG_DATA(cmsg), sizeof(int));
+
+   if (shmfd < 0)
+      return NULL;
+
+   // The ring size must be a power of 2 and the file must be large enough for both rings
+   uint32_t ringSize = handshake._ringSize;
+   size_t size = regionSize(ringSize);
+   struct stat fileStat;
+   if ((bytesReceived != sizeof(handshake)) || (handshake._magic != HANDSHAKE_MAGIC) ||
+       (ringSize == 0) || (ringSize & (ringSize - 1)) || (ringSize > (1 << 30)) ||
+       (fstat(shmfd, &fileStat) < 0) || ((size_t)fileStat.st_size < size))
+      {
+      close(shmfd);
+      return NULL;
+      }
+
+   void *region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, shmfd, 0);
+   close(shmfd);
+   if (MAP_FAILED == region)
+      return NULL;
+
+   char ack = 1;
+   if (write(sockfd, &ack, 1) != 1)
+      {
+      munmap(region, size);
+      return NULL;
+      }
+
+   return new (TR::Compiler->persistentGlobalAllocator()) SharedMemoryChannel(sockfd, region, size, ringSize, false);
+   }
+
+int
+SharedMemoryChannel::openListenSocket(const std::string &socketPath)
+   {
+   struct sockaddr_un addr;
+   if (!setUnixSocketAddress(addr, socketPath))
+      return -1;
+
+   int sockfd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+   if (sockfd < 0)
+      return -1;
+
+   // A socket file left behind by a server that did not shut down cleanly would make bind() fail
+   unlink(socketPath.c_str());
+   // Only processes of the same user may connect. Connections are refused until listen() is called,
+   // so restricting the socket file between bind() and listen() leaves no window for other users.
+   if ((bind(sockfd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+       || (chmod(socketPath.c_str(), S_IRUSR | S_IWUSR) < 0)
+       || (listen(sockfd, SOMAXCONN) < 0))
+      {
+      unlink(socketPath.c_str());
+      close(sockfd);
+      return -1;
+      }
+   return sockfd;
+   }
+
+void
+SharedMemoryChannel::waitForSignal()
+   {
+   char signal;
+   // Returns 0 if the peer closed the connection, -1 on timeout
+   if (read(_sockfd, &signal, 1) != 1)
+      throw StreamFailure("JITServer I/O error: read error");
+   }
+
+void
+SharedMemoryChannel::signalIfWaiting(volatile uint32_t *waitingFlag)
+   {
+   // The flag is cleared atomically, so the peer gets at most one signal for each wait.
+   // A signal sent after the peer found the state it was waiting for is harmless:
+   // the next wait returns early and the state is checked again.
+   if (*waitingFlag && (1 == VM_AtomicSupport::lockCompareExchangeU32(waitingFlag, 1, 0)))
+      {
+      char signal = 0;
+      if (write(_sockfd, &signal, 1) != 1)
+         throw StreamFailure("JITServer I/O error: write error");
+      }
+   }
+
+size_t
+SharedMemoryChannel::readOnceBlocking(char *data, size_t size)
+   {
+   uint64_t readPos = _in->_readPos;
+   uint64_t available = 0;
+   while (true)
+      {
+      available = _in->_writePos - readPos;
+      // The positions are in memory the peer can write, so never trust them to stay within the ring
+      if (available > _ringSize)
+         throw StreamFailure("JITServer I/O error: inconsistent shared memory ring positions");
+      if (available > 0)
+         break;
+      _in->_consumerWaiting = 1;
+      VM_AtomicSupport::readWriteBarrier();
+      // Check again after setting the flag, the producer might not have seen it
+      if (_in->_writePos != readPos)
+         continue;
+      waitForSignal();
+      }
+   // Read the data only after reading the producer's position
+   VM_AtomicSupport::readBarrier();
+
+   size_t bytesToRead = (available < size) ? (size_t)available : size;
+   uint32_t offset = (uint32_t)(readPos & (_ringSize - 1));
+   size_t firstPart = (bytesToRead < (_ringSize - offset)) ? bytesToRead : (_ringSize - offset);
+   memcpy(data, _inData + offset, firstPart);
+   memcpy(data + firstPart, _inData, bytesToRead - firstPart);
+
+   // Finish reading the data before the producer can overwrite it
+   VM_AtomicSupport::readWriteBarrier();
+   _in->_readPos = readPos + bytesToRead;
+   VM_AtomicSupport::readWriteBarrier();
+   signalIfWaiting(&_in->_producerWaiting);
+   return bytesToRead;
+   }
+
+void
+SharedMemoryChannel::readBlocking(char *data, size_t size)
+   {
+   size_t totalBytesRead = 0;
+   while (totalBytesRead < size)
+      totalBytesRead += readOnceBlocking(data + totalBytesRead, size - totalBytesRead);
+   }
+
+void
+SharedMemoryChannel::writeBlocking(const char *data, size_t size)
+   {
+   uint64_t writePos = _out->_writePos;
+   size_t totalBytesWritten = 0;
+   while (totalBytesWritten < size)
+      {
+      uint64_t usedSpace = writePos - _out->_readPos;
+      if (usedSpace > _ringSize)
+         throw StreamFailure("JITServer I/O error: inconsistent shared memory ring positions");
+      uint64_t freeSpace = _ringSize - usedSpace;
+      if (0 == freeSpace)
+         {
+         _out->_producerWaiting = 1;
+         VM_AtomicSupport::readWriteBarrier();
+         // Check again after setting the flag, the consumer might not have seen it
+         if (_ringSize != (writePos - _out->_readPos))
+            continue;
+         waitForSignal();
+         continue;
+         }
+      // Do not overwrite data before the consumer is done reading it
+      VM_AtomicSupport::readWriteBarrier();
+
+      size_t bytesLeft = size - totalBytesWritten;
+      size_t bytesToWrite = (freeSpace < bytesLeft) ? (size_t)freeSpace : bytesLeft;
+      uint32_t offset = (uint32_t)(writePos & (_ringSize - 1));
+      size_t firstPart = (bytesToWrite < (_ringSize - offset)) ? bytesToWrite : (_ringSize - offset);
+      memcpy(_outData + offset, data + totalBytesWritten, firstPart);
+      memcpy(_outData, data + totalBytesWritten + firstPart, bytesToWrite - firstPart);
+
+      // Publish the data before the new position
+      VM_AtomicSupport::writeBarrier();
+      writePos += bytesToWrite;
+      _out->_writePos = writePos;
+      totalBytesWritten += bytesToWrite;
+      VM_AtomicSupport::readWriteBarrier();
+      signalIfWaiting(&_out->_consumerWaiting);
+      }
+   }
+} // namespace JITServer
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef SHARED_MEMORY_CHANNEL_H
+#define SHARED_MEMORY_CHANNEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace JITServer
+{
+/**
+   @class SharedMemoryChannel
+   @brief Transport for a JITServer connection between a client and a server running on the same host.
+
+   Message frames are exchanged through two single-producer single-consumer ring buffers
+   (one per direction) placed in a shared memory region, so large messages are copied
+   directly between the processes instead of going through the kernel socket buffers.
+   The contents of the frames are not changed: they are the same serialized messages
+   that are sent over TCP.
+
+   The connection itself is a Unix domain socket. The client creates the shared memory region
+   and passes its file descriptor to the server over the socket during the handshake.
+   After the handshake the socket is only used to wake up a peer waiting for data or for free space
+   in a ring, which also means that the socket timeouts and the detection of a closed connection
+   work the same way as for TCP connections.
+
+   A connection uses either a SharedMemoryChannel or a TCP/SSL socket; see CommunicationStream.
+*/
+class SharedMemoryChannel
+   {
+public:
+   /**
+      @brief Client side: connect to the server's Unix domain socket and create the shared memory region.
+
+      @param [in] socketPath Path of the Unix domain socket the server listens on
+      @param [in] timeoutMs Timeout for socket operations
+      @param [out] sockfd Connected socket, owned by the caller if the function succeeds
+
+      @return Returns the channel; throws StreamFailure if the connection cannot be established
+   */
+   static SharedMemoryChannel *connect(const std::string &socketPath, uint32_t timeoutMs, int &sockfd);
+
+   /**
+      @brief Server side: complete the handshake on a socket accepted from the Unix domain socket listener.
+
+      @param [in] sockfd Accepted socket; timeouts must already be set
+
+      @return Returns the channel, or NULL if the handshake failed
+   */
+   static SharedMemoryChannel *accept(int sockfd);
+
+   /**
+      @brief Create, bind and listen on a non-blocking Unix domain socket at the given path,
+      replacing any stale socket file left by a previous server. The socket file is made
+      accessible to the owner only (mode 0600), so only clients of the same user can connect.
+
+      @return Returns the listening socket, or -1 on failure
+   */
+   static int openListenSocket(const std::string &socketPath);
+
+   ~SharedMemoryChannel();
+
+   void readBlocking(char *data, size_t size);
+   // Read at least one byte and at most size bytes; returns the number of bytes read
+   size_t readOnceBlocking(char *data, size_t size);
+   void writeBlocking(const char *data, size_t size);
+
+   static const uint32_t DEFAULT_RING_SIZE = 1 << 20; // bytes in each direction
+
+private:
+   // Control block of a ring buffer. Positions only increase; the offset in the data area is position % size.
+   // The fields written by the producer and by the consumer are on different cache lines.
+   struct RingHeader
+      {
+      volatile uint64_t _writePos;
+      volatile uint32_t _consumerWaiting; // set by the consumer before it blocks waiting for data
+      uint8_t _padding1[64 - sizeof(uint64_t) - sizeof(uint32_t)];
+      volatile uint64_t _readPos;
+      volatile uint32_t _producerWaiting; // set by the producer before it blocks waiting for free space
+      uint8_t _padding2[64 - sizeof(uint64_t) - sizeof(uint32_t)];
+      };
+
+   // Sent by the client together with the file descriptor of the shared memory region
+   struct Handshake
+      {
+      uint32_t _magic;
+      uint32_t _ringSize;
+      };
+   static const uint32_t HANDSHAKE_MAGIC = 0x4A53484D; // "JSHM"
+
+   SharedMemoryChannel(int sockfd, void *region, size_t regionSize, uint32_t ringSize, bool isClient);
+
+   static size_t regionSize(uint32_t ringSize) { return 2 * sizeof(RingHeader) + 2 * (size_t)ringSize; }
+
+   // Block until the peer signals a change in the state of a ring
+   void waitForSignal();
+   // Wake up the peer if it set the given waiting flag
+   void signalIfWaiting(volatile uint32_t *waitingFlag);
+
+   int _sockfd; // owned by the stream using this channel
+   void *_region;
+   size_t _regionSize;
+   uint32_t _ringSize; // power of 2
+   RingHeader *_in;
+   RingHeader *_out;
+   char *_inData;
+   char *_outData;
+   };
+} // namespace JITServer
+
+#endif // SHARED_MEMORY_CHANNEL_H
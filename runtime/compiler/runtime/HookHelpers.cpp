@@ -38,6 +38,7 @@
 #include "runtime/ArtifactManager.hpp"
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/DataCache.hpp"
+#include "runtime/PerfJitDump.hpp"
 #include "runtime/RuntimeAssumptions.hpp"
 #include "env/VMJ9.h"
 #include "env/j9method.h"
@@ -314,6 +315,7 @@ void jitReleaseCodeCollectMetaData(J9JITConfig *jitConfig, J9VMThread *vmThread,
          }
 
       vlogReclamation("Reclaiming", metaData, faintCacheBlock ? faintCacheBlock->_bytesToSaveAtStart : 0);
+      TR_PerfJitDump::codeReclaimed(jitConfig, metaData, faintCacheBlock ? faintCacheBlock->_bytesToSaveAtStart : 0);
 
       if (faintCacheBlock)
          {
@@ -73,7 +73,9 @@
 #include "runtime/J9Profiler.hpp"
 #include "omrformatconsts.h"
 
-#define BC_HASH_TABLE_SIZE  34501 // 131071// 34501
+#define BC_HASH_TABLE_INITIAL_SIZE (1 << 15) // must be a power of 2
+#define BC_HASH_TABLE_MAX_SIZE     (1 << 21)
+#define BC_HASH_TABLE_MAX_LOAD     2 // average number of entries per bucket that triggers growth
 #undef  IPROFILER_CONTENDED_LOCKING
 #define ALLOC_HASH_TABLE_SIZE 1201
 #define TEST_verbose 0
@@ -570,13 +572,17 @@ TR_IProfiler::allocate(J9JITConfig *jitConfig)
 TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
    : _isIProfilingEnabled(true),
      _valueProfileMethod(NULL), _lightHashTableMonitor(0), _allowedToGiveInlinedInformation(true),
-     _globalAllocationCount (0), _maxCallFrequency(0), _iprofilerThread(0), _iprofilerOSThread(NULL),
+     _globalAllocationCount (0), _maxCallFrequency(0), _numIProfilerThreads(0), _numActiveIProfilerThreads(0),
      _workingBufferTail(NULL), _numOutstandingBuffers(0), _numRequests(1), _numRequestsSkipped(0),
      _numRequestsHandedToIProfilerThread(0), _iprofilerThreadExitFlag(0), _iprofilerMonitor(NULL),
-     _crtProfilingBuffer(NULL), _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0)
+     _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0)
    {
    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
 
+   memset(_iprofilerOSThreads, 0, sizeof(_iprofilerOSThreads));
+   memset(_iprofilerThreads, 0, sizeof(_iprofilerThreads));
+   memset(_crtProfilingBuffers, 0, sizeof(_crtProfilingBuffers));
+
    _iprofilerBufferSize = (uint32_t)jitConfig->iprofilerBufferSize; //J9_PROFILING_BUFFER_SIZE;
    _portLib = jitConfig->javaVM->portLibrary;
    _vm = TR_J9VMBase::get(jitConfig, 0);
@@ -592,10 +598,10 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
    _hashTableMonitor = TR::Monitor::create("JIT-InterpreterProfilingMonitor");
 
    // bytecode hashtable
-   _bcHashTable = (TR_IPBytecodeHashTableEntry**)jitPersistentAlloc(BC_HASH_TABLE_SIZE*sizeof(TR_IPBytecodeHashTableEntry*));
-   if (_bcHashTable != NULL)
-      memset(_bcHashTable, 0, BC_HASH_TABLE_SIZE*sizeof(TR_IPBytecodeHashTableEntry*));
-   else
+   _numBCHashTableEntries = 0;
+   _numBCHashTableGrowths = 0;
+   _bcHashTable = allocateBCHashTableBuckets(BC_HASH_TABLE_INITIAL_SIZE);
+   if (!_bcHashTable || !_hashTableMonitor)
       _isIProfilingEnabled = false;
 
 #if defined(EXPERIMENTAL_IPROFILER)
@@ -644,10 +650,10 @@ TR_IProfiler::isCallGraphProfilingEnabled()
    }
 
 
-inline int32_t
-TR_IProfiler::bcHash(uintptr_t pc)
+inline uint32_t
+TR_IProfiler::bcHash(uintptr_t pc, uint32_t tableSize)
    {
-   return (int32_t)((pc & 0x7FFFFFFF) % BC_HASH_TABLE_SIZE);
+   return (uint32_t)(pc ^ (pc >> 15)) & (tableSize - 1);
    }
 
 inline int32_t
@@ -1017,12 +1023,14 @@ TR_IProfiler::addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data,
    return false;
    }
 
+// Does not need any lock; see TR_IPBytecodeHashTableBuckets
 TR_IPBytecodeHashTableEntry *
-TR_IProfiler::searchForSample(uintptr_t pc, int32_t bucket)
+TR_IProfiler::searchForSample(uintptr_t pc)
    {
    TR_IPBytecodeHashTableEntry *entry;
+   TR_IPBytecodeHashTableBuckets *table = _bcHashTable;
 
-   for (entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+   for (entry = table->_buckets[bcHash(pc, table->_size)]; entry; entry = entry->getNext())
       {
       if (pc == entry->getPC())
          return entry;
@@ -1050,11 +1058,11 @@ TR_IProfiler::searchForAllocSample(uintptr_t pc, int32_t bucket)
 
 
 TR_IPBytecodeHashTableEntry *
-TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
+TR_IProfiler::findOrCreateEntry(uintptr_t pc, bool addIt)
    {
    TR_IPBytecodeHashTableEntry *entry = NULL;
 
-   entry = searchForSample (pc, bucket);
+   entry = searchForSample (pc);
    // if we are just searching and we didn't find profile data for the
    // method just go back
    if (!addIt)
@@ -1063,28 +1071,92 @@ TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
    if (entry)
       return entry;
 
-   // Create a new hash table entry
-   U_8 byteCode = *(U_8*) pc;
-   if (isCompact(byteCode))
-      entry = new TR_IPBCDataFourBytes(pc);
-   else
+   _hashTableMonitor->enter();
+
+   // Another thread may have added the entry (or grown the table) since we looked
+   entry = searchForSample (pc);
+   if (!entry)
       {
-      if (isSwitch(byteCode))
-         entry = new TR_IPBCDataEightWords(pc);
+      // Create a new hash table entry
+      U_8 byteCode = *(U_8*) pc;
+      if (isCompact(byteCode))
+         entry = new TR_IPBCDataFourBytes(pc);
       else
-         entry = new TR_IPBCDataCallGraph(pc);
-      }
+         {
+         if (isSwitch(byteCode))
+            entry = new TR_IPBCDataEightWords(pc);
+         else
+            entry = new TR_IPBCDataCallGraph(pc);
+         }
 
-   if (!entry)
-      return NULL;
+      if (entry)
+         {
+         TR_IPBytecodeHashTableBuckets *table = _bcHashTable;
+         uint32_t bucket = bcHash(pc, table->_size);
+         entry->setNext(table->_buckets[bucket]);
+         FLUSH_MEMORY(TR::Compiler->target.isSMP());
+         table->_buckets[bucket] = entry;
 
-   entry->setNext(_bcHashTable[bucket]);
-   FLUSH_MEMORY(TR::Compiler->target.isSMP());
-   _bcHashTable[bucket] = entry;
+         _numBCHashTableEntries++;
+         if (_numBCHashTableEntries > BC_HASH_TABLE_MAX_LOAD * table->_size && table->_size < BC_HASH_TABLE_MAX_SIZE)
+            growBCHashTable();
+         }
+      }
+
+   _hashTableMonitor->exit();
 
    return entry;
    }
 
+TR_IPBytecodeHashTableBuckets *
+TR_IProfiler::allocateBCHashTableBuckets(uint32_t size)
+   {
+   size_t bytes = sizeof(TR_IPBytecodeHashTableBuckets) + (size - 1) * sizeof(TR_IPBytecodeHashTableEntry *);
+   TR_IPBytecodeHashTableBuckets *table = (TR_IPBytecodeHashTableBuckets *)jitPersistentAlloc(bytes);
+   if (table)
+      {
+      memset(table, 0, bytes);
+      table->_size = size;
+      }
+   return table;
+   }
+
+//--------------------------- growBCHashTable ----------------------------
+// Double the number of buckets of the bytecode hash table.
+// Must be called with _hashTableMonitor in hand.
+// The entries are moved to the new bucket array before the array is published.
+// A reader walking a chain of the old array while this happens may be diverted to
+// a chain of the new array and miss the entry it is looking for, which is the same
+// as the profiling data not being available yet. Chains never become circular.
+//------------------------------------------------------------------------
+void
+TR_IProfiler::growBCHashTable()
+   {
+   TR_IPBytecodeHashTableBuckets *oldTable = _bcHashTable;
+   TR_IPBytecodeHashTableBuckets *newTable = allocateBCHashTableBuckets(oldTable->_size * 2);
+   if (!newTable)
+      return; // keep using the current table
+   memoryConsumed += (int32_t)(newTable->_size * sizeof(TR_IPBytecodeHashTableEntry *));
+
+   for (uint32_t i = 0; i < oldTable->_size; i++)
+      {
+      TR_IPBytecodeHashTableEntry *entry = oldTable->_buckets[i];
+      while (entry)
+         {
+         TR_IPBytecodeHashTableEntry *next = entry->getNext();
+         uint32_t bucket = bcHash(entry->getPC(), newTable->_size);
+         entry->setNext(newTable->_buckets[bucket]);
+         newTable->_buckets[bucket] = entry;
+         entry = next;
+         }
+      }
+
+   newTable->_previous = oldTable; // readers may still use the old array
+   FLUSH_MEMORY(TR::Compiler->target.isSMP());
+   _bcHashTable = newTable;
+   _numBCHashTableGrowths++;
+   }
+
 TR_IPBCDataAllocation *
 TR_IProfiler::findOrCreateAllocEntry(int32_t bucket, uintptr_t pc, bool addIt)
    {
@@ -1312,7 +1384,7 @@ TR_IProfiler::persistentProfilingSample(TR_OpaqueMethodBlock *method, uint32_t b
          if (store)
             {
             // Create a new IProfiler hashtable entry and copy the data from the SCC
-            TR_IPBytecodeHashTableEntry *newEntry = findOrCreateEntry(bcHash(pc), pc, true);
+            TR_IPBytecodeHashTableEntry *newEntry = findOrCreateEntry(pc, true);
             newEntry->loadFromPersistentCopy(store, comp);
             return newEntry;
             }
@@ -1395,7 +1467,7 @@ TR_IProfiler::profilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIn
 
       U_8 bytecode =  *(U_8 *)pc;
       // Find the pc in the IProfiler/bytecode hashtable
-      TR_IPBytecodeHashTableEntry * currentEntry = findOrCreateEntry(bcHash(pc), pc, false);
+      TR_IPBytecodeHashTableEntry * currentEntry = findOrCreateEntry(pc, false);
       TR_IPBytecodeHashTableEntry * persistentEntry = NULL;
       TR_IPBytecodeHashTableEntry * entry = currentEntry;
       TR_IPBCDataStorageHeader *persistentEntryStore = NULL;
@@ -1531,7 +1603,7 @@ TR_IProfiler::profilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIn
             if (persistentEntry && (persistentEntry->getData()))
                {
                _STATS_IPEntryChoosePersistent++;
-               currentEntry = findOrCreateEntry(bcHash(pc), pc, true);
+               currentEntry = findOrCreateEntry(pc, true);
                currentEntry->copyFromEntry(persistentEntry, comp);
                // Remember that we already looked into the SCC for this PC
                currentEntry->setPersistentEntryRead();
@@ -1618,7 +1690,7 @@ TR_IPBCDataEightWords::getSumSwitchCount()
 TR_IPBytecodeHashTableEntry *
 TR_IProfiler::profilingSample (uintptr_t pc, uintptr_t data, bool addIt, bool isRIData, uint32_t freq)
    {
-   TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(bcHash(pc), pc, addIt);
+   TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(pc, addIt);
 
    if (entry && addIt)
       {
@@ -2561,9 +2633,11 @@ TR_IProfiler::outputStats()
       fprintf(stderr, "IProfiler: Number of buffers to be processed           =%" OMR_PRIu64 "\n", _numRequests);
       fprintf(stderr, "IProfiler: Number of buffers discarded                 =%" OMR_PRIu64 "\n", _numRequestsSkipped);
       fprintf(stderr, "IProfiler: Number of buffers handed to iprofiler thread=%" OMR_PRIu64 "\n", _numRequestsHandedToIProfilerThread);
+      fprintf(stderr, "IProfiler: Number of iprofiler threads                 =%u\n", _numIProfilerThreads);
       }
    fprintf(stderr, "IProfiler: Number of records processed=%" OMR_PRIu64 "\n", _iprofilerNumRecords);
    fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
+   fprintf(stderr, "IProfiler: Number of hashtable buckets=%u (grown %u times)\n", _bcHashTable->_size, _numBCHashTableGrowths);
    checkMethodHashTable();
    }
 
@@ -3378,9 +3452,10 @@ uint32_t
 TR_IProfiler::releaseAllEntries()
    {
    uint32_t count = 0;
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   TR_IPBytecodeHashTableBuckets *table = _bcHashTable;
+   for (uint32_t bucket = 0; bucket < table->_size; bucket++)
       {
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+      for (TR_IPBytecodeHashTableEntry *entry = table->_buckets[bucket]; entry; entry = entry->getNext())
          {
          if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked())
             {
@@ -3395,11 +3470,7 @@ TR_IProfiler::releaseAllEntries()
 uint32_t
 TR_IProfiler::countEntries()
    {
-   uint32_t count = 0;
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
-         count++;
-   return count;
+   return _numBCHashTableEntries;
    }
 
 
@@ -3407,9 +3478,10 @@ TR_IProfiler::countEntries()
 //
 void TR_IProfiler::setupEntriesInHashTable(TR_IProfiler *ip)
    {
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   TR_IPBytecodeHashTableBuckets *table = _bcHashTable;
+   for (uint32_t bucket = 0; bucket < table->_size; bucket++)
       {
-      TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket], *prevEntry = NULL;
+      TR_IPBytecodeHashTableEntry *entry = table->_buckets[bucket], *prevEntry = NULL;
 
       while (entry)
          {
@@ -3426,7 +3498,7 @@ void TR_IProfiler::setupEntriesInHashTable(TR_IProfiler *ip)
             }
 
 
-         TR_IPBytecodeHashTableEntry *newEntry = ip->findOrCreateEntry(bucket, pc, true);
+         TR_IPBytecodeHashTableEntry *newEntry = ip->findOrCreateEntry(pc, true);
          // check for entries corresponding to
          // unloaded methods, findOrCreateEntry will
          // return NULL above. its ok to ignore these entries
@@ -3642,15 +3714,18 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void * entryarg)
    TR_IProfiler *iProfiler = fe->getIProfiler();
    J9VMThread *iprofilerThread = NULL;
    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
+   // IProfiler threads are started one at a time and the starting thread waits for the
+   // attach attempt, so the number of threads attached so far is the id of this thread
+   uint32_t threadId = iProfiler->getNumIProfilerThreads();
    // If I created this thread, iprofiler exists; don't need to check against NULL
    int rc = vm->internalVMFunctions->internalAttachCurrentThread(vm, &iprofilerThread, NULL,
                                   J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_NO_OBJECT |
                                   J9_PRIVATE_FLAGS_SYSTEM_THREAD | J9_PRIVATE_FLAGS_ATTACHED_THREAD,
-                                  iProfiler->getIProfilerOSThread());
+                                  j9thread_self());
    iProfiler->getIProfilerMonitor()->enter();
    iProfiler->setAttachAttempted(true);
    if (rc == JNI_OK)
-      iProfiler->setIProfilerThread(iprofilerThread);
+      iProfiler->setIProfilerThread(iprofilerThread, threadId);
    iProfiler->getIProfilerMonitor()->notifyAll();
    iProfiler->getIProfilerMonitor()->exit();
    if (rc != JNI_OK)
@@ -3661,20 +3736,19 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void * entryarg)
       (*vm->javaOffloadSwitchOnWithReasonFunc)(iprofilerThread, J9_JNI_OFFLOAD_SWITCH_JIT_IPROFILER_THREAD);
 #endif
 
-   j9thread_set_name(j9thread_self(), "JIT IProfiler");
+   j9thread_set_name(j9thread_self(), threadId == 0 ? "JIT IProfiler" : "JIT IProfiler Helper");
 
-   iProfiler->processWorkingQueue();
+   iProfiler->processWorkingQueue(threadId);
 
    vm->internalVMFunctions->DetachCurrentThread((JavaVM *) vm);
-   iProfiler->setIProfilerThread(NULL);
    iProfiler->getIProfilerMonitor()->enter();
-   // free the special buffer because we don't need it anymore
-   if (iProfiler->getCrtProfilingBuffer())
+   iProfiler->setIProfilerThread(NULL, threadId);
+   // The last thread to exit frees the special buffer because we don't need it anymore
+   if (iProfiler->decNumActiveIProfilerThreads())
       {
-      j9mem_free_memory(iProfiler->getCrtProfilingBuffer());
-      iProfiler->setCrtProfilingBuffer(NULL);
+      iProfiler->freeStopRequest();
+      iProfiler->setIProfilerThreadExitFlag();
       }
-   iProfiler->setIProfilerThreadExitFlag();
    iProfiler->getIProfilerMonitor()->notifyAll();
    j9thread_exit((J9ThreadMonitor*)iProfiler->getIProfilerMonitor()->getVMMonitor());
 
@@ -3695,29 +3769,51 @@ void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
 
    priority = J9THREAD_PRIORITY_NORMAL;
 
+   // A single IProfiler thread cannot keep up with the buffers produced by many
+   // application threads, so use more threads on machines with many CPUs
+   uint32_t numThreads = TR::Options::_numIProfilerThreads;
+   if (TR::Options::_numIProfilerThreads < 0)
+      numThreads = _compInfo->getNumTargetCPUs() / 16;
+   numThreads = std::min(std::max(numThreads, (uint32_t)1), (uint32_t)MAX_IPROFILER_THREADS);
+
    _iprofilerMonitor = TR::Monitor::create("JIT-iprofilerMonitor");
    if (_iprofilerMonitor)
       {
-      // create the thread for interpreter profiling
-      if(javaVM->internalVMFunctions->createThreadWithCategory(&_iprofilerOSThread,
-                                      TR::Options::_profilerStackSize << 10,
-                                      priority,
-                                      0,
-                                      &iprofilerThreadProc,
-                                      javaVM->jitConfig,
-                                      J9THREAD_CATEGORY_SYSTEM_JIT_THREAD))
+      for (uint32_t i = 0; i < numThreads; i++)
          {
-         j9tty_printf(PORTLIB, "Error: Unable to create iprofiler thread\n");
-         TR::Options::getCmdLineOptions()->setOption(TR_DisableIProfilerThread);
-         // TODO:destroy the monitor that was created (_iprofilerMonitor)
-         _iprofilerMonitor = NULL;
-         }
-      else // Must wait here until the thread gets created; otherwise an early shutdown
-         { // does not know whether or not to destroy the thread
-         _iprofilerMonitor->enter();
-         while (!getAttachAttempted())
-            _iprofilerMonitor->wait();
-         _iprofilerMonitor->exit();
+         // create the thread for interpreter profiling
+         setAttachAttempted(false);
+         if(javaVM->internalVMFunctions->createThreadWithCategory(&_iprofilerOSThreads[i],
+                                         TR::Options::_profilerStackSize << 10,
+                                         priority,
+                                         0,
+                                         &iprofilerThreadProc,
+                                         javaVM->jitConfig,
+                                         J9THREAD_CATEGORY_SYSTEM_JIT_THREAD))
+            {
+            if (i > 0) // Can do with the threads that were already created
+               break;
+            j9tty_printf(PORTLIB, "Error: Unable to create iprofiler thread\n");
+            TR::Options::getCmdLineOptions()->setOption(TR_DisableIProfilerThread);
+            // TODO:destroy the monitor that was created (_iprofilerMonitor)
+            _iprofilerMonitor = NULL;
+            break;
+            }
+         else // Must wait here until the thread gets created; otherwise an early shutdown
+            { // does not know whether or not to destroy the thread
+            _iprofilerMonitor->enter();
+            while (!getAttachAttempted())
+               _iprofilerMonitor->wait();
+            bool attached = getIProfilerThread(i) != NULL;
+            if (attached)
+               {
+               _numIProfilerThreads++;
+               _numActiveIProfilerThreads++;
+               }
+            _iprofilerMonitor->exit();
+            if (!attached)
+               break;
+            }
          }
       }
    else
@@ -3762,7 +3858,8 @@ void TR_IProfiler::stopIProfilerThread()
    if (!_iprofilerMonitor)
       return; // possible if the IProfiler thread was never created
    _iprofilerMonitor->enter();
-   if (!getIProfilerThread()) // We could not create the iprofilerThread
+   // Thread 0 may already be gone while helper threads are still running
+   if (0 == _numActiveIProfilerThreads) // We could not create the iprofilerThread, or all have exited
       {
       _iprofilerMonitor->exit();
       return;
@@ -3807,7 +3904,8 @@ void TR_IProfiler::stopIProfilerThread()
       specialProfilingBuffer->setSize(0);
       _workingBufferList.add(specialProfilingBuffer);
       _workingBufferTail = specialProfilingBuffer;
-      // wait for the iprofilerThread to stop
+      // wait for all the iprofiler threads to stop; the special buffer
+      // stays in the queue until the last one has seen it
       while (!_iprofilerThreadExitFlag)
          {
          _iprofilerMonitor->notifyAll();
@@ -3876,7 +3974,7 @@ TR_IProfiler::postIprofilingBufferToWorkingQueue(J9VMThread * vmThread, const U_
 // Method executed by the java thread when jitHookBytecodeProfiling() is called
 bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, UDATA size)
    {
-   if (_numOutstandingBuffers >= TR::Options::_iprofilerNumOutstandingBuffers ||
+   if (_numOutstandingBuffers >= TR::Options::_iprofilerNumOutstandingBuffers * (int32_t)_numIProfilerThreads ||
        _compInfo->getPersistentInfo()->getLoadFactor() >= 1) // More active threads than CPUs
       {
       if (100*_numRequestsSkipped >= (uint64_t)TR::Options::_iprofilerBufferMaxPercentageToDiscard * _numRequests)
@@ -3906,10 +4004,13 @@ bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataS
    }
 
 
-// This method is executed by the iprofiling thread
-void TR_IProfiler::processWorkingQueue()
+// This method is executed by the iprofiling threads.
+// Buffers are parsed concurrently: updates to the hashtables are already
+// synchronized because app threads can parse buffers themselves.
+void TR_IProfiler::processWorkingQueue(uint32_t threadId)
    {
    PORT_ACCESS_FROM_PORT(_portLib);
+   J9VMThread *iprofilerThread = _iprofilerThreads[threadId];
    // wait for something to do
    _iprofilerMonitor->enter();
    do {
@@ -3918,40 +4019,53 @@ void TR_IProfiler::processWorkingQueue()
          //fprintf(stderr, "IProfiler thread will wait for data outstanding=%d\n", numOutstandingBuffers);
          _iprofilerMonitor->wait();
          }
+      // The special buffer is left in the queue so that all iprofiler threads see it
+      if (_workingBufferList.getFirst()->getSize() == 0)
+         {
+         _iprofilerMonitor->exit();
+         break;
+         }
       // We have some buffer to process
       // Dequeue the buffer to be processed
       //
-      _crtProfilingBuffer = _workingBufferList.pop();
+      IProfilerBuffer *crtProfilingBuffer = _workingBufferList.pop();
+      _crtProfilingBuffers[threadId] = crtProfilingBuffer;
       if (_workingBufferList.isEmpty())
          _workingBufferTail = NULL;
 
       // We don't need the iprofiler monitor now
       _iprofilerMonitor->exit();
-      if (_crtProfilingBuffer->getSize() > 0)
+
+      // process the buffer after acquiring VM access
+      acquireVMAccessNoSuspend(iprofilerThread);   // blocking. Will wait for the entire GC
+      // Check to see if GC has invalidated this buffer
+      if (crtProfilingBuffer->isValid())
          {
-         // process the buffer after acquiring VM access
-         acquireVMAccessNoSuspend(_iprofilerThread);   // blocking. Will wait for the entire GC
-         // Check to see if GC has invalidated this buffer
-         if (_crtProfilingBuffer->isValid())
-            {
          //fprintf(stderr, "IProfiler thread will process buffer %p of size %u\n", profilingBuffer->getBuffer(), profilingBuffer->getSize());
-            parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
+         parseBuffer(iprofilerThread, crtProfilingBuffer->getBuffer(), crtProfilingBuffer->getSize());
          //fprintf(stderr, "IProfiler thread finished processing\n");
-            }
-         releaseVMAccess(_iprofilerThread);
-         }
-      else // Special
-         {
-         break;
          }
+      releaseVMAccess(iprofilerThread);
+
       // attach the buffer to the buffer pool
       _iprofilerMonitor->enter();
-      _freeBufferList.add(_crtProfilingBuffer);
-      _crtProfilingBuffer = NULL;
+      _freeBufferList.add(crtProfilingBuffer);
+      _crtProfilingBuffers[threadId] = NULL;
       _numOutstandingBuffers--;
       }while(1);
    }
 
+// Called by the last iprofiler thread to exit, with the iprofilerMonitor in hand
+void TR_IProfiler::freeStopRequest()
+   {
+   PORT_ACCESS_FROM_PORT(_portLib);
+   IProfilerBuffer *specialProfilingBuffer = _workingBufferList.pop();
+   TR_ASSERT(specialProfilingBuffer && specialProfilingBuffer->getSize() == 0, "The special buffer must be at the head of the queue");
+   if (_workingBufferList.isEmpty())
+      _workingBufferTail = NULL;
+   j9mem_free_memory(specialProfilingBuffer);
+   }
+
 extern "C" void stopInterpreterProfiling(J9JITConfig *jitConfig);
 
 /* Lower value will more aggressively skip samples as the number of unloaded classes increases */
@@ -4144,7 +4258,7 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
             uint32_t offset = (uint32_t) (pc - caller->bytecodes);
             findOrCreateMethodEntry(caller, callee , true ,offset);
             if (_compInfo->getLowPriorityCompQueue().isTrackingEnabled() &&  // is feature enabled?
-                vmThread == _iprofilerThread) // only IProfiler thread is allowed to execute this
+                vmThread == _iprofilerThreads[0]) // only the main IProfiler thread is allowed to execute this
                {
                _compInfo->getLowPriorityCompQueue().tryToScheduleCompilation(vmThread, caller);
                }
@@ -4170,7 +4284,7 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
                uint32_t offset = (uint32_t) (pc - caller->bytecodes);
                findOrCreateMethodEntry(caller, callee , true , offset);
                if (_compInfo->getLowPriorityCompQueue().isTrackingEnabled() &&  // is feature enabled?
-                  vmThread == _iprofilerThread)  // only IProfiler thread is allowed to execute this
+                  vmThread == _iprofilerThreads[0])  // only the main IProfiler thread is allowed to execute this
                   {
                   _compInfo->getLowPriorityCompQueue().tryToScheduleCompilation(vmThread, caller);
                   }
@@ -4307,16 +4421,18 @@ void TR_IProfiler::invalidateProfilingBuffers() // called for class unloading
    if (!_iprofilerMonitor)
       return;
    _iprofilerMonitor->enter();
-   if (!getIProfilerThread())
+   // A helper thread can still hold a buffer after thread 0 exited
+   if (0 == _numActiveIProfilerThreads)
       {
       _iprofilerMonitor->exit();
       return;
       }
    IProfilerBuffer *specialProfilingBuffer = NULL;
-   if (_crtProfilingBuffer && _crtProfilingBuffer->getSize() > 0)
+   for (uint32_t i = 0; i < _numIProfilerThreads; i++)
       {
-      // mark this buffer as invalid
-      _crtProfilingBuffer->setIsInvalidated(true); // set with exclusive VM access
+      // mark the buffers being processed as invalid
+      if (_crtProfilingBuffers[i])
+         _crtProfilingBuffers[i]->setIsInvalidated(true); // set with exclusive VM access
       }
    while (!_workingBufferList.isEmpty())
       {
@@ -4689,7 +4805,8 @@ void TR_AggregationHT::sortByNameAndPrint(TR_J9VMBase *fe)
 void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
    {
    fprintf(stderr, "Dumping info ...\n");
-   TR_AggregationHT aggregationHT(BC_HASH_TABLE_SIZE);
+   TR_IPBytecodeHashTableBuckets *table = _bcHashTable;
+   TR_AggregationHT aggregationHT(table->_size);
    if (aggregationHT.getSize() == 0) // OOM
       {
       fprintf(stderr, "Cannot allocate memory. Bailing out.\n");
@@ -4714,10 +4831,10 @@ void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
    TR_J9VMBase * fe = TR_J9VMBase::get(javaVM->jitConfig, vmThread);
 
    fprintf(stderr, "Aggregating per method ...\n");
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   for (uint32_t bucket = 0; bucket < table->_size; bucket++)
       {
       //fprintf(stderr, "Looking at bucket %d\n", bucket);
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+      for (TR_IPBytecodeHashTableEntry *entry = table->_buckets[bucket]; entry; entry = entry->getNext())
          {
          // Skip invalid entries
          if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
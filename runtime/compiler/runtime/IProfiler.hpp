@@ -449,6 +449,19 @@ private:
    CallSiteProfileInfo _csInfo;
    };
 
+// Bucket array of the bytecode hash table.
+// The table grows as entries are added. Entries are inserted and the table is grown
+// under _hashTableMonitor, while readers search it without any lock. Because a reader
+// may still be walking an older bucket array after the table has grown, the old arrays
+// are kept (chained through _previous) for the lifetime of the profiler; their total
+// size is smaller than the size of the current array.
+struct TR_IPBytecodeHashTableBuckets
+   {
+   uint32_t _size; // power of 2
+   TR_IPBytecodeHashTableBuckets *_previous;
+   TR_IPBytecodeHashTableEntry *_buckets[1]; // actually _size entries
+   };
+
 class IProfilerBuffer : public TR_Link0<IProfilerBuffer>
    {
    public:
@@ -572,16 +585,20 @@ public:
 
 
 public:
-   J9VMThread* getIProfilerThread() { return _iprofilerThread; }
-   void setIProfilerThread(J9VMThread* thread) { _iprofilerThread = thread; }
-   j9thread_t getIProfilerOSThread() { return _iprofilerOSThread; }
+   // Buffers are processed by several IProfiler threads when there are many CPUs (see -Xjit:numIProfilerThreads).
+   // Thread 0 is the main IProfiler thread; it is the only one that drives the low priority compilation queue
+   static const uint32_t MAX_IPROFILER_THREADS = 8;
+   J9VMThread* getIProfilerThread(uint32_t threadId = 0) { return _iprofilerThreads[threadId]; }
+   void setIProfilerThread(J9VMThread* thread, uint32_t threadId = 0) { _iprofilerThreads[threadId] = thread; }
+   uint32_t getNumIProfilerThreads() const { return _numIProfilerThreads; }
    TR::Monitor* getIProfilerMonitor() { return _iprofilerMonitor; }
    bool processProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, UDATA size);
    void setAttachAttempted(bool b) { _iprofilerThreadAttachAttempted = b; }
-   void processWorkingQueue();
+   void processWorkingQueue(uint32_t threadId);
    bool getAttachAttempted() const { return _iprofilerThreadAttachAttempted; }
-   IProfilerBuffer *getCrtProfilingBuffer() const { return _crtProfilingBuffer; }
-   void setCrtProfilingBuffer(IProfilerBuffer *b) { _crtProfilingBuffer = b; }
+   // Returns true for the last IProfiler thread to exit; must be called with the iprofilerMonitor in hand
+   bool decNumActiveIProfilerThreads() { return --_numActiveIProfilerThreads == 0; }
+   void freeStopRequest();
    void setIProfilerThreadExitFlag() { _iprofilerThreadExitFlag = 1; }
    void jitProfileParseBuffer(J9VMThread *vmThread);
    uint32_t getIProfilerThreadExitFlag() { return _iprofilerThreadExitFlag; }
@@ -601,7 +618,7 @@ public:
    uintptr_t getSearchPC (TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation *);
    static uintptr_t getSearchPCFromMethodAndBCIndex(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex);
    static uintptr_t getSearchPCFromMethodAndBCIndex(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation * comp);
-   virtual TR_IPBytecodeHashTableEntry *searchForSample(uintptr_t pc, int32_t bucket);
+   virtual TR_IPBytecodeHashTableEntry *searchForSample(uintptr_t pc);
    virtual TR_IPMethodHashTableEntry *searchForMethodSample(TR_OpaqueMethodBlock *omb, int32_t bucket);
 
 protected:
@@ -638,7 +655,9 @@ private:
 
    TR_IPBCDataStorageHeader *getJ9SharedDataDescriptorForMethod(J9SharedDataDescriptor * descriptor, unsigned char * buffer, uint32_t length, TR_OpaqueMethodBlock * method, TR::Compilation *comp);
 
-   static int32_t bcHash (uintptr_t);
+   static uint32_t bcHash (uintptr_t pc, uint32_t tableSize);
+   static TR_IPBytecodeHashTableBuckets *allocateBCHashTableBuckets(uint32_t size);
+   void growBCHashTable();
    static int32_t allocHash (uintptr_t);
 
    static int32_t methodHash(uintptr_t pc);
@@ -654,7 +673,7 @@ private:
    TR_IPBCDataStorageHeader * persistentProfilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation *comp, bool *methodProfileExistsInSCC, TR_IPBCDataStorageHeader *store);
 
    TR_IPBCDataAllocation *profilingAllocSample (uintptr_t pc, uintptr_t data, bool addIt);
-   TR_IPBytecodeHashTableEntry *findOrCreateEntry (int32_t bucket, uintptr_t pc, bool addIt);
+   TR_IPBytecodeHashTableEntry *findOrCreateEntry (uintptr_t pc, bool addIt);
    TR_IPBCDataAllocation *findOrCreateAllocEntry (int32_t bucket, uintptr_t pc, bool addIt);
    TR_OpaqueMethodBlock * getMethodFromNode(TR::Node *node, TR::Compilation *comp);
    bool addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data, bool isRIData = false, uint32_t freq = 1);
@@ -691,8 +710,10 @@ private:
 
    // bytecode hashtable
    protected:
-   TR_IPBytecodeHashTableEntry   **_bcHashTable;
+   TR_IPBytecodeHashTableBuckets * volatile _bcHashTable;
    private:
+   uint32_t                        _numBCHashTableEntries; // updated under _hashTableMonitor
+   uint32_t                        _numBCHashTableGrowths;
 #if defined(EXPERIMENTAL_IPROFILER)
    // bytecode hashtable
    TR_IPBCDataAllocation         **_allocHashTable;
@@ -705,12 +726,14 @@ private:
    bool                            _enableCGProfiling;
    uint32_t                        _globalAllocationCount;
    int32_t                         _maxCallFrequency;
-   j9thread_t                      _iprofilerOSThread;
-   J9VMThread                     *_iprofilerThread;
+   j9thread_t                      _iprofilerOSThreads[MAX_IPROFILER_THREADS];
+   J9VMThread                     *_iprofilerThreads[MAX_IPROFILER_THREADS];
+   uint32_t                        _numIProfilerThreads; // threads that attached successfully
+   uint32_t                        _numActiveIProfilerThreads; // threads that did not exit yet; updated under _iprofilerMonitor
    TR_LinkHead0<IProfilerBuffer>   _freeBufferList;
    TR_LinkHead0<IProfilerBuffer>   _workingBufferList;
    IProfilerBuffer                *_workingBufferTail;
-   IProfilerBuffer                *_crtProfilingBuffer; // profiling buffer being processes by iprofiling thread
+   IProfilerBuffer                *_crtProfilingBuffers[MAX_IPROFILER_THREADS]; // profiling buffer being processed by each iprofiling thread
    TR::Monitor                    *_iprofilerMonitor;
    volatile int32_t                _numOutstandingBuffers;
    uint64_t                        _numRequests;
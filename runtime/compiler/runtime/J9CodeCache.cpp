@@ -93,6 +93,16 @@ J9::CodeCache::allocate(TR::CodeCacheManager *cacheManager, size_t segmentSize,
    }
 
 
+void
+J9::CodeCache::unreserve()
+   {
+   if (_manager->isHotCodeCache(self()))
+      _manager->releaseHotCodeCache(self());
+   else
+      self()->OMR::CodeCache::unreserve();
+   }
+
+
 bool
 J9::CodeCache::initialize(TR::CodeCacheManager *manager,
                           TR::CodeCacheMemorySegment *codeCacheSegment,
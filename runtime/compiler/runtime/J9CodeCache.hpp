@@ -68,6 +68,12 @@ public:
 
    static TR::CodeCache *     allocate(TR::CodeCacheManager *cacheManager, size_t segmentSize, int32_t reservingCompThreadID);
 
+   /**
+    * @brief Cancel the reservation of this code cache by a compilation.
+    *        The hot code cache is handed back to the code cache manager instead.
+    */
+   void                       unreserve();
+
    // Code Cache Reclamation
    void                       addFreeBlock(OMR::FaintCacheBlock *block);
 
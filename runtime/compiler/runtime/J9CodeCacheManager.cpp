@@ -23,6 +23,9 @@
 #include <algorithm>
 #include <stdlib.h>
 #include <string.h>
+#if defined(LINUX)
+#include <sys/mman.h>
+#endif /* defined(LINUX) */
 #include "j9.h"
 #include "j9protos.h"
 #include "j9thread.h"
@@ -229,6 +232,114 @@ J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCont
    return codeCache;
    }
 
+// Ask for transparent huge pages on the part of the hot code cache that can be backed by them.
+// Returns the number of bytes advised.
+static size_t
+adviseHugePagesForCodeCache(TR::CodeCache *codeCache)
+   {
+#if defined(LINUX) && defined(MADV_HUGEPAGE)
+   uintptr_t start = ((uintptr_t)codeCache->getCodeBase() + J9::CodeCacheManager::HOT_CODE_CACHE_HUGE_PAGE_SIZE - 1) & ~(J9::CodeCacheManager::HOT_CODE_CACHE_HUGE_PAGE_SIZE - 1);
+   uintptr_t end = (uintptr_t)codeCache->getCodeTop() & ~(J9::CodeCacheManager::HOT_CODE_CACHE_HUGE_PAGE_SIZE - 1);
+   if (start < end && 0 == madvise((void *)start, end - start, MADV_HUGEPAGE))
+      return end - start;
+#endif /* defined(LINUX) && defined(MADV_HUGEPAGE) */
+   return 0;
+   }
+
+TR::CodeCache *
+J9::CodeCacheManager::reserveHotCodeCache(int32_t compThreadID)
+   {
+   if (!TR::Options::getUseHotCodeCache())
+      return NULL;
+
+      {
+      CacheListCriticalSection reservingHotCodeCache(self());
+      if (_hotCodeCacheInUse)
+         return NULL;
+
+      if (_hotCodeCache)
+         {
+         // The hot code cache is parked; hand its reservation over to this compilation
+         _hotCodeCache->OMR::CodeCache::unreserve();
+         _hotCodeCache->reserve(compThreadID);
+         _hotCodeCacheInUse = true;
+         return _hotCodeCache;
+         }
+
+      if (!self()->canAddNewCodeCache())
+         return NULL;
+
+      // Other hot compilations use the regular code caches until the allocation completes
+      _hotCodeCacheInUse = true;
+      }
+
+   // The allocation must not be done while holding the code cache list mutex; see addCodeCache()
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   size_t segmentSize = config.codeCacheKB() << 10;
+   // Allow for aligning the code to the huge page size
+   if (TR::Options::getUseHugePagesForHotCodeCache())
+      segmentSize += HOT_CODE_CACHE_HUGE_PAGE_SIZE;
+   TR::CodeCache *codeCache = self()->allocateCodeCacheFromNewSegment(segmentSize, compThreadID);
+
+   size_t hugePageBytes = 0;
+   if (codeCache && TR::Options::getUseHugePagesForHotCodeCache())
+      hugePageBytes = adviseHugePagesForCodeCache(codeCache);
+
+      {
+      CacheListCriticalSection reservingHotCodeCache(self());
+      if (codeCache)
+         _hotCodeCache = codeCache;
+      else
+         _hotCodeCacheInUse = false;
+      }
+
+   if (codeCache && config.verboseCodeCache())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Allocated hot code cache %p [%p-%p], %" OMR_PRIuSIZE " bytes advised for huge pages",
+         codeCache, codeCache->getCodeBase(), codeCache->getCodeTop(), hugePageBytes);
+      }
+
+   return codeCache;
+   }
+
+bool
+J9::CodeCacheManager::isHotCodeCache(TR::CodeCache *codeCache)
+   {
+   // _hotCodeCache is set and cleared under the code cache list mutex by other compilation threads
+   CacheListCriticalSection checkingHotCodeCache(self());
+   return codeCache == _hotCodeCache;
+   }
+
+void
+J9::CodeCacheManager::releaseHotCodeCache(TR::CodeCache *codeCache)
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   bool retired = false;
+
+      {
+      CacheListCriticalSection releasingHotCodeCache(self());
+      codeCache->OMR::CodeCache::unreserve();
+      if (codeCache == _hotCodeCache)
+         {
+         _hotCodeCacheInUse = false;
+         if (codeCache->getFreeContiguousSpace() < config.lowCodeCacheThreshold())
+            {
+            // From now on this is a regular code cache, mostly used for trampolines and faint block reuse
+            _hotCodeCache = NULL;
+            retired = true;
+            }
+         else
+            {
+            // Park it: a reserved code cache is skipped by reserveCodeCache()
+            codeCache->reserve(HOT_CODE_CACHE_PARKED_ID);
+            }
+         }
+      }
+
+   if (retired && config.verboseCodeCache())
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Hot code cache %p is almost full and is now a regular code cache", codeCache);
+   }
+
 void
 J9::CodeCacheManager::reportCodeLoadEvents()
    {
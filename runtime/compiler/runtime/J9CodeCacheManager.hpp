@@ -53,7 +53,9 @@ class OMR_EXTENSIBLE CodeCacheManager : public OMR::CodeCacheManagerConnector
 public:
    CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator) :
       OMR::CodeCacheManagerConnector(rawAllocator),
-      _fe(fe)
+      _fe(fe),
+      _hotCodeCache(NULL),
+      _hotCodeCacheInUse(false)
       {
       _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
       }
@@ -90,6 +92,34 @@ public:
                                     int32_t compThreadID,
                                     int32_t *numReserved);
 
+   /**
+    * @brief Reserve the code cache dedicated to the code of hot and scorching compilations,
+    *        allocating it on first use (-XX:+JITHotCodeCache).
+    *
+    * Keeping recompiled hot bodies together, away from the many warm bodies, trampolines and
+    * faint blocks of the other code caches, reduces the number of iTLB entries and i-cache lines
+    * touched by the hottest code. Between hot compilations the hot code cache stays reserved so
+    * that reserveCodeCache() does not hand it to other compilations.
+    *
+    * @param[in] compThreadID : ID of the compilation thread reserving the code cache
+    *
+    * @return the hot code cache, or NULL if it is in use by another compilation or cannot be
+    *         allocated; the caller should then reserve any code cache with reserveCodeCache()
+    */
+   TR::CodeCache *reserveHotCodeCache(int32_t compThreadID);
+
+   /**
+    * @brief Release the hot code cache at the end of a compilation. The cache is parked
+    *        reserved again, or retired to a regular code cache if it is almost full, in which
+    *        case the next hot compilation allocates a new hot code cache.
+    */
+   void releaseHotCodeCache(TR::CodeCache *codeCache);
+
+   bool isHotCodeCache(TR::CodeCache *codeCache);
+
+   static const size_t HOT_CODE_CACHE_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+   static const int32_t HOT_CODE_CACHE_PARKED_ID = -1; // reserving compilation thread ID of the parked hot code cache
+
    TR::CodeCacheMemorySegment *setupMemorySegmentFromRepository(uint8_t *start,
                                                                 uint8_t *end,
                                                                 size_t & codeCacheSizeToAllocate);
@@ -154,6 +184,8 @@ public:
 
 private :
    TR_FrontEnd *_fe;
+   TR::CodeCache *_hotCodeCache;  // protected by the code cache list mutex
+   bool _hotCodeCacheInUse;       // reserved by a hot compilation, or being allocated
    static TR::CodeCacheManager *_codeCacheManager;
    static J9JITConfig *_jitConfig;
    static J9JavaVM *_javaVM;
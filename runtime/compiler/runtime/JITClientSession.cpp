@@ -412,7 +412,8 @@ ClientSessionData::ClassInfo::ClassInfo() :
    _fieldOrStaticDeclaringClassCache(decltype(_fieldOrStaticDeclaringClassCache)::allocator_type(TR::Compiler->persistentAllocator())),
    _fieldOrStaticDefiningClassCache(decltype(_fieldOrStaticDefiningClassCache)::allocator_type(TR::Compiler->persistentAllocator())),
    _J9MethodNameCache(decltype(_J9MethodNameCache)::allocator_type(TR::Compiler->persistentAllocator())),
-   _referencingClassLoaders(decltype(_referencingClassLoaders)::allocator_type(TR::Compiler->persistentAllocator()))
+   _referencingClassLoaders(decltype(_referencingClassLoaders)::allocator_type(TR::Compiler->persistentAllocator())),
+   _romClassHash(NULL)
    {
    }
 
@@ -424,6 +425,9 @@ ClientSessionData::ClassInfo::freeClassInfo(TR_PersistentMemory *persistentMemor
    // free cached _interfaces
    _interfaces->~PersistentVector<TR_OpaqueClassBlock *>();
    persistentMemory->freePersistentMemory(_interfaces);
+
+   if (_romClassHash)
+      persistentMemory->freePersistentMemory(_romClassHash);
    }
 
 ClientSessionData::VMInfo *
@@ -433,12 +437,21 @@ ClientSessionData::getOrCacheVMInfo(JITServer::ServerStream *stream)
       {
       stream->write(JITServer::MessageType::VM_getVMInfo, JITServer::Void());
       auto recv = stream->read<VMInfo, std::vector<CacheDescriptor> >();
-      _vmInfo = new (PERSISTENT_NEW) VMInfo(std::get<0>(recv));
-      _vmInfo->_j9SharedClassCacheDescriptorList = reconstructJ9SharedClassCacheDescriptorList(std::get<1>(recv));
+      cacheVMInfo(std::get<0>(recv), std::get<1>(recv));
       }
    return _vmInfo;
    }
 
+ClientSessionData::VMInfo *
+ClientSessionData::cacheVMInfo(const VMInfo &vmInfo, const std::vector<CacheDescriptor> &listOfCacheDescriptors)
+   {
+   if (_vmInfo)
+      return _vmInfo;
+   _vmInfo = new (PERSISTENT_NEW) VMInfo(vmInfo);
+   _vmInfo->_j9SharedClassCacheDescriptorList = reconstructJ9SharedClassCacheDescriptorList(listOfCacheDescriptors);
+   return _vmInfo;
+   }
+
 J9SharedClassCacheDescriptor *
 ClientSessionData::reconstructJ9SharedClassCacheDescriptorList(const std::vector<ClientSessionData::CacheDescriptor> &listOfCacheDescriptors)
    {
@@ -41,6 +41,7 @@ class TR_MethodToBeCompiled;
 class TR_AddressRange;
 class TR_PersistentCHTable;
 class JITServerPersistentCHTable;
+struct JITServerROMClassHash;
 namespace TR { class CompilationInfoPerThreadBase; }
 namespace JITServer { class ServerStream; }
 
@@ -216,6 +217,7 @@ public:
       PersistentUnorderedMap<int32_t, TR_OpaqueClassBlock *> _fieldOrStaticDefiningClassCache;
       PersistentUnorderedMap<int32_t, J9MethodNameAndSignature> _J9MethodNameCache; // key is a cpIndex
       PersistentUnorderedSet<J9ClassLoader *> _referencingClassLoaders;
+      JITServerROMClassHash *_romClassHash; // hash of _romClass, computed on first use when ROMClass sharing is disabled
       }; // struct ClassInfo
 
 
@@ -333,6 +335,8 @@ public:
    TR_IPBytecodeHashTableEntry *getCachedIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, bool *methodInfoPresent);
    bool cacheIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR_IPBytecodeHashTableEntry *entry, bool isCompiled);
    VMInfo *getOrCacheVMInfo(JITServer::ServerStream *stream);
+   VMInfo *cacheVMInfo(const VMInfo &vmInfo, const std::vector<CacheDescriptor> &listOfCacheDescriptors);
+   bool hasVMInfo() const { return _vmInfo != NULL; }
    void clearCaches(); // destroys _chTableClassMap, _romClassMap, _J9MethodMap and _unloadedClassAddresses
    bool cachesAreCleared() const { return _requestUnloadedClasses; }
    void setCachesAreCleared(bool b) { _requestUnloadedClasses = b; }
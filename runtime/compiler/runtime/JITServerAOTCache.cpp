@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <cctype>
+#include <cstdio>
 #include "control/CompilationRuntime.hpp"
 #include "env/StackMemoryRegion.hpp"
 #include "infra/CriticalSection.hpp"
@@ -42,6 +44,42 @@ AOTCacheRecord::free(void *ptr)
    TR::Compiler->persistentGlobalMemory()->freePersistentMemory(ptr);
    }
 
+bool
+AOTCacheRecord::isValidHeader(const AOTSerializationRecord &header, const JITServerAOTCacheReadContext &context,
+                              AOTSerializationRecordType type)
+   {
+   // Sub-record pointers are resolved separately, here we only check that the ID of the record itself is in range
+   return (header.type() == type) && (header.id() > 0) && (header.id() <= context.numRecords(type));
+   }
+
+template<class R> R *
+AOTCacheRecord::read(FILE *f, const JITServerAOTCacheReadContext &context)
+   {
+   typedef typename R::SerializationRecord SerializationRecord;
+
+   // Read the fixed-size part of the serialization record into a temporary buffer
+   // to validate it and determine the size of the whole record before allocating it
+   alignas(SerializationRecord) uint8_t buffer[sizeof(SerializationRecord)];
+   auto header = (const SerializationRecord *)buffer;
+   if ((fread(buffer, sizeof(buffer), 1, f) != 1) || !R::isValidHeader(*header, context))
+      return NULL;
+
+   R *record = new (AOTCacheRecord::allocate(R::size(*header))) R();
+   uint8_t *data = (uint8_t *)&record->_data;
+   memcpy(data, buffer, sizeof(buffer));
+
+   // Read the variable-sized part of the serialization record (if any) directly into the record
+   size_t variableSize = header->size() - sizeof(buffer);
+   if ((variableSize && (fread(data + sizeof(buffer), variableSize, 1, f) != 1)) ||
+       !record->setSubRecordPointers(context))
+      {
+      AOTCacheRecord::free(record);
+      return NULL;
+      }
+
+   return record;
+   }
+
 
 ClassLoaderSerializationRecord::ClassLoaderSerializationRecord(uintptr_t id, const uint8_t *name, size_t nameLength) :
    AOTSerializationRecord(size(nameLength), id, AOTSerializationRecordType::ClassLoader),
@@ -62,6 +100,15 @@ AOTCacheClassLoaderRecord::create(uintptr_t id, const uint8_t *name, size_t name
    return new (ptr) AOTCacheClassLoaderRecord(id, name, nameLength);
    }
 
+bool
+AOTCacheClassLoaderRecord::isValidHeader(const SerializationRecord &header,
+                                         const JITServerAOTCacheReadContext &context)
+   {
+   return AOTCacheRecord::isValidHeader(header, context, recordType()) &&
+          (header.nameLength() > 0) && (header.nameLength() <= header.size()) &&
+          (header.size() == ClassLoaderSerializationRecord::size(header.nameLength()));
+   }
+
 
 ClassSerializationRecord::ClassSerializationRecord(uintptr_t id, uintptr_t classLoaderId,
                                                    const JITServerROMClassHash &hash, const J9ROMClass *romClass) :
@@ -93,6 +140,22 @@ AOTCacheClassRecord::subRecordsDo(const std::function<void(const AOTCacheRecord
    f(_classLoaderRecord);
    }
 
+bool
+AOTCacheClassRecord::isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context)
+   {
+   return AOTCacheRecord::isValidHeader(header, context, recordType()) &&
+          (header.nameLength() <= header.size()) &&
+          (header.size() == ClassSerializationRecord::size(header.nameLength()));
+   }
+
+bool
+AOTCacheClassRecord::setSubRecordPointers(const JITServerAOTCacheReadContext &context)
+   {
+   _classLoaderRecord = (const AOTCacheClassLoaderRecord *)context.getRecord(
+      _data.classLoaderId(), AOTSerializationRecordType::ClassLoader);
+   return _classLoaderRecord != NULL;
+   }
+
 
 MethodSerializationRecord::MethodSerializationRecord(uintptr_t id, uintptr_t definingClassId, uint32_t index) :
    AOTSerializationRecord(sizeof(*this), id, AOTSerializationRecordType::Method),
@@ -120,6 +183,21 @@ AOTCacheMethodRecord::subRecordsDo(const std::function<void(const AOTCacheRecord
    f(_definingClassRecord);
    }
 
+bool
+AOTCacheMethodRecord::isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context)
+   {
+   return AOTCacheRecord::isValidHeader(header, context, recordType()) &&
+          (header.size() == sizeof(MethodSerializationRecord));
+   }
+
+bool
+AOTCacheMethodRecord::setSubRecordPointers(const JITServerAOTCacheReadContext &context)
+   {
+   _definingClassRecord = (const AOTCacheClassRecord *)context.getRecord(
+      _data.definingClassId(), AOTSerializationRecordType::Class);
+   return _definingClassRecord != NULL;
+   }
+
 
 template<class D, class R, typename... Args>
 AOTCacheListRecord<D, R, Args...>::AOTCacheListRecord(uintptr_t id, const R *const *records,
@@ -138,6 +216,28 @@ AOTCacheListRecord<D, R, Args...>::subRecordsDo(const std::function<void(const A
       f(records()[i]);
    }
 
+template<class D, class R, typename... Args> bool
+AOTCacheListRecord<D, R, Args...>::isValidHeader(const D &header, const JITServerAOTCacheReadContext &context,
+                                                 AOTSerializationRecordType type)
+   {
+   size_t length = header.list().length();
+   return AOTCacheRecord::isValidHeader(header, context, type) &&
+          (length <= header.size() / sizeof(uintptr_t)) && (header.size() == D::size(length));
+   }
+
+template<class D, class R, typename... Args> bool
+AOTCacheListRecord<D, R, Args...>::setSubRecordPointers(const JITServerAOTCacheReadContext &context)
+   {
+   for (size_t i = 0; i < _data.list().length(); ++i)
+      {
+      auto record = (const R *)context.getRecord(_data.list().ids()[i], R::recordType());
+      if (!record)
+         return false;
+      ((const R **)records())[i] = record;
+      }
+   return true;
+   }
+
 
 ClassChainSerializationRecord::ClassChainSerializationRecord(uintptr_t id, size_t length) :
    AOTSerializationRecord(size(length), id, AOTSerializationRecordType::ClassChain),
@@ -152,6 +252,13 @@ AOTCacheClassChainRecord::create(uintptr_t id, const AOTCacheClassRecord *const
    return new (ptr) AOTCacheClassChainRecord(id, records, length);
    }
 
+bool
+AOTCacheClassChainRecord::isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context)
+   {
+   // The first class in the chain is the class that the chain identifies; empty chains are invalid
+   return AOTCacheListRecord::isValidHeader(header, context, recordType()) && (header.list().length() > 0);
+   }
+
 
 WellKnownClassesSerializationRecord::WellKnownClassesSerializationRecord(uintptr_t id, size_t length,
                                                                          uintptr_t includedClasses) :
@@ -187,6 +294,13 @@ AOTCacheAOTHeaderRecord::create(uintptr_t id, const TR_AOTHeader *header)
    return new (ptr) AOTCacheAOTHeaderRecord(id, header);
    }
 
+bool
+AOTCacheAOTHeaderRecord::isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context)
+   {
+   return AOTCacheRecord::isValidHeader(header, context, recordType()) &&
+          (header.size() == sizeof(AOTHeaderSerializationRecord));
+   }
+
 
 SerializedAOTMethod::SerializedAOTMethod(uintptr_t definingClassChainId, uint32_t index,
                                          TR_Hotness optLevel, uintptr_t aotHeaderId, size_t numRecords,
@@ -227,6 +341,102 @@ CachedAOTMethod::create(const AOTCacheClassChainRecord *definingClassChainRecord
                                     records, code, codeSize, data, dataSize);
    }
 
+bool
+CachedAOTMethod::isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context)
+   {
+   // Check each of the sizes separately to guard against overflow when computing the total size
+   return (header.numRecords() <= header.size() / sizeof(SerializedSCCOffset)) &&
+          (header.codeSize() <= header.size()) && (header.dataSize() <= header.size()) &&
+          (header.size() == SerializedAOTMethod::size(header.numRecords(), header.codeSize(), header.dataSize())) &&
+          context.getRecord(header.definingClassChainId(), AOTSerializationRecordType::ClassChain) &&
+          context.getRecord(header.aotHeaderId(), AOTSerializationRecordType::AOTHeader);
+   }
+
+bool
+CachedAOTMethod::setSubRecordPointers(const JITServerAOTCacheReadContext &context)
+   {
+   _definingClassChainRecord = (const AOTCacheClassChainRecord *)context.getRecord(
+      _data.definingClassChainId(), AOTSerializationRecordType::ClassChain);
+
+   for (size_t i = 0; i < _data.numRecords(); ++i)
+      {
+      const SerializedSCCOffset &offset = _data.offsets()[i];
+      if ((offset.recordType() >= AOTSerializationRecordType::AOTHeader) ||
+          (offset.reloDataOffset() >= _data.dataSize()))
+         return false;
+
+      const AOTCacheRecord *record = context.getRecord(offset.recordId(), offset.recordType());
+      if (!record)
+         return false;
+      ((const AOTCacheRecord **)records())[i] = record;
+      }
+
+   return _definingClassChainRecord != NULL;
+   }
+
+
+bool
+JITServerAOTCacheSnapshotHeader::isValid(size_t fileSize) const
+   {
+   if ((_eyeCatcher != EYE_CATCHER) || (_snapshotVersion != SNAPSHOT_VERSION) ||
+       (strncmp(_jitBuildVersion, TR_BUILD_NAME, sizeof(_jitBuildVersion)) != 0))
+      return false;
+
+   // Each record occupies at least sizeof(AOTSerializationRecord) bytes in the file. Checking this bound
+   // prevents a corrupted header from making the reader allocate an arbitrarily large amount of memory.
+   size_t maxNumRecords = fileSize / sizeof(AOTSerializationRecord);
+   size_t totalNumRecords = 0;
+   for (size_t i = 0; i < AOTSerializationRecordType_MAX; ++i)
+      {
+      if (_numRecords[i] > maxNumRecords - totalNumRecords)
+         return false;
+      totalNumRecords += _numRecords[i];
+      }
+   return _numCachedMethods <= fileSize / sizeof(SerializedAOTMethod);
+   }
+
+
+JITServerAOTCacheReadContext::JITServerAOTCacheReadContext(const JITServerAOTCacheSnapshotHeader &header)
+   {
+   memset(_records, 0, sizeof(_records));
+   try
+      {
+      for (size_t i = 0; i < AOTSerializationRecordType_MAX; ++i)
+         {
+         _numRecords[i] = header._numRecords[i];
+         // Index 0 is unused since ID 0 is invalid
+         size_t size = (_numRecords[i] + 1) * sizeof(_records[i][0]);
+         _records[i] = (const AOTCacheRecord **)AOTCacheRecord::allocate(size);
+         memset(_records[i], 0, size);
+         }
+      }
+   catch (...)
+      {
+      this->~JITServerAOTCacheReadContext();
+      throw;
+      }
+   }
+
+JITServerAOTCacheReadContext::~JITServerAOTCacheReadContext()
+   {
+   for (size_t i = 0; i < AOTSerializationRecordType_MAX; ++i)
+      {
+      if (_records[i])
+         AOTCacheRecord::free(_records[i]);
+      }
+   }
+
+bool
+JITServerAOTCacheReadContext::addRecord(const AOTCacheRecord *record)
+   {
+   const AOTSerializationRecord *data = record->dataAddr();
+   const AOTCacheRecord *&entry = _records[data->type()][data->id()];
+   if (entry)
+      return false;
+   entry = record;
+   return true;
+   }
+
 
 bool
 JITServerAOTCache::ClassLoaderKey::operator==(const ClassLoaderKey &k) const
@@ -339,6 +549,51 @@ freeMapValues(const PersistentUnorderedMap<K, V *, H> &map)
       AOTCacheRecord::free(kv.second);
    }
 
+// Copy the values in the map into the vector while holding the monitor that protects the map
+template<typename K, typename V, typename H, typename T> static void
+copyMapValues(const PersistentUnorderedMap<K, V *, H> &map, TR::Monitor *monitor, PersistentVector<T> &values)
+   {
+   OMR::CriticalSection cs(monitor);
+   values.reserve(map.size());
+   for (auto &kv : map)
+      values.push_back(kv.second);
+   }
+
+// Read numRecords records of type V from a snapshot file into the map, using getKey(record) to compute the keys.
+// Returns false if a record could not be read or is a duplicate of an already existing record.
+template<typename K, typename V, typename H, typename F> static bool
+readRecords(FILE *f, JITServerAOTCacheReadContext &context, size_t numRecords,
+            PersistentUnorderedMap<K, V *, H> &map, F getKey)
+   {
+   for (size_t i = 0; i < numRecords; ++i)
+      {
+      V *record = AOTCacheRecord::read<V>(f, context);
+      if (!record)
+         return false;
+
+      K key = getKey(record);
+      if ((map.find(key) != map.end()) || !context.addRecord(record))
+         {
+         AOTCacheRecord::free(record);
+         return false;
+         }
+      addToMap(map, map.end(), key, record);
+      }
+   return true;
+   }
+
+static bool
+writeRecords(FILE *f, const PersistentVector<const AOTCacheRecord *> &records)
+   {
+   for (auto record : records)
+      {
+      const AOTSerializationRecord *data = record->dataAddr();
+      if (fwrite(data, data->size(), 1, f) != 1)
+         return false;
+      }
+   return true;
+   }
+
 
 JITServerAOTCache::JITServerAOTCache(const std::string &name) :
    _name(name),
@@ -361,7 +616,8 @@ JITServerAOTCache::JITServerAOTCache(const std::string &name) :
    _nextAOTHeaderId(1),// ID 0 is invalid
    _aotHeaderMonitor(TR::Monitor::create("JIT-JITServerAOTCacheAOTHeaderMonitor")),
    _cachedMethodMap(decltype(_cachedMethodMap)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
-   _cachedMethodMonitor(TR::Monitor::create("JIT-JITServerAOTCacheCachedMethodMonitor"))
+   _cachedMethodMonitor(TR::Monitor::create("JIT-JITServerAOTCacheCachedMethodMonitor")),
+   _numSavedMethods(0)
    {
    bool allMonitors = _classLoaderMonitor && _classMonitor && _methodMonitor &&
                       _classChainMonitor && _wellKnownClassesMonitor &&
@@ -662,11 +918,169 @@ JITServerAOTCache::addRecord(const AOTCacheRecord *record, Vector<const AOTSeria
    }
 
 
+size_t
+JITServerAOTCache::numCachedMethods() const
+   {
+   OMR::CriticalSection cs(_cachedMethodMonitor);
+   return _cachedMethodMap.size();
+   }
+
+bool
+JITServerAOTCache::writeCache(FILE *f) const
+   {
+   PersistentVector<const AOTCacheRecord *>::allocator_type allocator(TR::Compiler->persistentGlobalAllocator());
+   PersistentVector<const AOTCacheRecord *> classLoaderRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> classRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> methodRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> classChainRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> wellKnownClassesRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> aotHeaderRecords(allocator);
+   PersistentVector<const CachedAOTMethod *> cachedMethods(
+      PersistentVector<const CachedAOTMethod *>::allocator_type(TR::Compiler->persistentGlobalAllocator()));
+
+   // Records can only refer to records that were created before them, and records are never removed.
+   // Copying the maps in reverse dependency order guarantees that every record referred to by a record
+   // (or cached method) included in the snapshot is also included, even if the cache is concurrently
+   // updated. It also guarantees that the IDs of the records of each type are contiguous.
+   copyMapValues(_cachedMethodMap, _cachedMethodMonitor, cachedMethods);
+   copyMapValues(_aotHeaderMap, _aotHeaderMonitor, aotHeaderRecords);
+   copyMapValues(_wellKnownClassesMap, _wellKnownClassesMonitor, wellKnownClassesRecords);
+   copyMapValues(_classChainMap, _classChainMonitor, classChainRecords);
+   copyMapValues(_methodMap, _methodMonitor, methodRecords);
+   copyMapValues(_classMap, _classMonitor, classRecords);
+   copyMapValues(_classLoaderMap, _classLoaderMonitor, classLoaderRecords);
+
+   JITServerAOTCacheSnapshotHeader header;
+   memset(&header, 0, sizeof(header));
+   header._eyeCatcher = JITServerAOTCacheSnapshotHeader::EYE_CATCHER;
+   header._snapshotVersion = JITServerAOTCacheSnapshotHeader::SNAPSHOT_VERSION;
+   strncpy(header._jitBuildVersion, TR_BUILD_NAME, sizeof(header._jitBuildVersion) - 1);
+   header._serverUID = TR::CompilationInfo::get()->getPersistentInfo()->getServerUID();
+   header._numRecords[AOTSerializationRecordType::ClassLoader] = classLoaderRecords.size();
+   header._numRecords[AOTSerializationRecordType::Class] = classRecords.size();
+   header._numRecords[AOTSerializationRecordType::Method] = methodRecords.size();
+   header._numRecords[AOTSerializationRecordType::ClassChain] = classChainRecords.size();
+   header._numRecords[AOTSerializationRecordType::WellKnownClasses] = wellKnownClassesRecords.size();
+   header._numRecords[AOTSerializationRecordType::AOTHeader] = aotHeaderRecords.size();
+   header._numCachedMethods = cachedMethods.size();
+
+   // Records are written in dependency order so that the reader can resolve all sub-record IDs
+   if ((fwrite(&header, sizeof(header), 1, f) != 1) ||
+       !writeRecords(f, classLoaderRecords) || !writeRecords(f, classRecords) ||
+       !writeRecords(f, methodRecords) || !writeRecords(f, classChainRecords) ||
+       !writeRecords(f, wellKnownClassesRecords) || !writeRecords(f, aotHeaderRecords))
+      return false;
+
+   for (auto method : cachedMethods)
+      {
+      if (fwrite(&method->data(), method->data().size(), 1, f) != 1)
+         return false;
+      }
+
+   return true;
+   }
+
+bool
+JITServerAOTCache::readRecords(FILE *f, const JITServerAOTCacheSnapshotHeader &header,
+                               JITServerAOTCacheReadContext &context)
+   {
+   const size_t *numRecords = header._numRecords;
+
+   bool success =
+      ::readRecords(f, context, numRecords[AOTSerializationRecordType::ClassLoader], _classLoaderMap,
+         [](const AOTCacheClassLoaderRecord *r) { return ClassLoaderKey{ r->data().name(), r->data().nameLength() }; }) &&
+      ::readRecords(f, context, numRecords[AOTSerializationRecordType::Class], _classMap,
+         [](const AOTCacheClassRecord *r) { return ClassKey{ r->classLoaderRecord(), &r->data().hash() }; }) &&
+      ::readRecords(f, context, numRecords[AOTSerializationRecordType::Method], _methodMap,
+         [](const AOTCacheMethodRecord *r) { return MethodKey(r->definingClassRecord(), r->data().index()); }) &&
+      ::readRecords(f, context, numRecords[AOTSerializationRecordType::ClassChain], _classChainMap,
+         [](const AOTCacheClassChainRecord *r) { return ClassChainKey{ r->records(), r->data().list().length() }; }) &&
+      ::readRecords(f, context, numRecords[AOTSerializationRecordType::WellKnownClasses], _wellKnownClassesMap,
+         [](const AOTCacheWellKnownClassesRecord *r)
+            { return WellKnownClassesKey{ r->records(), r->data().list().length(), r->data().includedClasses() }; }) &&
+      ::readRecords(f, context, numRecords[AOTSerializationRecordType::AOTHeader], _aotHeaderMap,
+         [](const AOTCacheAOTHeaderRecord *r) { return AOTHeaderKey{ r->data().header() }; });
+   if (!success)
+      return false;
+
+   // Record IDs of each type are contiguous, and every ID has been read, so new records get the following IDs
+   _nextClassLoaderId = numRecords[AOTSerializationRecordType::ClassLoader] + 1;
+   _nextClassId = numRecords[AOTSerializationRecordType::Class] + 1;
+   _nextMethodId = numRecords[AOTSerializationRecordType::Method] + 1;
+   _nextClassChainId = numRecords[AOTSerializationRecordType::ClassChain] + 1;
+   _nextWellKnownClassesId = numRecords[AOTSerializationRecordType::WellKnownClasses] + 1;
+   _nextAOTHeaderId = numRecords[AOTSerializationRecordType::AOTHeader] + 1;
+
+   for (size_t i = 0; i < header._numCachedMethods; ++i)
+      {
+      CachedAOTMethod *method = AOTCacheRecord::read<CachedAOTMethod>(f, context);
+      if (!method)
+         return false;
+
+      auto aotHeaderRecord = (const AOTCacheAOTHeaderRecord *)context.getRecord(
+         method->data().aotHeaderId(), AOTSerializationRecordType::AOTHeader);
+      CachedMethodKey key(method->definingClassChainRecord(), method->data().index(),
+                          method->data().optLevel(), aotHeaderRecord);
+      if (_cachedMethodMap.find(key) != _cachedMethodMap.end())
+         {
+         AOTCacheRecord::free(method);
+         return false;
+         }
+      addToMap(_cachedMethodMap, _cachedMethodMap.end(), key, method);
+      }
+
+   return true;
+   }
+
+JITServerAOTCache *
+JITServerAOTCache::readCache(FILE *f, const std::string &name)
+   {
+   // Determine the file size to validate the record counts in the header
+   if (fseek(f, 0, SEEK_END) != 0)
+      return NULL;
+   long fileSize = ftell(f);
+   if ((fileSize < 0) || (fseek(f, 0, SEEK_SET) != 0))
+      return NULL;
+
+   JITServerAOTCacheSnapshotHeader header;
+   if ((fread(&header, sizeof(header), 1, f) != 1) || !header.isValid((size_t)fileSize))
+      return NULL;
+
+   auto cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+   if (!cache)
+      throw std::bad_alloc();
+
+   bool success = false;
+   try
+      {
+      JITServerAOTCacheReadContext context(header);
+      success = cache->readRecords(f, header, context);
+      }
+   catch (...)
+      {
+      cache->~JITServerAOTCache();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
+      throw;
+      }
+
+   if (!success)
+      {
+      cache->~JITServerAOTCache();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
+      return NULL;
+      }
+
+   cache->_numSavedMethods = cache->_cachedMethodMap.size();
+   return cache;
+   }
+
+
 JITServerAOTCacheMap::JITServerAOTCacheMap() :
    _map(decltype(_map)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
-   _monitor(TR::Monitor::create("JIT-JITServerAOTCacheMapMonitor"))
+   _monitor(TR::Monitor::create("JIT-JITServerAOTCacheMapMonitor")),
+   _saveMonitor(TR::Monitor::create("JIT-JITServerAOTCacheSaveMonitor"))
    {
-   if (!_monitor)
+   if (!_monitor || !_saveMonitor)
       throw std::bad_alloc();
    }
 
@@ -678,6 +1092,7 @@ JITServerAOTCacheMap::~JITServerAOTCacheMap()
       TR::Compiler->persistentGlobalMemory()->freePersistentMemory(kv.second);
       }
    TR::Monitor::destroy(_monitor);
+   TR::Monitor::destroy(_saveMonitor);
    }
 
 
@@ -690,14 +1105,24 @@ JITServerAOTCacheMap::get(const std::string &name, uint64_t clientUID)
    if (it != _map.end())
       {
       if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Created AOT cache %s for clientUID %llu",
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Using existing AOT cache %s for clientUID %llu",
                                         name.c_str(), (unsigned long long)clientUID);
       return it->second;
       }
 
-   auto cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+   //NOTE: The snapshot is loaded while holding the map monitor, so requests for other caches
+   //      that are not yet in the map wait for it. This only happens once for each cache name.
+   JITServerAOTCache *cache = NULL;
+   if (TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCachePersistence())
+      cache = loadCache(name);
+
+   bool loaded = (cache != NULL);
    if (!cache)
-      throw std::bad_alloc();
+      {
+      cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+      if (!cache)
+         throw std::bad_alloc();
+      }
 
    try
       {
@@ -711,7 +1136,147 @@ JITServerAOTCacheMap::get(const std::string &name, uint64_t clientUID)
       }
 
    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Using existing AOT cache %s for clientUID %llu",
-                                     name.c_str(), (unsigned long long)clientUID);
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "%s AOT cache %s for clientUID %llu",
+                                     loaded ? "Loaded" : "Created", name.c_str(), (unsigned long long)clientUID);
    return cache;
    }
+
+
+bool
+JITServerAOTCacheMap::getSnapshotFileName(const std::string &cacheName, std::string &fileName) const
+   {
+   // Cache names are provided by clients; only allow characters that are safe to use in a file name
+   for (char c : cacheName)
+      {
+      if (!isalnum((unsigned char)c) && (c != '_') && (c != '-') && (c != '.'))
+         return false;
+      }
+
+   const std::string &dir = TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCacheDir();
+   fileName = (dir.empty() ? std::string(".") : dir) + "/JITServerAOTCache." + cacheName + ".J9";
+   return true;
+   }
+
+JITServerAOTCache *
+JITServerAOTCacheMap::loadCache(const std::string &name)
+   {
+   std::string fileName;
+   if (!getSnapshotFileName(name, fileName))
+      {
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+            "AOT cache %s: name cannot be used for a snapshot file, persistence disabled for this cache", name.c_str());
+      return NULL;
+      }
+
+   FILE *f = fopen(fileName.c_str(), "rb");
+   if (!f)
+      return NULL;
+
+   JITServerAOTCache *cache = NULL;
+   try
+      {
+      cache = JITServerAOTCache::readCache(f, name);
+      }
+   catch (const std::bad_alloc &)
+      {
+      // Fall back to creating an empty cache
+      }
+   fclose(f);
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      {
+      if (cache)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: loaded %zu methods from snapshot file %s",
+                                        name.c_str(), cache->numCachedMethods(), fileName.c_str());
+      else
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: ignoring invalid snapshot file %s",
+                                        name.c_str(), fileName.c_str());
+      }
+
+   return cache;
+   }
+
+bool
+JITServerAOTCacheMap::saveCache(JITServerAOTCache *cache)
+   {
+   // Only re-write the snapshot if new methods were added to the cache since it was last saved
+   size_t numMethods = cache->numCachedMethods();
+   if (numMethods == cache->getNumSavedMethods())
+      return true;
+
+   std::string fileName;
+   if (!getSnapshotFileName(cache->name(), fileName))
+      return false;
+
+   // Write the snapshot into a temporary file and atomically replace the old snapshot with it,
+   // so that a crash while saving the cache cannot leave a truncated snapshot file behind
+   std::string tmpFileName = fileName + ".tmp";
+   FILE *f = fopen(tmpFileName.c_str(), "wb");
+   if (!f)
+      {
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "ERROR: AOT cache %s: failed to open snapshot file %s",
+                                        cache->name().c_str(), tmpFileName.c_str());
+      return false;
+      }
+
+   bool success = false;
+   try
+      {
+      success = cache->writeCache(f);
+      }
+   catch (const std::bad_alloc &)
+      {
+      }
+   success = (fclose(f) == 0) && success;
+   success = success && (rename(tmpFileName.c_str(), fileName.c_str()) == 0);
+
+   if (success)
+      {
+      cache->setNumSavedMethods(numMethods);
+      }
+   else
+      {
+      remove(tmpFileName.c_str());
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      {
+      if (success)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: saved %zu methods to snapshot file %s",
+                                        cache->name().c_str(), numMethods, fileName.c_str());
+      else
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "ERROR: AOT cache %s: failed to save snapshot file %s",
+                                        cache->name().c_str(), fileName.c_str());
+      }
+
+   return success;
+   }
+
+void
+JITServerAOTCacheMap::saveCaches()
+   {
+   if (!TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCachePersistence())
+      return;
+
+   OMR::CriticalSection cs(_saveMonitor);
+
+   // Caches are never removed from the map, so they can be saved without holding the map monitor
+   PersistentVector<JITServerAOTCache *> caches(
+      PersistentVector<JITServerAOTCache *>::allocator_type(TR::Compiler->persistentGlobalAllocator()));
+   try
+      {
+      OMR::CriticalSection mapCS(_monitor);
+      caches.reserve(_map.size());
+      for (auto &kv : _map)
+         caches.push_back(kv.second);
+      }
+   catch (const std::bad_alloc &)
+      {
+      return;
+      }
+
+   for (auto cache : caches)
+      saveCache(cache);
+   }
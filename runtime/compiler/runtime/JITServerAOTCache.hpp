@@ -23,6 +23,7 @@
 #ifndef JITSERVER_AOTCACHE_H
 #define JITSERVER_AOTCACHE_H
 
+#include <cstdio>
 #include <functional>
 
 #include "env/TRMemory.hpp"
@@ -30,6 +31,7 @@
 #include "runtime/JITServerAOTSerializationRecords.hpp"
 
 namespace TR { class Monitor; }
+class JITServerAOTCacheReadContext;
 
 
 // Base class for serialization record "wrappers" stored at the server.
@@ -64,8 +66,17 @@ public:
    static void *allocate(size_t size);
    static void free(void *ptr);
 
+   // Reads a record of type R (an AOTCacheRecord subclass or CachedAOTMethod) from an AOT cache snapshot file.
+   // Sub-record IDs are resolved into pointers to the records that were already read into the context.
+   // Returns NULL if the record could not be read or is invalid.
+   template<class R> static R *read(FILE *f, const JITServerAOTCacheReadContext &context);
+
 protected:
    AOTCacheRecord() = default;
+
+   // Checks the ID and type of a record header read from a snapshot file
+   static bool isValidHeader(const AOTSerializationRecord &header, const JITServerAOTCacheReadContext &context,
+                             AOTSerializationRecordType type);
    };
 
 
@@ -76,16 +87,25 @@ public:
    const AOTSerializationRecord *dataAddr() const override { return &_data; }
 
    static AOTCacheClassLoaderRecord *create(uintptr_t id, const uint8_t *name, size_t nameLength);
+   static AOTSerializationRecordType recordType() { return AOTSerializationRecordType::ClassLoader; }
 
 private:
+   friend class AOTCacheRecord;
+   using SerializationRecord = ClassLoaderSerializationRecord;
+
    AOTCacheClassLoaderRecord(uintptr_t id, const uint8_t *name, size_t nameLength);
+   AOTCacheClassLoaderRecord() { }
 
    static size_t size(size_t nameLength)
       {
       return offsetof(AOTCacheClassLoaderRecord, _data) + ClassLoaderSerializationRecord::size(nameLength);
       }
 
-   const ClassLoaderSerializationRecord _data;
+   static bool isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context);
+   static size_t size(const SerializationRecord &header) { return size(header.nameLength()); }
+   bool setSubRecordPointers(const JITServerAOTCacheReadContext &context) { return true; }
+
+   ClassLoaderSerializationRecord _data;
    };
 
 
@@ -98,19 +118,28 @@ public:
 
    static AOTCacheClassRecord *create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
                                       const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   static AOTSerializationRecordType recordType() { return AOTSerializationRecordType::Class; }
    void subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const override;
 
 private:
+   friend class AOTCacheRecord;
+   using SerializationRecord = ClassSerializationRecord;
+
    AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
                        const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   AOTCacheClassRecord() : _classLoaderRecord(NULL) { }
 
    static size_t size(size_t nameLength)
       {
       return offsetof(AOTCacheClassRecord, _data) + ClassSerializationRecord::size(nameLength);
       }
 
-   const AOTCacheClassLoaderRecord *const _classLoaderRecord;
-   const ClassSerializationRecord _data;
+   static bool isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context);
+   static size_t size(const SerializationRecord &header) { return size(header.nameLength()); }
+   bool setSubRecordPointers(const JITServerAOTCacheReadContext &context);
+
+   const AOTCacheClassLoaderRecord *_classLoaderRecord;
+   ClassSerializationRecord _data;
    };
 
 
@@ -122,13 +151,22 @@ public:
    const AOTSerializationRecord *dataAddr() const override { return &_data; }
 
    static AOTCacheMethodRecord *create(uintptr_t id, const AOTCacheClassRecord *definingClassRecord, uint32_t index);
+   static AOTSerializationRecordType recordType() { return AOTSerializationRecordType::Method; }
    void subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const override;
 
 private:
+   friend class AOTCacheRecord;
+   using SerializationRecord = MethodSerializationRecord;
+
    AOTCacheMethodRecord(uintptr_t id, const AOTCacheClassRecord *definingClassRecord, uint32_t index);
+   AOTCacheMethodRecord() : _definingClassRecord(NULL) { }
+
+   static bool isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context);
+   static size_t size(const SerializationRecord &header) { return sizeof(AOTCacheMethodRecord); }
+   bool setSubRecordPointers(const JITServerAOTCacheReadContext &context);
 
-   const AOTCacheClassRecord *const _definingClassRecord;
-   const MethodSerializationRecord _data;
+   const AOTCacheClassRecord *_definingClassRecord;
+   MethodSerializationRecord _data;
    };
 
 
@@ -144,13 +182,22 @@ public:
    void subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const override;
 
 protected:
+   friend class AOTCacheRecord;
+   using SerializationRecord = D;
+
    AOTCacheListRecord(uintptr_t id, const R *const *records, size_t length, Args... args);
+   AOTCacheListRecord() { }
 
    static size_t size(size_t length)
       {
       return offsetof(AOTCacheListRecord, _data) + D::size(length) + length * sizeof(R *);
       }
 
+   static bool isValidHeader(const D &header, const JITServerAOTCacheReadContext &context,
+                             AOTSerializationRecordType type);
+   static size_t size(const D &header) { return size(header.list().length()); }
+   bool setSubRecordPointers(const JITServerAOTCacheReadContext &context);
+
    D _data;
    // Array of record pointers is stored inline after serialization record data
    };
@@ -160,9 +207,14 @@ class AOTCacheClassChainRecord final : public AOTCacheListRecord<ClassChainSeria
    {
 public:
    static AOTCacheClassChainRecord *create(uintptr_t id, const AOTCacheClassRecord *const *records, size_t length);
+   static AOTSerializationRecordType recordType() { return AOTSerializationRecordType::ClassChain; }
 
 private:
+   friend class AOTCacheRecord;
    using AOTCacheListRecord::AOTCacheListRecord;
+   AOTCacheClassChainRecord() { }
+
+   static bool isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context);
    };
 
 
@@ -172,9 +224,17 @@ class AOTCacheWellKnownClassesRecord final :
 public:
    static AOTCacheWellKnownClassesRecord *create(uintptr_t id, const AOTCacheClassChainRecord *const *records,
                                                  size_t length, uintptr_t includedClasses);
+   static AOTSerializationRecordType recordType() { return AOTSerializationRecordType::WellKnownClasses; }
 
 private:
+   friend class AOTCacheRecord;
    using AOTCacheListRecord::AOTCacheListRecord;
+   AOTCacheWellKnownClassesRecord() { }
+
+   static bool isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context)
+      {
+      return AOTCacheListRecord::isValidHeader(header, context, recordType());
+      }
    };
 
 
@@ -185,11 +245,20 @@ public:
    const AOTSerializationRecord *dataAddr() const override { return &_data; }
 
    static AOTCacheAOTHeaderRecord *create(uintptr_t id, const TR_AOTHeader *header);
+   static AOTSerializationRecordType recordType() { return AOTSerializationRecordType::AOTHeader; }
 
 private:
+   friend class AOTCacheRecord;
+   using SerializationRecord = AOTHeaderSerializationRecord;
+
    AOTCacheAOTHeaderRecord(uintptr_t id, const TR_AOTHeader *header);
+   AOTCacheAOTHeaderRecord() { }
+
+   static bool isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context);
+   static size_t size(const SerializationRecord &header) { return sizeof(AOTCacheAOTHeaderRecord); }
+   bool setSubRecordPointers(const JITServerAOTCacheReadContext &context) { return true; }
 
-   const AOTHeaderSerializationRecord _data;
+   AOTHeaderSerializationRecord _data;
    };
 
 
@@ -214,10 +283,14 @@ public:
                                   const void *code, size_t codeSize, const void *data, size_t dataSize);
 
 private:
+   friend class AOTCacheRecord;
+   using SerializationRecord = SerializedAOTMethod;
+
    CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord, uint32_t index,
                    TR_Hotness optLevel, const AOTCacheAOTHeaderRecord *aotHeaderRecord,
                    const Vector<std::pair<const AOTCacheRecord *, uintptr_t>> &records,
                    const void *code, size_t codeSize, const void *data, size_t dataSize);
+   CachedAOTMethod() : _definingClassChainRecord(NULL) { }
 
    static size_t size(size_t numRecords, size_t codeSize, size_t dataSize)
       {
@@ -225,12 +298,67 @@ private:
              numRecords * sizeof(AOTCacheRecord *);
       }
 
-   const AOTCacheClassChainRecord *const _definingClassChainRecord;
+   static bool isValidHeader(const SerializationRecord &header, const JITServerAOTCacheReadContext &context);
+   static size_t size(const SerializationRecord &header)
+      {
+      return size(header.numRecords(), header.codeSize(), header.dataSize());
+      }
+   bool setSubRecordPointers(const JITServerAOTCacheReadContext &context);
+
+   const AOTCacheClassChainRecord *_definingClassChainRecord;
    SerializedAOTMethod _data;
    // Array of record pointers is stored inline after serialized AOT method data
    };
 
 
+// Header of an AOT cache snapshot file. The header is followed by the serialization records
+// of each type (in the order of AOTSerializationRecordType values, so that each record is read
+// after all of its sub-records), and then by the serialized AOT methods.
+struct JITServerAOTCacheSnapshotHeader
+   {
+   static const uint32_t EYE_CATCHER = 0x4341534A;// "JSAC"
+   // Must be incremented whenever the layout of the snapshot or of the records it contains changes
+   static const uint32_t SNAPSHOT_VERSION = 1;
+
+   // Returns false if the snapshot was created by a different build or the header is corrupted
+   bool isValid(size_t fileSize) const;
+
+   uint32_t _eyeCatcher;
+   uint32_t _snapshotVersion;
+   // Snapshots are only loaded by a server built from the same sources that created them
+   char _jitBuildVersion[64];
+   uint64_t _serverUID;
+   size_t _numRecords[AOTSerializationRecordType_MAX];
+   size_t _numCachedMethods;
+   };
+
+
+// Maps record IDs to the records that have been read from an AOT cache snapshot file so far.
+// Used to resolve IDs of sub-records into pointers while reading the snapshot.
+class JITServerAOTCacheReadContext
+   {
+public:
+   JITServerAOTCacheReadContext(const JITServerAOTCacheSnapshotHeader &header);
+   ~JITServerAOTCacheReadContext();
+
+   size_t numRecords(AOTSerializationRecordType type) const { return _numRecords[type]; }
+
+   // Returns NULL if the record with this ID and type does not exist (yet)
+   const AOTCacheRecord *getRecord(uintptr_t id, AOTSerializationRecordType type) const
+      {
+      return ((id > 0) && (id <= _numRecords[type])) ? _records[type][id] : NULL;
+      }
+
+   // Returns false if a record with the same ID and type was already added
+   bool addRecord(const AOTCacheRecord *record);
+
+private:
+   size_t _numRecords[AOTSerializationRecordType_MAX];
+   // Arrays of record pointers for each record type, indexed by record ID
+   const AOTCacheRecord **_records[AOTSerializationRecordType_MAX];
+   };
+
+
 // This class implements the storage of serialized AOT methods and their
 // serialization records at the JITServer. It is only used on the server side.
 // Each AOT cache instance is identified by a unique name and stores its own
@@ -283,6 +411,20 @@ public:
    Vector<const AOTSerializationRecord *>
    getSerializationRecords(const CachedAOTMethod *method, const KnownIdSet &knownIds, TR_Memory &trMemory) const;
 
+   size_t numCachedMethods() const;
+
+   // Write a snapshot of the current contents of the cache to the file.
+   // Concurrent additions to the cache are allowed; they may or may not be included in the snapshot.
+   // Returns false on I/O error.
+   bool writeCache(FILE *f) const;
+   // Create a new cache with the given name and the contents of the snapshot file.
+   // Returns NULL if the file is not a compatible snapshot or cannot be read.
+   static JITServerAOTCache *readCache(FILE *f, const std::string &name);
+
+   // Number of cached methods included in the last snapshot written for this cache
+   size_t getNumSavedMethods() const { return _numSavedMethods; }
+   void setNumSavedMethods(size_t n) { _numSavedMethods = n; }
+
 private:
    struct ClassLoaderKey
       {
@@ -340,6 +482,9 @@ private:
    void addRecord(const AOTCacheRecord *record, Vector<const AOTSerializationRecord *> &result,
                   UnorderedSet<const AOTCacheRecord *> &newRecords, const KnownIdSet &knownIds) const;
 
+   // Helper method used in readCache()
+   bool readRecords(FILE *f, const JITServerAOTCacheSnapshotHeader &header, JITServerAOTCacheReadContext &context);
+
    const std::string _name;
 
    PersistentUnorderedMap<ClassLoaderKey, AOTCacheClassLoaderRecord *, ClassLoaderKey::Hash> _classLoaderMap;
@@ -369,10 +514,18 @@ private:
 
    PersistentUnorderedMap<CachedMethodKey, CachedAOTMethod *> _cachedMethodMap;
    TR::Monitor *const _cachedMethodMonitor;
+
+   // Only accessed by the thread saving the cache to a snapshot file
+   size_t _numSavedMethods;
    };
 
 
-// Maps AOT cache names to JITServerAOTCache instances
+// Maps AOT cache names to JITServerAOTCache instances.
+//
+// If AOT cache persistence is enabled, each cache is stored in a snapshot file
+// in the configured directory. A cache is loaded from its snapshot file (if one exists)
+// the first time it is requested, and the snapshots of all caches that have new methods
+// are periodically re-written by the statistics thread and at server shutdown.
 class JITServerAOTCacheMap
    {
 public:
@@ -383,9 +536,20 @@ public:
 
    JITServerAOTCache *get(const std::string &name, uint64_t clientUID);
 
+   // Write snapshot files for all caches that have new methods since their last snapshot.
+   // Does nothing if AOT cache persistence is disabled.
+   void saveCaches();
+
 private:
+   // Returns false if the cache name cannot be used as part of a snapshot file name
+   bool getSnapshotFileName(const std::string &cacheName, std::string &fileName) const;
+   JITServerAOTCache *loadCache(const std::string &name);
+   bool saveCache(JITServerAOTCache *cache);
+
    PersistentUnorderedMap<std::string, JITServerAOTCache *> _map;
    TR::Monitor *const _monitor;
+   // Serializes saveCaches() calls from the statistics thread and the shutdown path
+   TR::Monitor *const _saveMonitor;
    };
 
 
@@ -94,6 +94,8 @@ public:
 protected:
    AOTSerializationRecord(size_t size, uintptr_t id, AOTSerializationRecordType type) :
       _size(size), _idAndType(idAndType(id, type)) { }
+   // Used when reading records from an AOT cache snapshot file; the actual contents are read into the record later
+   AOTSerializationRecord() : _size(0), _idAndType(0) { }
 
 private:
    static const uintptr_t idShift = 3;
@@ -115,6 +117,7 @@ private:
    friend class AOTCacheClassLoaderRecord;
 
    ClassLoaderSerializationRecord(uintptr_t id, const uint8_t *name, size_t nameLength);
+   ClassLoaderSerializationRecord() : _nameLength(0) { }
 
    static size_t size(size_t nameLength)
       {
@@ -141,6 +144,7 @@ private:
 
    ClassSerializationRecord(uintptr_t id, uintptr_t classLoaderId,
                             const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   ClassSerializationRecord() : _classLoaderId(0), _romClassSize(0), _nameLength(0) { }
 
    static size_t size(size_t nameLength)
       {
@@ -167,6 +171,7 @@ private:
    friend class AOTCacheMethodRecord;
 
    MethodSerializationRecord(uintptr_t id, uintptr_t definingClassId, uint32_t index);
+   MethodSerializationRecord() : _definingClassId(0), _index(0) { }
 
    const uintptr_t _definingClassId;
    // Index in the array of methods of the defining class
@@ -177,7 +182,7 @@ private:
 struct IdList
    {
 public:
-   IdList(size_t length) : _length(length) { }
+   IdList(size_t length = 0) : _length(length) { }
 
    size_t length() const { return _length; }
    const uintptr_t *ids() const { return _ids; }
@@ -200,6 +205,7 @@ private:
    template<class D, class R, typename... Args> friend class AOTCacheListRecord;
 
    ClassChainSerializationRecord(uintptr_t id, size_t length);
+   ClassChainSerializationRecord() { }
 
    IdList &list() { return _list; }
 
@@ -223,6 +229,7 @@ private:
    template<class D, class R, typename... Args> friend class AOTCacheListRecord;
 
    WellKnownClassesSerializationRecord(uintptr_t id, size_t length, uintptr_t includedClasses);
+   WellKnownClassesSerializationRecord() : _includedClasses(0) { }
 
    IdList &list() { return _list; }
 
@@ -247,6 +254,7 @@ private:
    friend class AOTCacheAOTHeaderRecord;
 
    AOTHeaderSerializationRecord(uintptr_t id, const TR_AOTHeader *header);
+   AOTHeaderSerializationRecord() : _header() { }
 
    const TR_AOTHeader _header;
    };
@@ -308,6 +316,9 @@ private:
    SerializedAOTMethod(uintptr_t definingClassChainId, uint32_t index,
                        TR_Hotness optLevel, uintptr_t aotHeaderId, size_t numRecords,
                        const void *code, size_t codeSize, const void *data, size_t dataSize);
+   SerializedAOTMethod() :
+      _size(0), _definingClassChainId(0), _index(0), _optLevel(noOpt),
+      _aotHeaderId(0), _numRecords(0), _codeSize(0), _dataSize(0) { }
 
    static size_t size(size_t numRecords, size_t codeSize, size_t dataSize)
       {
@@ -25,6 +25,8 @@
 #include "control/JITServerCompilationThread.hpp"
 #include "env/j9methodServer.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerSharedProfileCache.hpp"
+#include "runtime/JITServerSharedROMClassCache.hpp"
 #include "infra/CriticalSection.hpp" // for OMR::CriticalSection
 #include "ilgen/J9ByteCode.hpp"
 #include "ilgen/J9ByteCodeIterator.hpp"
@@ -43,7 +45,8 @@ JITServerIProfiler::allocate(J9JITConfig *jitConfig)
 
 JITServerIProfiler::JITServerIProfiler(J9JITConfig *jitConfig)
    : TR_IProfiler(jitConfig), _statsIProfilerInfoFromCache(0), _statsIProfilerInfoMsgToClient(0),
-   _statsIProfilerInfoReqNotCacheable(0), _statsIProfilerInfoIsEmpty(0), _statsIProfilerInfoCachingFailures(0)
+   _statsIProfilerInfoReqNotCacheable(0), _statsIProfilerInfoIsEmpty(0), _statsIProfilerInfoCachingFailures(0),
+   _statsIProfilerInfoFromSharedProfiles(0)
    {
    _useCaching = feGetEnv("TR_DisableIPCaching") ? false: true;
    }
@@ -199,36 +202,40 @@ JITServerIProfiler::profilingSample(TR_OpaqueMethodBlock *method, uint32_t byteC
 #if defined(DEBUG) || defined(PROD_WITH_ASSUMES)
          // sanity check
          // Ask the client again and see if the two sources of information match
-         auto stream = TR::CompilationInfo::getStream();
-         stream->write(JITServer::MessageType::IProfiler_profilingSample, method, byteCodeIndex, (uintptr_t)1);
-         auto recv = stream->read<std::string, bool, bool, bool>();
-         const std::string ipdata = std::get<0>(recv);
-         bool wholeMethod = std::get<1>(recv); // indicates whether the client has sent info for entire method
-         bool usePersistentCache = std::get<2>(recv);
-         bool isCompiled = std::get<3>(recv);
-         TR_ASSERT(!wholeMethod, "Client should not have sent whole method info");
-         uintptr_t methodStart = TR::Compiler->mtd.bytecodeStart(method);
-         TR_IPBCDataStorageHeader *clientData = ipdata.empty() ? NULL : (TR_IPBCDataStorageHeader *) &ipdata[0];
-         bool isMethodBeingCompiled = (method == comp->getMethodBeingCompiled()->getPersistentIdentifier());
-
-         if (!clientData && entry)
+         // Profiles aggregated from all clients legitimately differ from the client's own profile
+         if (!TR::CompilationInfo::get()->getJITServerSharedProfileCache())
             {
-            uint8_t bytecode = *((uint8_t*)(methodStart+byteCodeIndex));
-            fprintf(stderr, "Error cached IP data for method %p bcIndex %u bytecode=%x: ipdata is empty but we have a cached entry=%p\n", 
-               method, byteCodeIndex, bytecode, entry);
-            }
-            
-            bool isCompiledWhenProfiling = false;
-            if(!entryFromPerCompilationCache)
+            auto stream = TR::CompilationInfo::getStream();
+            stream->write(JITServer::MessageType::IProfiler_profilingSample, method, byteCodeIndex, (uintptr_t)1);
+            auto recv = stream->read<std::string, bool, bool, bool>();
+            const std::string ipdata = std::get<0>(recv);
+            bool wholeMethod = std::get<1>(recv); // indicates whether the client has sent info for entire method
+            bool usePersistentCache = std::get<2>(recv);
+            bool isCompiled = std::get<3>(recv);
+            TR_ASSERT(!wholeMethod, "Client should not have sent whole method info");
+            uintptr_t methodStart = TR::Compiler->mtd.bytecodeStart(method);
+            TR_IPBCDataStorageHeader *clientData = ipdata.empty() ? NULL : (TR_IPBCDataStorageHeader *) &ipdata[0];
+            bool isMethodBeingCompiled = (method == comp->getMethodBeingCompiled()->getPersistentIdentifier());
+
+            if (!clientData && entry)
                {
-               auto & j9methodMap = clientSessionData->getJ9MethodMap();
-               auto it = j9methodMap.find((J9Method*)method);
-               if (it != j9methodMap.end())
+               uint8_t bytecode = *((uint8_t*)(methodStart+byteCodeIndex));
+               fprintf(stderr, "Error cached IP data for method %p bcIndex %u bytecode=%x: ipdata is empty but we have a cached entry=%p\n", 
+                  method, byteCodeIndex, bytecode, entry);
+               }
+            
+               bool isCompiledWhenProfiling = false;
+               if(!entryFromPerCompilationCache)
                   {
-                  isCompiledWhenProfiling = it->second._isCompiledWhenProfiling;
+                  auto & j9methodMap = clientSessionData->getJ9MethodMap();
+                  auto it = j9methodMap.find((J9Method*)method);
+                  if (it != j9methodMap.end())
+                     {
+                     isCompiledWhenProfiling = it->second._isCompiledWhenProfiling;
+                     }
                   }
-               }
-         validateCachedIPEntry(entry, clientData, methodStart, isMethodBeingCompiled, method, entryFromPerCompilationCache, isCompiledWhenProfiling);
+            validateCachedIPEntry(entry, clientData, methodStart, isMethodBeingCompiled, method, entryFromPerCompilationCache, isCompiledWhenProfiling);
+            }
 #endif
          return entry; // could be NULL
          }
@@ -239,7 +246,7 @@ JITServerIProfiler::profilingSample(TR_OpaqueMethodBlock *method, uint32_t byteC
    auto stream = TR::CompilationInfo::getStream();
    stream->write(JITServer::MessageType::IProfiler_profilingSample, method, byteCodeIndex, (uintptr_t)(_useCaching ? 0 : 1));
    auto recv = stream->read<std::string, bool, bool, bool>();
-   const std::string ipdata = std::get<0>(recv);
+   std::string ipdata = std::get<0>(recv);
    bool wholeMethod = std::get<1>(recv); // indicates whether the client sent info for entire method
    bool usePersistentCache = std::get<2>(recv); // indicates whether info can be saved in persistent memory, or only in heap memory
    bool isCompiled = std::get<3>(recv);
@@ -248,6 +255,8 @@ JITServerIProfiler::profilingSample(TR_OpaqueMethodBlock *method, uint32_t byteC
    bool doCache = _useCaching && wholeMethod;
    if (!doCache)
       _statsIProfilerInfoReqNotCacheable++;
+   else if (TR::CompilationInfo::get()->getJITServerSharedProfileCache())
+      ipdata = shareMethodProfile(clientSessionData, method, ipdata, usePersistentCache);
   
    if (ipdata.empty()) // client didn't send us anything
       {
@@ -380,6 +389,84 @@ JITServerIProfiler::profilingSample(TR_OpaqueMethodBlock *method, uint32_t byteC
    return entry;
    }
 
+/**
+ * @brief Exchange the profile of a method with the profiles aggregated from all clients
+ *
+ * Contributes the profile sent by the client to the shared profile cache if it is stable
+ * and returns the profile to be used for the compilation: the client profile, possibly
+ * replaced or completed with aggregated data if the client has no profile for the method
+ * or is still in its startup phase.
+ *
+ * @param clientSessionData Session of the client that sent the profile
+ * @param method The method profiled
+ * @param clientData Serialized profile of the whole method sent by the client; may be empty
+ * @param isStable Whether the client profile is not going to grow further
+ * @return Serialized profile of the whole method
+ */
+std::string
+JITServerIProfiler::shareMethodProfile(ClientSessionData *clientSessionData, TR_OpaqueMethodBlock *method, const std::string &clientData, bool isStable)
+   {
+   // The key of the shared profile is the hash of the defining ROMClass and the index of the method in its class
+   J9ROMClass *romClass = NULL;
+   J9Class *ramClass = NULL;
+   uint32_t methodIndex = 0;
+   auto sharedROMClassCache = TR::CompilationInfo::get()->getJITServerSharedROMClassCache();
+   JITServerROMClassHash classHash;
+   bool haveClassHash = false;
+      {
+      OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+      auto &j9methodMap = clientSessionData->getJ9MethodMap();
+      auto methodIt = j9methodMap.find((J9Method *)method);
+      if (methodIt == j9methodMap.end())
+         return clientData;
+      auto &romClassMap = clientSessionData->getROMClassMap();
+      auto classIt = romClassMap.find((J9Class *)methodIt->second._owningClass);
+      if (classIt == romClassMap.end())
+         return clientData;
+      ramClass = classIt->first;
+      romClass = classIt->second._romClass;
+      methodIndex = (uint32_t)((J9Method *)method - classIt->second._methodsOfClass);
+      if (!sharedROMClassCache && classIt->second._romClassHash)
+         {
+         classHash = *classIt->second._romClassHash;
+         haveClassHash = true;
+         }
+      }
+
+   // The ROMClass cannot be freed during the compilation because we hold the class unload RW mutex
+   if (sharedROMClassCache)
+      {
+      classHash = sharedROMClassCache->getHash(romClass);
+      }
+   else if (!haveClassHash)
+      {
+      // Hashing the whole ROMClass is expensive, so do it once per class and outside of the monitor
+      classHash = JITServerROMClassHash(romClass);
+      OMR::CriticalSection cacheROMClassHash(clientSessionData->getROMMapMonitor());
+      auto &romClassMap = clientSessionData->getROMClassMap();
+      auto classIt = romClassMap.find(ramClass);
+      if (classIt != romClassMap.end() && !classIt->second._romClassHash)
+         {
+         void *storage = clientSessionData->persistentMemory()->allocatePersistentMemory(sizeof(JITServerROMClassHash));
+         if (storage)
+            classIt->second._romClassHash = new (storage) JITServerROMClassHash(classHash);
+         }
+      }
+
+   JITServerSharedProfileCache *sharedProfiles = TR::CompilationInfo::get()->getJITServerSharedProfileCache();
+   if (isStable)
+      sharedProfiles->addMethodProfile(classHash, methodIndex, clientData);
+
+   if (clientData.empty() || clientSessionData->isInStartupPhase())
+      {
+      std::string blendedData = sharedProfiles->blendMethodProfile(classHash, methodIndex, clientData);
+      if (blendedData != clientData)
+         _statsIProfilerInfoFromSharedProfiles++;
+      return blendedData;
+      }
+   return clientData;
+   }
+
 int32_t
 JITServerIProfiler::getMaxCallCount()
    {
@@ -399,6 +486,11 @@ JITServerIProfiler::printStats()
       j9tty_printf(PORTLIB, "IProfilerInfoCachingFailure: %6u\n", _statsIProfilerInfoCachingFailures);
       j9tty_printf(PORTLIB, "IProfilerInfoFromCache:   %6u\n", _statsIProfilerInfoFromCache);
       }
+   if (auto sharedProfiles = TR::CompilationInfo::get()->getJITServerSharedProfileCache())
+      {
+      j9tty_printf(PORTLIB, "IProfilerInfoFromSharedProfiles: %6u\n", _statsIProfilerInfoFromSharedProfiles);
+      sharedProfiles->printStats();
+      }
    }
 
 bool
@@ -29,6 +29,7 @@ namespace JITServer
 {
 class ClientStream;
 }
+class ClientSessionData;
 
 struct TR_ContiguousIPMethodData
    {
@@ -71,6 +72,10 @@ struct TR_ContiguousIPMethodHashTableEntry
  * object while the global IProfile cache is stored in `struct J9MethodInfo`
  * which is part of `ClientSessionData` (thus, the global cache is more like
  * a collection of caches, one for each method).
+ * With -XX:+JITServerShareProfiles, the profiles of compiled methods are also
+ * aggregated across clients in a JITServerSharedProfileCache, and a client that
+ * has no profile for a method, or is still in its startup phase, is compiled
+ * with the branch and switch profiles collected by the other clients.
  * As a RAS feature, caching can be disabled if the environment variable 
  * TR_DisableIPCaching is set.
  * Another RAS feature is the validation of the cached data. For a build with
@@ -111,6 +116,7 @@ protected:
    virtual bool invalidateEntryIfInconsistent(TR_IPBytecodeHashTableEntry *entry) override;
 
 private:
+   std::string shareMethodProfile(ClientSessionData *clientSessionData, TR_OpaqueMethodBlock *method, const std::string &clientData, bool isStable);
    void validateCachedIPEntry(TR_IPBytecodeHashTableEntry *entry, TR_IPBCDataStorageHeader *clientData, uintptr_t methodStart, bool isMethodBeingCompiled, TR_OpaqueMethodBlock *method, bool fromPerCompilationCache, bool isCompiledWhenProfiling);
    bool _useCaching;
    // Statistics
@@ -119,6 +125,7 @@ private:
    uint32_t _statsIProfilerInfoReqNotCacheable; // info returned from client should not be cached
    uint32_t _statsIProfilerInfoIsEmpty; // client has no IP info for indicated PC
    uint32_t _statsIProfilerInfoCachingFailures;
+   uint32_t _statsIProfilerInfoFromSharedProfiles; // client info was replaced or completed with info aggregated from all clients
    };
 
 /**
@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <algorithm>
+#include "control/CompilationRuntime.hpp"
+#include "control/Options.hpp"
+#include "env/CompilerEnv.hpp"
+#include "infra/CriticalSection.hpp"
+#include "runtime/JITServerSharedProfileCache.hpp"
+
+
+JITServerSharedProfileCache::MethodProfile::MethodProfile(uint64_t time) :
+   _bytecodes(decltype(_bytecodes)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
+   _lastDecayTime(time), _numContributions(0)
+   {
+   }
+
+
+JITServerSharedProfileCache::JITServerSharedProfileCache() :
+   _methodProfiles(decltype(_methodProfiles)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
+   _monitor(TR::Monitor::create("JIT-JITServerSharedProfileCacheMonitor")),
+   _numContributions(0), _numBlendedProfiles(0), _numDroppedProfiles(0)
+   {
+   if (!_monitor)
+      throw std::bad_alloc();
+   }
+
+JITServerSharedProfileCache::~JITServerSharedProfileCache()
+   {
+   for (auto &kv : _methodProfiles)
+      {
+      kv.second->~MethodProfile();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(kv.second);
+      }
+   TR::Monitor::destroy(_monitor);
+   }
+
+void
+JITServerSharedProfileCache::decay(MethodProfile *profile, uint64_t time)
+   {
+   uint64_t halfLife = (uint64_t)std::max(1, TR::Options::getSharedProfileHalfLife());
+   uint64_t numHalvings = (time - profile->_lastDecayTime) / halfLife;
+   if (numHalvings == 0)
+      return;
+
+   profile->_lastDecayTime += numHalvings * halfLife;
+   uint32_t shift = (uint32_t)std::min<uint64_t>(numHalvings, 63);
+   for (auto it = profile->_bytecodes.begin(); it != profile->_bytecodes.end();)
+      {
+      bool isEmpty = true;
+      for (size_t i = 0; i < SWITCH_DATA_COUNT; ++i)
+         {
+         it->second._counts[i] >>= shift;
+         if (it->second._counts[i])
+            isEmpty = false;
+         }
+      // Forget bytecodes whose counts decayed away, so that the client's own data is used for them
+      if (isEmpty)
+         it = profile->_bytecodes.erase(it);
+      else
+         ++it;
+      }
+   }
+
+void
+JITServerSharedProfileCache::addMethodProfile(const JITServerROMClassHash &classHash, uint32_t methodIndex, const std::string &clientData)
+   {
+   if (clientData.empty())
+      return;
+
+   uint64_t time = TR::CompilationInfo::get()->getPersistentInfo()->getElapsedTime();
+   Key key = { classHash, methodIndex };
+
+   OMR::CriticalSection cs(_monitor);
+
+   MethodProfile *profile = NULL;
+   auto it = _methodProfiles.find(key);
+   if (it != _methodProfiles.end())
+      {
+      profile = it->second;
+      decay(profile, time);
+      }
+   else
+      {
+      if (_methodProfiles.size() >= MAX_METHOD_PROFILES)
+         {
+         ++_numDroppedProfiles;
+         return;
+         }
+      profile = new (TR::Compiler->persistentGlobalMemory()) MethodProfile(time);
+      if (!profile)
+         return;
+      _methodProfiles.insert({ key, profile });
+      }
+
+   const char *bufferPtr = &clientData[0];
+   const TR_IPBCDataStorageHeader *storage = NULL;
+   do {
+      storage = (const TR_IPBCDataStorageHeader *)bufferPtr;
+      if (storage->ID == TR_IPBCD_FOUR_BYTES)
+         {
+         uint32_t data = ((const TR_IPBCDataFourBytesStorage *)storage)->data;
+         if (data != TR_IPBCDataFourBytes::IPROFILING_INVALID)
+            {
+            BytecodeProfile &bc = profile->_bytecodes[storage->pc]; // value initialized if new
+            bc._type = TR_IPBCD_FOUR_BYTES;
+            bc._counts[0] += data & 0xFFFF; // not taken
+            bc._counts[1] += data >> 16; // taken
+            }
+         }
+      else if (storage->ID == TR_IPBCD_EIGHT_WORDS)
+         {
+         const uint64_t *segments = ((const TR_IPBCDataEightWordsStorage *)storage)->data;
+         BytecodeProfile &bc = profile->_bytecodes[storage->pc];
+         bc._type = TR_IPBCD_EIGHT_WORDS;
+         for (size_t i = 0; i < SWITCH_DATA_COUNT; ++i)
+            {
+            uint32_t target = (uint32_t)(segments[i] >> 32);
+            uint32_t count = (uint32_t)segments[i];
+            size_t slot = SWITCH_DATA_COUNT - 1; // the last slot counts all the targets that do not have their own slot
+            if (i < SWITCH_DATA_COUNT - 1)
+               {
+               if (target == 0) // unused slot
+                  continue;
+               for (size_t j = 0; j < SWITCH_DATA_COUNT - 1; ++j)
+                  {
+                  if (bc._targets[j] == target || bc._targets[j] == 0)
+                     {
+                     bc._targets[j] = target;
+                     slot = j;
+                     break;
+                     }
+                  }
+               }
+            bc._counts[slot] += count;
+            }
+         }
+      bufferPtr += storage->left;
+      } while (storage->left != 0);
+
+   ++profile->_numContributions;
+   ++_numContributions;
+   }
+
+std::string
+JITServerSharedProfileCache::blendMethodProfile(const JITServerROMClassHash &classHash, uint32_t methodIndex, const std::string &clientData)
+   {
+   uint64_t time = TR::CompilationInfo::get()->getPersistentInfo()->getElapsedTime();
+   Key key = { classHash, methodIndex };
+
+   OMR::CriticalSection cs(_monitor);
+
+   auto it = _methodProfiles.find(key);
+   if (it == _methodProfiles.end())
+      return clientData;
+   MethodProfile *profile = it->second;
+   decay(profile, time);
+
+   std::string result;
+   result.reserve(clientData.size() + profile->_bytecodes.size() * sizeof(TR_IPBCDataEightWordsStorage));
+   size_t lastOffset = 0; // offset of the last entry in the result, which must be unlinked
+
+   // Keep the client entries that are not aggregated
+   if (!clientData.empty())
+      {
+      const char *bufferPtr = &clientData[0];
+      const TR_IPBCDataStorageHeader *storage = NULL;
+      do {
+         storage = (const TR_IPBCDataStorageHeader *)bufferPtr;
+         size_t size = storage->left ? storage->left : clientData.size() - (bufferPtr - &clientData[0]);
+         if (profile->_bytecodes.find(storage->pc) == profile->_bytecodes.end())
+            {
+            lastOffset = result.size();
+            result.append(bufferPtr, size);
+            ((TR_IPBCDataStorageHeader *)&result[lastOffset])->left = (uint32_t)size;
+            }
+         bufferPtr += storage->left;
+         } while (storage->left != 0);
+      }
+
+   // Append the aggregated entries, scaled down to the width of the IProfiler counters
+   for (const auto &kv : profile->_bytecodes)
+      {
+      const BytecodeProfile &bc = kv.second;
+      uint64_t maxCount = 0;
+      for (size_t i = 0; i < SWITCH_DATA_COUNT; ++i)
+         maxCount = std::max(maxCount, bc._counts[i]);
+
+      lastOffset = result.size();
+      if (bc._type == TR_IPBCD_FOUR_BYTES)
+         {
+         uint32_t shift = 0;
+         while ((maxCount >> shift) >= 0xFFFF) // 0xFFFF in either half makes the IProfiler halve the counts
+            ++shift;
+         TR_IPBCDataFourBytesStorage store = {};
+         store.header.ID = TR_IPBCD_FOUR_BYTES;
+         store.data = (uint32_t)((bc._counts[1] >> shift) << 16) | (uint32_t)(bc._counts[0] >> shift);
+         result.append((const char *)&store, sizeof(store));
+         }
+      else
+         {
+         uint32_t shift = 0;
+         while ((maxCount >> shift) >= 0xFFFFFFFF)
+            ++shift;
+         TR_IPBCDataEightWordsStorage store = {};
+         store.header.ID = TR_IPBCD_EIGHT_WORDS;
+         for (size_t i = 0; i < SWITCH_DATA_COUNT; ++i)
+            store.data[i] = ((uint64_t)bc._targets[i] << 32) | (bc._counts[i] >> shift);
+         result.append((const char *)&store, sizeof(store));
+         }
+      TR_IPBCDataStorageHeader *header = (TR_IPBCDataStorageHeader *)&result[lastOffset];
+      header->pc = kv.first;
+      header->left = (uint32_t)(result.size() - lastOffset);
+      }
+
+   if (!result.empty())
+      ((TR_IPBCDataStorageHeader *)&result[lastOffset])->left = 0; // Unlink the last entry
+   ++_numBlendedProfiles;
+   return result;
+   }
+
+void
+JITServerSharedProfileCache::printStats()
+   {
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   OMR::CriticalSection cs(_monitor);
+   j9tty_printf(PORTLIB, "SharedProfiles: methods=%6zu contributions=%6u blended=%6u dropped=%6u\n",
+                _methodProfiles.size(), _numContributions, _numBlendedProfiles, _numDroppedProfiles);
+   }
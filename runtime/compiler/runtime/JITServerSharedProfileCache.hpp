@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITSERVER_SHARED_PROFILE_CACHE_H
+#define JITSERVER_SHARED_PROFILE_CACHE_H
+
+#include <string>
+#include "env/TRMemory.hpp"
+#include "env/PersistentCollections.hpp"
+#include "infra/Monitor.hpp"
+#include "runtime/IProfiler.hpp"
+#include "runtime/JITServerROMClassHash.hpp"
+
+
+// Aggregates the IProfiler data that JITServer receives from all its clients,
+// so that a client that has not yet collected a profile for a method can be
+// compiled with the profile collected by other clients running the same code.
+//
+// Profiles are keyed by the hash of the ROMClass that defines the method and
+// by the index of the method in its class. Any change in the bytecodes of the
+// class changes the hash, so profiles of different versions of a class never mix.
+// Bytecode indices are only meaningful within a given ROMClass, which is why
+// they can be shared among clients while J9Method and J9Class pointers cannot.
+//
+// Only branch and switch profiles are aggregated. Call graph profiles record
+// client J9Class pointers for the receivers, which have no meaning for other clients.
+//
+// Counts decay exponentially with the half-life given by -Xjit:sharedProfileHalfLife
+// so that the aggregated profile follows changes in the behavior of the clients.
+class JITServerSharedProfileCache
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
+
+   JITServerSharedProfileCache();
+   ~JITServerSharedProfileCache();
+
+   // Add the profile of a method sent by a client, in the format produced by
+   // JITClientIProfiler::serializeIProfilerMethodEntries().
+   // Should only be called with profiles that are not going to grow further at the client
+   // (e.g. profiles of compiled methods), otherwise the samples would be counted several times.
+   void addMethodProfile(const JITServerROMClassHash &classHash, uint32_t methodIndex, const std::string &clientData);
+
+   // Return the client profile with its branch and switch entries replaced by the aggregated ones,
+   // in the same format. Entries that are not aggregated (call graph) are kept from the client data.
+   // Returns the client data unchanged if no aggregated profile exists for the method.
+   std::string blendMethodProfile(const JITServerROMClassHash &classHash, uint32_t methodIndex, const std::string &clientData);
+
+   void printStats();
+
+private:
+   struct Key
+      {
+      bool operator==(const Key &k) const { return (_methodIndex == k._methodIndex) && (_classHash == k._classHash); }
+
+      struct Hash
+         {
+         size_t operator()(const Key &k) const noexcept
+            {
+            return std::hash<JITServerROMClassHash>()(k._classHash) ^ k._methodIndex;
+            }
+         };
+
+      JITServerROMClassHash _classHash;
+      uint32_t _methodIndex;
+      };
+
+   // Aggregated counts for one bytecode, using the encoding of the IProfiler entries:
+   // for a branch, _counts[0] is the not-taken count and _counts[1] is the taken count;
+   // for a switch, _targets[i] and _counts[i] describe the first SWITCH_DATA_COUNT-1
+   // targets and _counts[SWITCH_DATA_COUNT-1] counts all the other targets
+   struct BytecodeProfile
+      {
+      uint32_t _type; // TR_IPBCD_FOUR_BYTES or TR_IPBCD_EIGHT_WORDS
+      uint32_t _targets[SWITCH_DATA_COUNT];
+      uint64_t _counts[SWITCH_DATA_COUNT];
+      };
+
+   struct MethodProfile
+      {
+      TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
+      MethodProfile(uint64_t time);
+
+      PersistentUnorderedMap<uint32_t, BytecodeProfile> _bytecodes; // key is the bytecode index
+      uint64_t _lastDecayTime; // ms
+      uint32_t _numContributions;
+      };
+
+   // Bound on the memory used by the cache; profiles of new methods are dropped once it is reached
+   static const size_t MAX_METHOD_PROFILES = 1 << 18;
+
+   // Must be called with _monitor in hand
+   void decay(MethodProfile *profile, uint64_t time);
+
+   PersistentUnorderedMap<Key, MethodProfile *, Key::Hash> _methodProfiles;
+   TR::Monitor *const _monitor;
+
+   // Statistics
+   uint32_t _numContributions;
+   uint32_t _numBlendedProfiles;
+   uint32_t _numDroppedProfiles;
+   };
+
+
+#endif /* JITSERVER_SHARED_PROFILE_CACHE_H */
@@ -22,10 +22,12 @@
 
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/JITClientSession.hpp" // for purgeOldDataIfNeeded()
+#include "runtime/JITServerAOTCache.hpp" // for saveCaches()
 #include "env/VMJ9.h" // for TR_JitPrivateConfig
 #include "env/VerboseLog.hpp"
 #include "control/CompilationRuntime.hpp" // for CompilatonInfo
 #include "control/JITServerCompilationThread.hpp"
+#include "net/ServerStream.hpp"
 
 JITServerStatisticsThread::JITServerStatisticsThread()
    : _statisticsThread(NULL), _statisticsThreadMonitor(NULL), _statisticsOSThread(NULL),
@@ -78,6 +80,7 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
    uint64_t lastStatsTime = crtTime;
    uint64_t lastPurgeTime = crtTime;
    uint64_t lastCpuUpdate = crtTime;
+   uint64_t lastAOTCacheSaveTime = crtTime;
    char timestamp[32];
 
    persistentInfo->setStartTime(crtTime);
@@ -102,6 +105,14 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
             compInfo->getClientSessionHT()->purgeOldDataIfNeeded();
             }     
 
+         // Periodically save AOT caches with new methods to their snapshot files
+         if ((crtTime - lastAOTCacheSaveTime) >= (uint64_t)TR::Options::_aotCachePersistenceSavePeriod)
+            {
+            lastAOTCacheSaveTime = crtTime;
+            if (auto aotCacheMap = compInfo->getJITServerAOTCacheMap())
+               aotCacheMap->saveCaches();
+            }
+
          // Print operational statistics to vlog if enabled
          CpuUtilization *cpuUtil = compInfo->getCpuUtil(); 
          if ((statsThreadObj->getStatisticsFrequency() != 0) && ((crtTime - lastStatsTime) > statsThreadObj->getStatisticsFrequency()))
@@ -125,6 +136,16 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
             TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Active compilation threads : %d",compInfo->getNumCompThreadsActive());
             if (TR::CompilationInfoPerThreadRemote::getNumClearedCaches() > 0)
                TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Number of times the clientSession caches are cleared: %d", TR::CompilationInfoPerThreadRemote::getNumClearedCaches());
+            uint64_t numCompsWithRoundTrips = JITServer::ServerStream::getNumCompilationsWithRoundTripStats();
+            if (numCompsWithRoundTrips > 0)
+               {
+               uint64_t numRoundTrips = JITServer::ServerStream::getTotalNumRoundTrips();
+               TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Round trips per compilation: %.1f (total %llu)",
+                  (double)numRoundTrips / numCompsWithRoundTrips, (unsigned long long)numRoundTrips);
+               if (numRoundTrips > 0)
+                  TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Average round trip wait time: %.1f usec",
+                     (double)JITServer::ServerStream::getTotalRoundTripWaitTimeUs() / numRoundTrips);
+               }
             bool incompleteInfo;
             TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Physical memory available: %llu MB", compInfo->computeAndCacheFreePhysicalMemory(incompleteInfo) >> 20);
             if (cpuUtil->isFunctional())
@@ -41,6 +41,7 @@
 #include "net/CommunicationStream.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "net/ServerStream.hpp"
+#include "net/SharedMemoryChannel.hpp"
 #include "runtime/CompileService.hpp"
 #include "runtime/Listener.hpp"
 
@@ -193,7 +194,7 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
 
    uint32_t port = info->getJITServerPort();
    uint32_t timeoutMs = info->getSocketTimeout();
-   struct pollfd pfd = {0};
+   struct pollfd pfds[2] = {{0}, {0}};
    int sockfd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
    if (sockfd < 0)
       {
@@ -231,8 +232,30 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
       exit(1);
       }
 
-   pfd.fd = sockfd;
-   pfd.events = POLLIN;
+   pfds[0].fd = sockfd;
+   pfds[0].events = POLLIN;
+   nfds_t numFds = 1;
+
+   // Clients running on the same host can connect through a Unix domain socket
+   // and exchange messages through shared memory. Encrypted connections always use TCP.
+   int unixSockfd = -1;
+   if (info->getJITServerUseSharedMemory() && !sslCtx)
+      {
+      const std::string &socketPath = info->getJITServerSharedMemorySocketPath();
+      unixSockfd = JITServer::SharedMemoryChannel::openListenSocket(socketPath);
+      if (unixSockfd >= 0)
+         {
+         pfds[1].fd = unixSockfd;
+         pfds[1].events = POLLIN;
+         numFds = 2;
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Accepting shared memory connections on %s", socketPath.c_str());
+         }
+      else if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         {
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Cannot listen on %s: errno=%d; shared memory connections are disabled", socketPath.c_str(), errno);
+         }
+      }
 
    while (!getListenerThreadExitFlag())
       {
@@ -241,7 +264,7 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
       socklen_t clilen = sizeof(cli_addr);
       int connfd = -1;
 
-      rc = poll(&pfd, 1, OPENJ9_LISTENER_POLL_TIMEOUT);
+      rc = poll(pfds, numFds, OPENJ9_LISTENER_POLL_TIMEOUT);
       if (getListenerThreadExitFlag()) // if we are exiting, no need to check poll() status
          {
          break;
@@ -262,49 +285,77 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
             exit(1);
             }
          }
-      else if (pfd.revents != POLLIN)
-         {
-         fprintf(stderr, "Unexpected event occurred during poll for new connection: revents=%d\n", pfd.revents);
-         exit(1);
-         }
-      do
+
+      for (nfds_t i = 0; (i < numFds) && !getListenerThreadExitFlag(); i++)
          {
-         /* at this stage we should have a valid request for new connection */
-         connfd = accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
-         if (connfd < 0)
+         if (0 == pfds[i].revents)
+            continue;
+         if (pfds[i].revents != POLLIN)
             {
-            if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
-               {
-               if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-                  {
-                  TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
-                  }
-               }
+            fprintf(stderr, "Unexpected event occurred during poll for new connection: revents=%d\n", pfds[i].revents);
+            exit(1);
             }
-         else
+         bool isSharedMemory = (pfds[i].fd == unixSockfd);
+         do
             {
-            struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
-            if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            /* at this stage we should have a valid request for new connection */
+            clilen = sizeof(cli_addr);
+            connfd = isSharedMemory ? accept(unixSockfd, NULL, NULL) : accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
+            if (connfd < 0)
                {
-               perror("Can't set option SO_RCVTIMEO on connfd socket");
-               exit(1);
+               if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
+                  {
+                  if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                     {
+                     TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
+                     }
+                  }
                }
-            if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            else
                {
-               perror("Can't set option SO_SNDTIMEO on connfd socket");
-               exit(1);
-               }
+               struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
+               if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+                  {
+                  perror("Can't set option SO_RCVTIMEO on connfd socket");
+                  exit(1);
+                  }
+               if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+                  {
+                  perror("Can't set option SO_SNDTIMEO on connfd socket");
+                  exit(1);
+                  }
 
-            BIO *bio = NULL;
-            if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
-               continue;
+               BIO *bio = NULL;
+               JITServer::SharedMemoryChannel *sharedMemory = NULL;
+               if (isSharedMemory)
+                  {
+                  sharedMemory = JITServer::SharedMemoryChannel::accept(connfd);
+                  if (!sharedMemory)
+                     {
+                     // The client falls back to TCP
+                     if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Shared memory handshake failed: errno=%d", errno);
+                     close(connfd);
+                     continue;
+                     }
+                  }
+               else if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
+                  {
+                  continue;
+                  }
 
-            JITServer::ServerStream *stream = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio);
-            compiler->compile(stream);
-            }
-         } while ((-1 != connfd) && !getListenerThreadExitFlag());
+               JITServer::ServerStream *stream = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio, sharedMemory);
+               compiler->compile(stream);
+               }
+            } while ((-1 != connfd) && !getListenerThreadExitFlag());
+         }
       }
 
+   if (unixSockfd >= 0)
+      {
+      close(unixSockfd);
+      unlink(info->getJITServerSharedMemorySocketPath().c_str());
+      }
    // The following piece of code will be executed only if the server shuts down properly
    close(sockfd);
    if (sslCtx)
@@ -684,6 +684,30 @@ void * getNextInlineRange(TR_MapIterator * i, UDATA * startOffset, UDATA * endOf
    return i->_currentInlineMap;
    }
 
+/*
+ * Iterate over the maps of a method body in PC order, returning for each map the range of
+ * code offsets it covers and its bytecode info. Returns 0 when there are no more maps.
+ */
+UDATA getFirstByteCodeInfoRange(TR_MapIterator * i, void * methodMetaData, UDATA * startOffset, UDATA * endOffset, I_32 * callerIndex, I_32 * byteCodeIndex)
+   {
+   initializeIterator(i, (J9TR_MethodMetaData *)methodMetaData);
+   return getNextByteCodeInfoRange(i, startOffset, endOffset, callerIndex, byteCodeIndex);
+   }
+
+UDATA getNextByteCodeInfoRange(TR_MapIterator * i, UDATA * startOffset, UDATA * endOffset, I_32 * callerIndex, I_32 * byteCodeIndex)
+   {
+   TR_ByteCodeInfo * byteCodeInfo;
+   if (!getNextMap(i, HAS_FOUR_BYTE_OFFSET(i->_methodMetaData)))
+      return 0;
+
+   byteCodeInfo = (TR_ByteCodeInfo *)getByteCodeInfoFromStackMap(i->_methodMetaData, i->_currentMap);
+   *startOffset = i->_rangeStartOffset;
+   *endOffset = i->_rangeEndOffset;
+   *callerIndex = byteCodeInfo->_callerIndex;
+   *byteCodeIndex = byteCodeInfo->_byteCodeIndex;
+   return 1;
+   }
+
 static VMINLINE J9JIT32BitExceptionTableEntry * getNext32BitExceptionDataField(J9JIT32BitExceptionTableEntry * handlerCursor, UDATA bytecodePCBytes)
    {
    return (J9JIT32BitExceptionTableEntry *) (((U_8 *) (handlerCursor + 1)) + bytecodePCBytes);
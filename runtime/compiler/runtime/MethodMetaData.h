@@ -39,6 +39,8 @@
 #define getStackAllocMapFromJitPC getStackAllocMapFromJitPCVerbose
 #define getFirstInlineRange getFirstInlineRangeVerbose
 #define getNextInlineRange getNextInlineRangeVerbose
+#define getFirstByteCodeInfoRange getFirstByteCodeInfoRangeVerbose
+#define getNextByteCodeInfoRange getNextByteCodeInfoRangeVerbose
 #define walkJITFrameSlotsForInternalPointers walkJITFrameSlotsForInternalPointersVerbose
 #define jitAddSpilledRegistersForDataResolve jitAddSpilledRegistersForDataResolveVerbose
 #define jitAddSpilledRegisters jitAddSpilledRegistersVerbose
@@ -247,6 +249,8 @@ void * jitGetInlinerMapFromPC(J9JavaVM * javaVM, J9JITExceptionTable * exception
 void jitGetMapsFromPC(J9JavaVM * javaVM, J9JITExceptionTable * exceptionTable, UDATA jitPC, void * * inlineMap, void * * stackMap);
 void * getFirstInlineRange(TR_MapIterator * i, void * methodMetaData, UDATA * startOffset, UDATA * endOffset);
 void * getNextInlineRange(TR_MapIterator * i, UDATA * startOffset, UDATA * endOffset);
+UDATA getFirstByteCodeInfoRange(TR_MapIterator * i, void * methodMetaData, UDATA * startOffset, UDATA * endOffset, I_32 * callerIndex, I_32 * byteCodeIndex);
+UDATA getNextByteCodeInfoRange(TR_MapIterator * i, UDATA * startOffset, UDATA * endOffset, I_32 * callerIndex, I_32 * byteCodeIndex);
 void walkJITFrameSlotsForInternalPointers(J9StackWalkState * walkState,  U_8 ** jitDescriptionCursor, UDATA * scanCursor, void *stackMap, J9JITStackAtlas *gcStackAtlas);
 void jitAddSpilledRegistersForDataResolve(J9StackWalkState * walkState);
 void jitAddSpilledRegisters(J9StackWalkState * walkState, void *stackMap);
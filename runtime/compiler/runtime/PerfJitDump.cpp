@@ -0,0 +1,429 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "runtime/PerfJitDump.hpp"
+
+#if defined(LINUX)
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
+#include "j9.h"
+#include "util_api.h"
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/VerboseLog.hpp"
+#include "env/jittypes.h"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "runtime/MethodMetaData.h"
+
+int TR_PerfJitDump::_fd = -1;
+void *TR_PerfJitDump::_marker = NULL;
+size_t TR_PerfJitDump::_markerSize = 0;
+uint64_t TR_PerfJitDump::_codeIndex = 0;
+TR::Monitor *TR_PerfJitDump::_monitor = NULL;
+bool TR_PerfJitDump::_initialized = false;
+
+#if defined(LINUX)
+static uint32_t
+elfMachine()
+   {
+#if defined(TR_HOST_X86) && defined(TR_HOST_64BIT)
+   return EM_X86_64;
+#elif defined(TR_HOST_X86)
+   return EM_386;
+#elif defined(TR_HOST_POWER) && defined(TR_HOST_64BIT)
+   return EM_PPC64;
+#elif defined(TR_HOST_POWER)
+   return EM_PPC;
+#elif defined(TR_HOST_S390)
+   return EM_S390;
+#elif defined(TR_HOST_ARM64)
+   return EM_AARCH64;
+#elif defined(TR_HOST_ARM)
+   return EM_ARM;
+#else
+   return EM_NONE;
+#endif
+   }
+#endif /* defined(LINUX) */
+
+void
+TR_PerfJitDump::initialize()
+   {
+#if defined(LINUX)
+   if (_initialized)
+      return;
+   _initialized = true;
+
+   _monitor = TR::Monitor::create("JIT-PerfJitDumpMonitor");
+   if (!_monitor)
+      return;
+
+   char fileName[64];
+   snprintf(fileName, sizeof(fileName), "/tmp/jit-%d.dump", (int)getpid());
+   // The file holds the code of the process, so only the owner may read it. It is always
+   // created anew: a file or link left in /tmp by a previous process with the same pid,
+   // or planted by another user, is removed rather than written through.
+   int flags = O_CREAT | O_EXCL | O_NOFOLLOW | O_RDWR;
+   int fd = open(fileName, flags, 0600);
+   if (fd < 0 && EEXIST == errno && 0 == unlink(fileName))
+      fd = open(fileName, flags, 0600);
+   if (fd < 0)
+      {
+      if (TR::Options::getVerboseOption(TR_VerboseCompFailure))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "WARNING: Cannot open perf jitdump file %s: %s", fileName, strerror(errno));
+      return;
+      }
+   _fd = fd;
+
+   FileHeader header;
+   memset(&header, 0, sizeof(header));
+   header._magic = JITDUMP_MAGIC;
+   header._version = JITDUMP_VERSION;
+   header._totalSize = sizeof(header);
+   header._elfMach = elfMachine();
+   header._pid = (uint32_t)getpid();
+   header._timestamp = timestamp();
+   header._flags = 0;
+   if (!writeBytes(&header, sizeof(header)))
+      return;
+
+   // perf record only sees the file if it is mapped executable: the mmap event carries its name
+   _markerSize = (size_t)sysconf(_SC_PAGESIZE);
+   _marker = mmap(NULL, _markerSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+   if (MAP_FAILED == _marker)
+      {
+      _marker = NULL;
+      if (TR::Options::getVerboseOption(TR_VerboseCompFailure))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "WARNING: Cannot map perf jitdump file %s: %s", fileName, strerror(errno));
+      close(fd);
+      _fd = -1;
+      }
+#endif /* defined(LINUX) */
+   }
+
+void
+TR_PerfJitDump::shutdown()
+   {
+#if defined(LINUX)
+   if (!isActive())
+      return;
+
+   OMR::CriticalSection closingJitDump(_monitor);
+   if (isActive())
+      {
+      RecordHeader header;
+      writeRecordHeader(&header, JIT_CODE_CLOSE, sizeof(header));
+      if (writeBytes(&header, sizeof(header)))
+         {
+         munmap(_marker, _markerSize);
+         close(_fd);
+         _fd = -1;
+         }
+      }
+#endif /* defined(LINUX) */
+   }
+
+void
+TR_PerfJitDump::codeLoad(J9VMThread *vmThread, J9JITExceptionTable *metaData, void *oldStartPC)
+   {
+#if defined(LINUX)
+   if (!isActive())
+      return;
+
+   J9JITConfig *jitConfig = vmThread->javaVM->jitConfig;
+   J9JITExceptionTable *oldMetaData = oldStartPC ? jitConfig->jitGetExceptionTableFromPC(vmThread, (UDATA)oldStartPC) : NULL;
+
+   OMR::CriticalSection writingJitDump(_monitor);
+
+   // The replaced body stays in place until it is reclaimed; threads already running it will keep doing so
+   if (oldMetaData && !(oldMetaData->flags & JIT_METADATA_IS_STUB))
+      {
+      writeCodeRange(jitConfig, oldMetaData, (uint8_t *)oldMetaData->startPC, (uint8_t *)oldMetaData->endWarmPC, "[recompiled]");
+      if (oldMetaData->startColdPC)
+         writeCodeRange(jitConfig, oldMetaData, (uint8_t *)oldMetaData->startColdPC, (uint8_t *)oldMetaData->endPC, "[recompiled]");
+      }
+
+   writeCodeRange(jitConfig, metaData, (uint8_t *)metaData->startPC, (uint8_t *)metaData->endWarmPC, NULL);
+   if (metaData->startColdPC)
+      writeCodeRange(jitConfig, metaData, (uint8_t *)metaData->startColdPC, (uint8_t *)metaData->endPC, NULL);
+#endif /* defined(LINUX) */
+   }
+
+void
+TR_PerfJitDump::codeReclaimed(J9JITConfig *jitConfig, J9JITExceptionTable *metaData, size_t bytesToSaveAtStart)
+   {
+#if defined(LINUX)
+   if (!isActive())
+      return;
+
+   OMR::CriticalSection writingJitDump(_monitor);
+
+   uint8_t *start = (uint8_t *)metaData->startPC + bytesToSaveAtStart;
+   if (start < (uint8_t *)metaData->endWarmPC)
+      writeCodeRange(jitConfig, metaData, start, (uint8_t *)metaData->endWarmPC, "[reclaimed]");
+   if (metaData->startColdPC)
+      writeCodeRange(jitConfig, metaData, (uint8_t *)metaData->startColdPC, (uint8_t *)metaData->endPC, "[reclaimed]");
+#endif /* defined(LINUX) */
+   }
+
+void
+TR_PerfJitDump::writeCodeRange(J9JITConfig *jitConfig, J9JITExceptionTable *metaData, uint8_t *start, uint8_t *end, const char *marker)
+   {
+   if (!isActive() || start >= end)
+      return;
+
+   // perf inject expects the debug info of a body to precede its load record
+   writeDebugInfo(jitConfig, metaData, start, end);
+   writeCodeLoad(metaData, start, end, marker);
+   }
+
+void
+TR_PerfJitDump::writeDebugInfo(J9JITConfig *jitConfig, J9JITExceptionTable *metaData, uint8_t *start, uint8_t *end)
+   {
+#if defined(LINUX)
+   if (!metaData->gcStackAtlas)
+      return;
+
+   J9JavaVM *javaVM = jitConfig->javaVM;
+   PORT_ACCESS_FROM_JAVAVM(javaVM);
+
+   size_t capacity = 4096;
+   size_t size = 0;
+   uint8_t *entries = (uint8_t *)j9mem_allocate_memory(capacity, J9MEM_CATEGORY_JIT);
+   if (!entries)
+      return;
+
+   uint64_t numEntries = 0;
+   J9Class *lastClass = NULL;
+   J9Method *lastMethod = NULL;
+   UDATA lastLineNumber = (UDATA)-1;
+   char fileName[512];
+   size_t fileNameLength = 0;
+   bool fileNameWritten = false;
+
+   // The line table has the granularity of the maps in the stack atlas: each map gives the
+   // bytecode info, including the inlined call site, for a range of instructions. Code inlined
+   // from another method is attributed to the source lines of the inlinee.
+   TR_MapIterator iterator;
+   UDATA startOffset = 0;
+   UDATA endOffset = 0;
+   I_32 callerIndex = -1;
+   I_32 byteCodeIndex = 0;
+   for (UDATA found = getFirstByteCodeInfoRange(&iterator, metaData, &startOffset, &endOffset, &callerIndex, &byteCodeIndex);
+        found;
+        found = getNextByteCodeInfoRange(&iterator, &startOffset, &endOffset, &callerIndex, &byteCodeIndex))
+      {
+      uint8_t *rangeStart = (uint8_t *)metaData->startPC + startOffset;
+      uint8_t *rangeEnd = (uint8_t *)metaData->startPC + endOffset + 1;
+      if (rangeEnd <= start || rangeStart >= end)
+         continue;
+
+      J9Method *method = metaData->ramMethod;
+      if (callerIndex >= 0)
+         {
+         method = (J9Method *)getInlinedMethod(getInlinedCallSiteArrayElement(metaData, callerIndex));
+         if (isUnloadedInlinedMethod(method))
+            continue;
+         }
+
+      UDATA lineNumber = getLineNumberForROMClass(javaVM, method, byteCodeIndex);
+      if ((UDATA)-1 == lineNumber)
+         continue;
+      if (method == lastMethod && lineNumber == lastLineNumber)
+         continue; // the previous entry covers this range as well
+      lastMethod = method;
+      lastLineNumber = lineNumber;
+
+      J9Class *clazz = J9_CLASS_FROM_METHOD(method);
+      if (clazz != lastClass)
+         {
+         // Prefix the source file with the package directory so that perf can find it under a source root
+         J9ROMClass *romClass = clazz->romClass;
+         J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+         J9UTF8 *sourceFile = getSourceFileNameForROMClass(javaVM, clazz->classLoader, romClass);
+         int length = 0;
+         if (sourceFile)
+            {
+            int packageLength = J9UTF8_LENGTH(className);
+            while (packageLength > 0 && '/' != J9UTF8_DATA(className)[packageLength - 1])
+               packageLength--;
+            length = snprintf(fileName, sizeof(fileName), "%.*s%.*s",
+               packageLength, J9UTF8_DATA(className), J9UTF8_LENGTH(sourceFile), J9UTF8_DATA(sourceFile));
+            }
+         else
+            {
+            length = snprintf(fileName, sizeof(fileName), "%.*s.java", J9UTF8_LENGTH(className), J9UTF8_DATA(className));
+            }
+         if (length < 0)
+            length = 0;
+         fileNameLength = OMR_MIN((size_t)length, sizeof(fileName) - 1);
+         lastClass = clazz;
+         fileNameWritten = false;
+         }
+
+      size_t entrySize = sizeof(DebugEntry) + (fileNameWritten ? 2 : fileNameLength + 1);
+      if (size + entrySize > capacity)
+         {
+         size_t newCapacity = OMR_MAX(2 * capacity, size + entrySize);
+         uint8_t *newEntries = (uint8_t *)j9mem_allocate_memory(newCapacity, J9MEM_CATEGORY_JIT);
+         if (!newEntries)
+            break;
+         memcpy(newEntries, entries, size);
+         j9mem_free_memory(entries);
+         entries = newEntries;
+         capacity = newCapacity;
+         }
+
+      DebugEntry entry;
+      entry._addr = (uint64_t)(uintptr_t)OMR_MAX(rangeStart, start);
+      entry._lineNumber = (int32_t)lineNumber;
+      entry._discriminator = 0;
+      memcpy(entries + size, &entry, sizeof(entry));
+      size += sizeof(entry);
+      if (fileNameWritten)
+         {
+         entries[size++] = 0xff;
+         entries[size++] = 0;
+         }
+      else
+         {
+         memcpy(entries + size, fileName, fileNameLength);
+         size += fileNameLength;
+         entries[size++] = 0;
+         fileNameWritten = true;
+         }
+      numEntries++;
+      }
+
+   if (numEntries > 0)
+      {
+      DebugInfoRecord record;
+      writeRecordHeader(&record._header, JIT_CODE_DEBUG_INFO, sizeof(record) + size);
+      record._codeAddr = (uint64_t)(uintptr_t)start;
+      record._numEntries = numEntries;
+      if (writeBytes(&record, sizeof(record)))
+         writeBytes(entries, size);
+      }
+
+   j9mem_free_memory(entries);
+#endif /* defined(LINUX) */
+   }
+
+void
+TR_PerfJitDump::writeCodeLoad(J9JITExceptionTable *metaData, uint8_t *start, uint8_t *end, const char *marker)
+   {
+#if defined(LINUX)
+   if (!isActive())
+      return;
+
+   // Same naming as the entries of the perf map file, with the cold section and the state of the body appended
+   bool isCold = metaData->startColdPC && start >= (uint8_t *)metaData->startColdPC;
+   char name[1024];
+   int nameLength = snprintf(name, sizeof(name), "%.*s.%.*s%.*s_%s%s%s%s",
+      J9UTF8_LENGTH(metaData->className), J9UTF8_DATA(metaData->className),
+      J9UTF8_LENGTH(metaData->methodName), J9UTF8_DATA(metaData->methodName),
+      J9UTF8_LENGTH(metaData->methodSignature), J9UTF8_DATA(metaData->methodSignature),
+      TR::Compilation::getHotnessName(TR_Hotness(metaData->hotness)),
+      isCold ? "_cold" : "",
+      marker ? " " : "",
+      marker ? marker : "");
+   if (nameLength < 0)
+      return;
+   nameLength = OMR_MIN(nameLength, (int)sizeof(name) - 1);
+
+   size_t codeSize = end - start;
+   CodeLoadRecord record;
+   writeRecordHeader(&record._header, JIT_CODE_LOAD, sizeof(record) + nameLength + 1 + codeSize);
+   record._pid = (uint32_t)getpid();
+   record._tid = (uint32_t)syscall(SYS_gettid);
+   record._vma = (uint64_t)(uintptr_t)start;
+   record._codeAddr = (uint64_t)(uintptr_t)start;
+   record._codeSize = codeSize;
+   record._codeIndex = _codeIndex++;
+
+   if (writeBytes(&record, sizeof(record)) && writeBytes(name, nameLength + 1))
+      writeBytes(start, codeSize);
+#endif /* defined(LINUX) */
+   }
+
+void
+TR_PerfJitDump::writeRecordHeader(RecordHeader *header, uint32_t id, size_t totalSize)
+   {
+   header->_id = id;
+   header->_totalSize = (uint32_t)totalSize;
+   header->_timestamp = timestamp();
+   }
+
+bool
+TR_PerfJitDump::writeBytes(const void *data, size_t size)
+   {
+#if defined(LINUX)
+   const uint8_t *cursor = (const uint8_t *)data;
+   while (size > 0)
+      {
+      ssize_t written = ::write(_fd, cursor, size);
+      if (written < 0)
+         {
+         if (EINTR == errno)
+            continue;
+         // The file now ends with a partial record; perf stops reading there, so stop writing
+         if (TR::Options::getVerboseOption(TR_VerboseCompFailure))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "WARNING: Failed to write perf jitdump file: %s", strerror(errno));
+         if (_marker)
+            munmap(_marker, _markerSize);
+         _marker = NULL;
+         close(_fd);
+         _fd = -1;
+         return false;
+         }
+      cursor += written;
+      size -= written;
+      }
+   return true;
+#else
+   return false;
+#endif /* defined(LINUX) */
+   }
+
+uint64_t
+TR_PerfJitDump::timestamp()
+   {
+#if defined(LINUX)
+   // Must match the clock used by "perf record -k mono"
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+   return 0;
+#endif /* defined(LINUX) */
+   }
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef PERF_JIT_DUMP_HPP
+#define PERF_JIT_DUMP_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace TR { class Monitor; }
+struct J9JITConfig;
+struct J9JITExceptionTable;
+struct J9VMThread;
+
+/**
+   @class TR_PerfJitDump
+   @brief Writer of the /tmp/jit-<pid>.dump file consumed by "perf inject --jit" on Linux
+
+   Unlike the flat /tmp/perf-<pid>.map file generated with -Xjit:perfTool, the jitdump file
+   contains a copy of the code of each method body and a line number table built from
+   the bytecode info of the GC/inline maps in the body's metadata, so perf can annotate
+   jitted code and attribute samples in inlined code to the source lines of the inlinee.
+
+   The jitdump format has no unload event. Instead, when a body is replaced by a recompilation
+   or its code cache space is reclaimed, the body is loaded again under a name marked with
+   "[recompiled]" or "[reclaimed]"; perf attributes later samples at these addresses to the
+   most recent load. The JIT never moves code, so no move events are generated.
+
+   Timestamps come from CLOCK_MONOTONIC, so the profile must be recorded with "perf record -k mono".
+
+   Enabled with -XX:+PerfJitDump. Records are written by compilation threads at the end
+   of a compilation and by the thread doing code cache reclamation, so all writes are
+   serialized with a monitor.
+*/
+class TR_PerfJitDump
+   {
+   public:
+   /**
+      @brief Create the jitdump file and write its header; does nothing if this was already attempted
+      Must be called while holding the compilation monitor.
+   */
+   static void initialize();
+
+   /**
+      @brief Write the close record and close the file. Called at shutdown after all compilation threads are stopped.
+   */
+   static void shutdown();
+
+   static bool isActive() { return _fd >= 0; }
+
+   /**
+      @brief Record a new method body, and mark the body it replaces (if any) as recompiled
+
+      @param [in] metaData Metadata of the new body
+      @param [in] oldStartPC Start PC of the replaced body, or NULL for a first time compilation
+   */
+   static void codeLoad(J9VMThread *vmThread, J9JITExceptionTable *metaData, void *oldStartPC);
+
+   /**
+      @brief Mark the code of a body as reclaimed before its code cache space is freed
+
+      @param [in] bytesToSaveAtStart Number of bytes at the start of the body that stay in place as a stub
+   */
+   static void codeReclaimed(J9JITConfig *jitConfig, J9JITExceptionTable *metaData, size_t bytesToSaveAtStart);
+
+   private:
+   // Record types defined by tools/perf/Documentation/jitdump-specification.txt
+   enum RecordType
+      {
+      JIT_CODE_LOAD = 0,
+      JIT_CODE_MOVE = 1,
+      JIT_CODE_DEBUG_INFO = 2,
+      JIT_CODE_CLOSE = 3,
+      };
+
+   struct FileHeader
+      {
+      uint32_t _magic;
+      uint32_t _version;
+      uint32_t _totalSize;
+      uint32_t _elfMach;
+      uint32_t _pad1;
+      uint32_t _pid;
+      uint64_t _timestamp;
+      uint64_t _flags;
+      };
+
+   struct RecordHeader
+      {
+      uint32_t _id;
+      uint32_t _totalSize;
+      uint64_t _timestamp;
+      };
+
+   struct CodeLoadRecord
+      {
+      RecordHeader _header;
+      uint32_t _pid;
+      uint32_t _tid;
+      uint64_t _vma;
+      uint64_t _codeAddr;
+      uint64_t _codeSize;
+      uint64_t _codeIndex;
+      // followed by the NUL terminated name and the code bytes
+      };
+
+   struct DebugInfoRecord
+      {
+      RecordHeader _header;
+      uint64_t _codeAddr;
+      uint64_t _numEntries;
+      // followed by the entries
+      };
+
+   struct DebugEntry
+      {
+      uint64_t _addr;
+      int32_t _lineNumber;
+      int32_t _discriminator;
+      // followed by the NUL terminated file name, or by "\xff\0" if it is the same as the previous entry
+      };
+
+   static const uint32_t JITDUMP_MAGIC = 0x4A695444; // "JiTD"
+   static const uint32_t JITDUMP_VERSION = 1;
+
+   static void writeCodeRange(J9JITConfig *jitConfig, J9JITExceptionTable *metaData, uint8_t *start, uint8_t *end, const char *marker);
+   static void writeDebugInfo(J9JITConfig *jitConfig, J9JITExceptionTable *metaData, uint8_t *start, uint8_t *end);
+   static void writeCodeLoad(J9JITExceptionTable *metaData, uint8_t *start, uint8_t *end, const char *marker);
+   static void writeRecordHeader(RecordHeader *header, uint32_t id, size_t totalSize);
+   static bool writeBytes(const void *data, size_t size);
+   static uint64_t timestamp();
+
+   static int _fd;
+   static void *_marker; // mapping of the file that makes perf record the file name
+   static size_t _markerSize;
+   static uint64_t _codeIndex;
+   static TR::Monitor *_monitor;
+   static bool _initialized;
+   };
+
+#endif // PERF_JIT_DUMP_HPP
@@ -393,6 +393,13 @@ J9::X86::CodeGenerator::suppressInliningOfRecognizedMethod(TR::RecognizedMethod
    switch (method)
       {
       case TR::java_lang_Object_clone:
+      // Evaluated inline for Latin-1 code points, see inlineCharacterIsMethod
+      case TR::java_lang_Character_isDigit:
+      case TR::java_lang_Character_isLetter:
+      case TR::java_lang_Character_isWhitespace:
+      case TR::java_lang_Character_isUpperCase:
+      case TR::java_lang_Character_isLowerCase:
+      case TR::java_lang_Character_isAlphabetic:
          return true;
       default:
          return false;
@@ -9625,6 +9625,431 @@ static TR::Register* inlineIntrinsicIndexOf(TR::Node* node, TR::CodeGenerator* c
    return result;
    }
 
+/**
+ * \brief
+ *   Generate inlined instructions equivalent to java/lang/StringLatin1.indexOf, java/lang/StringUTF16.indexOf,
+ *   com/ibm/jit/JITHelpers.intrinsicIndexOfStringLatin1 or com/ibm/jit/JITHelpers.intrinsicIndexOfStringUTF16
+ *
+ * \param node
+ *   The tree node
+ *
+ * \param cg
+ *   The Code Generator
+ *
+ * \param isLatin1
+ *   True when the strings are Latin1, False when the strings are UTF16
+ *
+ * The arguments are (s1Value, s1Length, s2Value, s2Length, fromIndex), with lengths and index in characters, and
+ * the JITHelpers versions have the receiver as an additional first child. As for the Java implementations, the
+ * code assumes that 0 <= fromIndex and 0 < s2Length.
+ *
+ * Each iteration of the main loop compares 16 bytes of the string with the first character of the pattern and the
+ * 16 bytes at an offset of s2Length - 1 characters with the last character of the pattern. Only the positions where
+ * both match are compared in full. The string is never read past s1Length, and positions too close to the end for a
+ * 16 byte load are checked one at a time.
+ *
+ * Note that this version does not support discontiguous arrays
+ */
+static TR::Register* inlineVectorizedStringIndexOf(TR::Node* node, TR::CodeGenerator* cg, bool isLatin1)
+   {
+   static uint8_t MASKOFSIZEONE[] =
+      {
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00,
+      };
+   static uint8_t MASKOFSIZETWO[] =
+      {
+      0x00, 0x01, 0x00, 0x01,
+      0x00, 0x01, 0x00, 0x01,
+      0x00, 0x01, 0x00, 0x01,
+      0x00, 0x01, 0x00, 0x01,
+      };
+
+   const uint8_t width = 16;
+   const uint8_t shift = isLatin1 ? 0 : 1;
+   const uint8_t elementSize = 1 << shift;
+   const int32_t headerSize = (int32_t)TR::Compiler->om.contiguousArrayHeaderSizeInBytes();
+   uint8_t* shuffleMask = isLatin1 ? MASKOFSIZEONE : MASKOFSIZETWO;
+   auto compareOp = isLatin1 ? TR::InstOpCode::PCMPEQBRegReg : TR::InstOpCode::PCMPEQWRegReg;
+   auto loadElementOp = isLatin1 ? TR::InstOpCode::MOVZXReg4Mem1 : TR::InstOpCode::MOVZXReg4Mem2;
+   auto compareElementOp = isLatin1 ? TR::InstOpCode::CMP1RegMem : TR::InstOpCode::CMP2RegMem;
+
+   // Some of these methods are static and some are not; skip the receiver if there is one
+   const bool isStaticCall = node->getSymbolReference()->getSymbol()->castToMethodSymbol()->isStatic();
+   const uint8_t firstCallArgIdx = isStaticCall ? 0 : 1;
+
+   auto s1Value = cg->evaluate(node->getChild(firstCallArgIdx));
+   auto s1Length = cg->evaluate(node->getChild(firstCallArgIdx + 1));
+   auto s2Value = cg->evaluate(node->getChild(firstCallArgIdx + 2));
+   auto s2Length = cg->evaluate(node->getChild(firstCallArgIdx + 3));
+   auto fromIndex = cg->evaluate(node->getChild(firstCallArgIdx + 4));
+
+   auto result = cg->allocateRegister();      // current position in s1, then the result
+   auto limit = cg->allocateRegister();       // last position in s1 where s2 can start
+   auto s1LastBase = cg->allocateRegister();  // address of s1 adjusted so that [s1LastBase + position] is the last character of a match
+   auto s2Bytes = cg->allocateRegister();     // size of s2 in bytes
+   auto step = cg->allocateRegister();        // characters covered by the current candidate mask
+   auto candidates = cg->allocateRegister();  // one bit per byte of each candidate position
+   auto candidateBase = cg->allocateRegister();
+   auto offset = cg->allocateRegister();
+   auto scratch = cg->allocateRegister();
+   auto firstXMM = cg->allocateRegister(TR_VRF);
+   auto lastXMM = cg->allocateRegister(TR_VRF);
+   auto scratchXMM1 = cg->allocateRegister(TR_VRF);
+   auto scratchXMM2 = cg->allocateRegister(TR_VRF);
+
+   auto dependencies = generateRegisterDependencyConditions((uint8_t)15, (uint8_t)15, cg);
+   TR::Register* dependentRegisters[] =
+      {
+      s1Value, s2Value, result, limit, s1LastBase, s2Bytes, step, candidates, candidateBase, offset, scratch,
+      firstXMM, lastXMM, scratchXMM1, scratchXMM2
+      };
+   for (int32_t i = 0; i < sizeof(dependentRegisters) / sizeof(dependentRegisters[0]); i++)
+      {
+      dependencies->addPreCondition(dependentRegisters[i], TR::RealRegister::NoReg, cg);
+      dependencies->addPostCondition(dependentRegisters[i], TR::RealRegister::NoReg, cg);
+      }
+
+   auto begLabel = generateLabelSymbol(cg);
+   auto endLabel = generateLabelSymbol(cg);
+   auto loopLabel = generateLabelSymbol(cg);
+   auto scalarLabel = generateLabelSymbol(cg);
+   auto candidateLoopLabel = generateLabelSymbol(cg);
+   auto compareChunkLabel = generateLabelSymbol(cg);
+   auto compareElementLabel = generateLabelSymbol(cg);
+   auto mismatchLabel = generateLabelSymbol(cg);
+   auto advanceLabel = generateLabelSymbol(cg);
+   auto foundLabel = generateLabelSymbol(cg);
+   auto notFoundLabel = generateLabelSymbol(cg);
+   begLabel->setStartInternalControlFlow();
+   endLabel->setEndInternalControlFlow();
+
+   generateRegRegInstruction(TR::InstOpCode::MOV4RegReg, node, limit, s1Length, cg);
+   generateRegRegInstruction(TR::InstOpCode::SUB4RegReg, node, limit, s2Length, cg);
+   generateRegRegInstruction(TR::InstOpCode::MOV4RegReg, node, result, fromIndex, cg);
+   generateRegRegInstruction(TR::InstOpCode::MOV4RegReg, node, s2Bytes, s2Length, cg);
+   if (shift)
+      {
+      generateRegRegInstruction(TR::InstOpCode::ADD4RegReg, node, s2Bytes, s2Bytes, cg);
+      }
+   generateRegMemInstruction(TR::InstOpCode::LEARegMem(), node, s1LastBase, generateX86MemoryReference(s1Value, s2Bytes, 0, headerSize - elementSize, cg), cg);
+
+   // Broadcast the first and the last character of s2
+   generateRegMemInstruction(loadElementOp, node, scratch, generateX86MemoryReference(s2Value, headerSize, cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::MOVDRegReg4, node, firstXMM, scratch, cg);
+   generateRegMemInstruction(TR::InstOpCode::PSHUFBRegMem, node, firstXMM, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, shuffleMask), cg), cg);
+   generateRegMemInstruction(loadElementOp, node, scratch, generateX86MemoryReference(s2Value, s2Bytes, 0, headerSize - elementSize, cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::MOVDRegReg4, node, lastXMM, scratch, cg);
+   generateRegMemInstruction(TR::InstOpCode::PSHUFBRegMem, node, lastXMM, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, shuffleMask), cg), cg);
+
+   generateLabelInstruction(TR::InstOpCode::label, node, begLabel, cg);
+   generateRegRegInstruction(TR::InstOpCode::CMP4RegReg, node, result, limit, cg);
+   generateLabelInstruction(TR::InstOpCode::JG4, node, notFoundLabel, cg);
+
+   // Find the candidate positions in the next 16 bytes, if the last character of s2 at the last of them is still within s1
+   generateLabelInstruction(TR::InstOpCode::label, node, loopLabel, cg);
+   generateRegMemInstruction(TR::InstOpCode::LEA4RegMem, node, scratch, generateX86MemoryReference(result, (width >> shift) - 1, cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::CMP4RegReg, node, scratch, limit, cg);
+   generateLabelInstruction(TR::InstOpCode::JG4, node, scalarLabel, cg);
+   generateRegMemInstruction(TR::InstOpCode::MOVDQURegMem, node, scratchXMM1, generateX86MemoryReference(s1Value, result, shift, headerSize, cg), cg);
+   generateRegMemInstruction(TR::InstOpCode::MOVDQURegMem, node, scratchXMM2, generateX86MemoryReference(s1LastBase, result, shift, 0, cg), cg);
+   generateRegRegInstruction(compareOp, node, scratchXMM1, firstXMM, cg);
+   generateRegRegInstruction(compareOp, node, scratchXMM2, lastXMM, cg);
+   generateRegRegInstruction(TR::InstOpCode::PANDRegReg, node, scratchXMM1, scratchXMM2, cg);
+   generateRegRegInstruction(TR::InstOpCode::PMOVMSKB4RegReg, node, candidates, scratchXMM1, cg);
+   if (shift)
+      {
+      // Keep a single bit per character
+      generateRegImmInstruction(TR::InstOpCode::AND4RegImm4, node, candidates, 0x5555, cg);
+      }
+   generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, node, step, width >> shift, cg);
+   generateLabelInstruction(TR::InstOpCode::JMP4, node, candidateLoopLabel, cg);
+
+   // Fewer than 16 bytes of positions left: check the current position only
+   generateLabelInstruction(TR::InstOpCode::label, node, scalarLabel, cg);
+   generateRegRegInstruction(TR::InstOpCode::CMP4RegReg, node, result, limit, cg);
+   generateLabelInstruction(TR::InstOpCode::JG4, node, notFoundLabel, cg);
+   generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, node, candidates, 1, cg);
+   generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, node, step, 1, cg);
+
+   // Compare s2 with s1 at the lowest candidate position, 16 bytes at a time and then one character at a time
+   generateLabelInstruction(TR::InstOpCode::label, node, candidateLoopLabel, cg);
+   generateRegRegInstruction(TR::InstOpCode::TEST4RegReg, node, candidates, candidates, cg);
+   generateLabelInstruction(TR::InstOpCode::JE4, node, advanceLabel, cg);
+   generateRegRegInstruction(TR::InstOpCode::BSF4RegReg, node, scratch, candidates, cg);
+   generateRegMemInstruction(TR::InstOpCode::LEARegMem(), node, candidateBase, generateX86MemoryReference(s1Value, result, shift, headerSize, cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::ADDRegReg(), node, candidateBase, scratch, cg);
+   generateRegRegInstruction(TR::InstOpCode::XOR4RegReg, node, offset, offset, cg);
+
+   generateLabelInstruction(TR::InstOpCode::label, node, compareChunkLabel, cg);
+   generateRegMemInstruction(TR::InstOpCode::LEA4RegMem, node, scratch, generateX86MemoryReference(offset, width, cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::CMP4RegReg, node, scratch, s2Bytes, cg);
+   generateLabelInstruction(TR::InstOpCode::JG4, node, compareElementLabel, cg);
+   generateRegMemInstruction(TR::InstOpCode::MOVDQURegMem, node, scratchXMM1, generateX86MemoryReference(candidateBase, offset, 0, 0, cg), cg);
+   generateRegMemInstruction(TR::InstOpCode::MOVDQURegMem, node, scratchXMM2, generateX86MemoryReference(s2Value, offset, 0, headerSize, cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::PCMPEQBRegReg, node, scratchXMM1, scratchXMM2, cg);
+   generateRegRegInstruction(TR::InstOpCode::PMOVMSKB4RegReg, node, scratch, scratchXMM1, cg);
+   generateRegImmInstruction(TR::InstOpCode::CMP4RegImm4, node, scratch, 0xFFFF, cg);
+   generateLabelInstruction(TR::InstOpCode::JNE4, node, mismatchLabel, cg);
+   generateRegImmInstruction(TR::InstOpCode::ADD4RegImms, node, offset, width, cg);
+   generateLabelInstruction(TR::InstOpCode::JMP4, node, compareChunkLabel, cg);
+
+   generateLabelInstruction(TR::InstOpCode::label, node, compareElementLabel, cg);
+   generateRegRegInstruction(TR::InstOpCode::CMP4RegReg, node, offset, s2Bytes, cg);
+   generateLabelInstruction(TR::InstOpCode::JGE4, node, foundLabel, cg);
+   generateRegMemInstruction(loadElementOp, node, scratch, generateX86MemoryReference(s2Value, offset, 0, headerSize, cg), cg);
+   generateRegMemInstruction(compareElementOp, node, scratch, generateX86MemoryReference(candidateBase, offset, 0, 0, cg), cg);
+   generateLabelInstruction(TR::InstOpCode::JNE4, node, mismatchLabel, cg);
+   generateRegImmInstruction(TR::InstOpCode::ADD4RegImms, node, offset, elementSize, cg);
+   generateLabelInstruction(TR::InstOpCode::JMP4, node, compareElementLabel, cg);
+
+   // Drop the lowest candidate and try the next one
+   generateLabelInstruction(TR::InstOpCode::label, node, mismatchLabel, cg);
+   generateRegMemInstruction(TR::InstOpCode::LEA4RegMem, node, scratch, generateX86MemoryReference(candidates, -1, cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::AND4RegReg, node, candidates, scratch, cg);
+   generateLabelInstruction(TR::InstOpCode::JMP4, node, candidateLoopLabel, cg);
+
+   generateLabelInstruction(TR::InstOpCode::label, node, advanceLabel, cg);
+   generateRegRegInstruction(TR::InstOpCode::ADD4RegReg, node, result, step, cg);
+   generateLabelInstruction(TR::InstOpCode::JMP4, node, loopLabel, cg);
+
+   generateLabelInstruction(TR::InstOpCode::label, node, foundLabel, cg);
+   generateRegRegInstruction(TR::InstOpCode::BSF4RegReg, node, scratch, candidates, cg);
+   if (shift)
+      {
+      generateRegImmInstruction(TR::InstOpCode::SHR4RegImm1, node, scratch, shift, cg);
+      }
+   generateRegRegInstruction(TR::InstOpCode::ADD4RegReg, node, result, scratch, cg);
+   generateLabelInstruction(TR::InstOpCode::JMP4, node, endLabel, cg);
+
+   generateLabelInstruction(TR::InstOpCode::label, node, notFoundLabel, cg);
+   generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, node, result, -1, cg);
+   generateLabelInstruction(TR::InstOpCode::label, node, endLabel, dependencies, cg);
+
+   cg->stopUsingRegister(limit);
+   cg->stopUsingRegister(s1LastBase);
+   cg->stopUsingRegister(s2Bytes);
+   cg->stopUsingRegister(step);
+   cg->stopUsingRegister(candidates);
+   cg->stopUsingRegister(candidateBase);
+   cg->stopUsingRegister(offset);
+   cg->stopUsingRegister(scratch);
+   cg->stopUsingRegister(firstXMM);
+   cg->stopUsingRegister(lastXMM);
+   cg->stopUsingRegister(scratchXMM1);
+   cg->stopUsingRegister(scratchXMM2);
+
+   node->setRegister(result);
+   if (!isStaticCall)
+      {
+      cg->recursivelyDecReferenceCount(node->getChild(0));
+      }
+   for (int32_t i = firstCallArgIdx; i < node->getNumChildren(); i++)
+      {
+      cg->decReferenceCount(node->getChild(i));
+      }
+   return result;
+   }
+
+/**
+ * \brief
+ *   Generate inlined instructions equivalent to java/lang/Math.fma or java/lang/StrictMath.fma
+ *
+ * \param node
+ *   The tree node
+ *
+ * \param cg
+ *   The Code Generator
+ *
+ * Requires FMA3; the single rounding of vfmadd is exactly what the Java specification asks for.
+ */
+static TR::Register* inlineMathFma(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   bool isDouble = node->getDataType() == TR::Double;
+
+   TR::Register* multiplicand = cg->evaluate(node->getChild(0));
+   TR::Register* multiplier = cg->evaluate(node->getChild(1));
+   TR::Register* result = isDouble ? cg->doubleClobberEvaluate(node->getChild(2)) : cg->floatClobberEvaluate(node->getChild(2));
+
+   // result = multiplicand * multiplier + result
+   generateRegRegRegInstruction(isDouble ? TR::InstOpCode::VFMADD231SDRegRegReg : TR::InstOpCode::VFMADD231SSRegRegReg, node, result, multiplicand, multiplier, cg);
+
+   node->setRegister(result);
+   cg->decReferenceCount(node->getChild(0));
+   cg->decReferenceCount(node->getChild(1));
+   cg->decReferenceCount(node->getChild(2));
+   return result;
+   }
+
+/**
+ * \brief
+ *   Generate inlined instructions equivalent to java/lang/Math.floor, java/lang/Math.ceil or their StrictMath versions
+ *
+ * \param node
+ *   The tree node
+ *
+ * \param cg
+ *   The Code Generator
+ *
+ * \param isCeil
+ *   True for ceil, False for floor
+ *
+ * Requires SSE4.1. roundsd preserves the sign of zero, NaN and infinities as the Java methods do.
+ */
+static TR::Register* inlineMathFloorCeil(TR::Node* node, TR::CodeGenerator* cg, bool isCeil)
+   {
+   // Round toward -infinity or +infinity, without raising the precision exception
+   const uint8_t ROUND_FLOOR = 0x09;
+   const uint8_t ROUND_CEIL = 0x0A;
+
+   TR::Register* value = cg->evaluate(node->getChild(0));
+   TR::Register* result = cg->allocateRegister(TR_FPR);
+   generateRegRegImmInstruction(TR::InstOpCode::ROUNDSDRegRegImm1, node, result, value, isCeil ? ROUND_CEIL : ROUND_FLOOR, cg);
+
+   node->setRegister(result);
+   cg->decReferenceCount(node->getChild(0));
+   return result;
+   }
+
+/**
+ * \brief
+ *   Generate inlined instructions equivalent to java/lang/Math.copySign
+ *
+ * \param node
+ *   The tree node
+ *
+ * \param cg
+ *   The Code Generator
+ *
+ * Note that this does not implement java/lang/StrictMath.copySign, which treats a NaN sign argument as positive.
+ */
+static TR::Register* inlineMathCopySign(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   static uint64_t DOUBLE_SIGN_MASK[] = { 0x8000000000000000ULL, 0x8000000000000000ULL };
+   static uint64_t DOUBLE_MAGNITUDE_MASK[] = { 0x7fffffffffffffffULL, 0x7fffffffffffffffULL };
+   static uint32_t FLOAT_SIGN_MASK[] = { 0x80000000, 0x80000000, 0x80000000, 0x80000000 };
+   static uint32_t FLOAT_MAGNITUDE_MASK[] = { 0x7fffffff, 0x7fffffff, 0x7fffffff, 0x7fffffff };
+
+   bool isDouble = node->getDataType() == TR::Double;
+   void* signMask = isDouble ? (void*)DOUBLE_SIGN_MASK : (void*)FLOAT_SIGN_MASK;
+   void* magnitudeMask = isDouble ? (void*)DOUBLE_MAGNITUDE_MASK : (void*)FLOAT_MAGNITUDE_MASK;
+
+   TR::Register* result = isDouble ? cg->doubleClobberEvaluate(node->getChild(0)) : cg->floatClobberEvaluate(node->getChild(0));
+   TR::Register* sign = isDouble ? cg->doubleClobberEvaluate(node->getChild(1)) : cg->floatClobberEvaluate(node->getChild(1));
+
+   generateRegMemInstruction(TR::InstOpCode::PANDRegMem, node, result, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, magnitudeMask), cg), cg);
+   generateRegMemInstruction(TR::InstOpCode::PANDRegMem, node, sign, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, signMask), cg), cg);
+   generateRegRegInstruction(TR::InstOpCode::PORRegReg, node, result, sign, cg);
+
+   node->setRegister(result);
+   cg->decReferenceCount(node->getChild(0));
+   cg->decReferenceCount(node->getChild(1));
+   cg->stopUsingRegister(sign);
+   return result;
+   }
+
+/**
+ * \brief
+ *   Generate inlined instructions equivalent to java/lang/Character.isDigit, isLetter, isWhitespace,
+ *   isUpperCase, isLowerCase or isAlphabetic for code points in the Latin-1 range
+ *
+ * \param node
+ *   The tree node
+ *
+ * \param cg
+ *   The Code Generator
+ *
+ * The code points of each category below 0x100 form a few disjoint ranges. Each range is tested without
+ * branches by subtracting its lower bound and comparing the difference, unsigned, with the size of the
+ * range; the carry is added to the result. Code points above 0xFF, and negative values, call the Java method.
+ */
+static TR::Register* inlineCharacterIsMethod(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   struct CodePointRange
+      {
+      int32_t first;
+      int32_t last;
+      };
+   static const CodePointRange DIGIT_RANGES[] = { {0x30, 0x39} };
+   static const CodePointRange WHITESPACE_RANGES[] = { {0x09, 0x0D}, {0x1C, 0x20} };
+   static const CodePointRange UPPERCASE_RANGES[] = { {0x41, 0x5A}, {0xC0, 0xD6}, {0xD8, 0xDE} };
+   static const CodePointRange LOWERCASE_RANGES[] = { {0x61, 0x7A}, {0xAA, 0xAA}, {0xB5, 0xB5}, {0xBA, 0xBA}, {0xDF, 0xF6}, {0xF8, 0xFF} };
+   static const CodePointRange LETTER_RANGES[] = { {0x41, 0x5A}, {0x61, 0x7A}, {0xAA, 0xAA}, {0xB5, 0xB5}, {0xBA, 0xBA}, {0xC0, 0xD6}, {0xD8, 0xF6}, {0xF8, 0xFF} };
+
+   const CodePointRange* ranges = NULL;
+   int32_t numRanges = 0;
+   switch (node->getSymbol()->castToMethodSymbol()->getRecognizedMethod())
+      {
+      case TR::java_lang_Character_isDigit:
+         ranges = DIGIT_RANGES;
+         numRanges = sizeof(DIGIT_RANGES) / sizeof(DIGIT_RANGES[0]);
+         break;
+      case TR::java_lang_Character_isWhitespace:
+         ranges = WHITESPACE_RANGES;
+         numRanges = sizeof(WHITESPACE_RANGES) / sizeof(WHITESPACE_RANGES[0]);
+         break;
+      case TR::java_lang_Character_isUpperCase:
+         ranges = UPPERCASE_RANGES;
+         numRanges = sizeof(UPPERCASE_RANGES) / sizeof(UPPERCASE_RANGES[0]);
+         break;
+      case TR::java_lang_Character_isLowerCase:
+         ranges = LOWERCASE_RANGES;
+         numRanges = sizeof(LOWERCASE_RANGES) / sizeof(LOWERCASE_RANGES[0]);
+         break;
+      case TR::java_lang_Character_isLetter:
+      case TR::java_lang_Character_isAlphabetic:
+         // The two agree on every Latin-1 code point
+         ranges = LETTER_RANGES;
+         numRanges = sizeof(LETTER_RANGES) / sizeof(LETTER_RANGES[0]);
+         break;
+      default:
+         TR_ASSERT_FATAL(false, "Unsupported Character method");
+      }
+
+   TR::Node* valueNode = node->getFirstChild();
+   TR::Register* value = cg->evaluate(valueNode);
+   TR::Register* result = cg->allocateRegister();
+   TR::Register* tmp = cg->allocateRegister();
+
+   TR::LabelSymbol* begLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol* endLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol* slowPathLabel = generateLabelSymbol(cg);
+   begLabel->setStartInternalControlFlow();
+   endLabel->setEndInternalControlFlow();
+
+   TR::RegisterDependencyConditions* deps = generateRegisterDependencyConditions((uint8_t)0, 3, cg);
+   deps->addPostCondition(value, TR::RealRegister::NoReg, cg);
+   deps->addPostCondition(result, TR::RealRegister::NoReg, cg);
+   deps->addPostCondition(tmp, TR::RealRegister::NoReg, cg);
+   deps->stopAddingConditions();
+
+   // XOR clobbers the flags, so the result is cleared before the first compare
+   generateRegRegInstruction(TR::InstOpCode::XOR4RegReg, node, result, result, cg);
+   generateLabelInstruction(TR::InstOpCode::label, node, begLabel, cg);
+   generateRegImmInstruction(TR::InstOpCode::CMP4RegImm4, node, value, 0xFF, cg);
+   generateLabelInstruction(TR::InstOpCode::JA4, node, slowPathLabel, cg);
+
+   for (int32_t i = 0; i < numRanges; i++)
+      {
+      // CF = (unsigned)(value - first) < (last - first + 1)
+      generateRegMemInstruction(TR::InstOpCode::LEA4RegMem, node, tmp, generateX86MemoryReference(value, -ranges[i].first, cg), cg);
+      generateRegImmInstruction(TR::InstOpCode::CMP4RegImm4, node, tmp, ranges[i].last - ranges[i].first + 1, cg);
+      generateRegImmInstruction(TR::InstOpCode::ADC4RegImm4, node, result, 0, cg);
+      }
+
+   generateLabelInstruction(TR::InstOpCode::label, node, endLabel, deps, cg);
+
+   TR_OutlinedInstructions* slowPath = new (cg->trHeapMemory()) TR_OutlinedInstructions(node, TR::icall, result, slowPathLabel, endLabel, cg);
+   cg->getOutlinedInstructionsList().push_front(slowPath);
+
+   node->setRegister(result);
+   cg->decReferenceCount(valueNode);
+   cg->stopUsingRegister(tmp);
+   return result;
+   }
+
 /**
  * \brief
  *   Generate inlined instructions equivalent to sun/misc/Unsafe.compareAndSwapObject or jdk/internal/misc/Unsafe.compareAndSwapObject
@@ -11772,6 +12197,58 @@ J9::X86::TreeEvaluator::directCallEvaluator(TR::Node *node, TR::CodeGenerator *c
          break;
       }
 
+   // The symbol is marked when the target supports the instructions; see J9::ResolvedMethodSymbol
+   if (symbol->getResolvedMethodSymbol() && symbol->getResolvedMethodSymbol()->canReplaceWithHWInstr())
+      {
+      switch (symbol->getRecognizedMethod())
+         {
+         case TR::java_lang_Math_fma_D:
+         case TR::java_lang_Math_fma_F:
+         case TR::java_lang_StrictMath_fma_D:
+         case TR::java_lang_StrictMath_fma_F:
+            return inlineMathFma(node, cg);
+         case TR::java_lang_Math_floor:
+         case TR::java_lang_StrictMath_floor:
+            return inlineMathFloorCeil(node, cg, false);
+         case TR::java_lang_Math_ceil:
+         case TR::java_lang_StrictMath_ceil:
+            return inlineMathFloorCeil(node, cg, true);
+         case TR::java_lang_Math_copySign_F:
+         case TR::java_lang_Math_copySign_D:
+            return inlineMathCopySign(node, cg);
+         default:
+            break;
+         }
+      }
+
+   switch (symbol->getRecognizedMethod())
+      {
+      case TR::java_lang_Character_isDigit:
+      case TR::java_lang_Character_isLetter:
+      case TR::java_lang_Character_isWhitespace:
+      case TR::java_lang_Character_isUpperCase:
+      case TR::java_lang_Character_isLowerCase:
+      case TR::java_lang_Character_isAlphabetic:
+         return inlineCharacterIsMethod(node, cg);
+      default:
+         break;
+      }
+
+   if (cg->getSupportsInlineStringIndexOf() && comp->target().is64Bit())
+      {
+      switch (symbol->getRecognizedMethod())
+         {
+         case TR::java_lang_StringLatin1_indexOf:
+         case TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringLatin1:
+            return inlineVectorizedStringIndexOf(node, cg, true);
+         case TR::java_lang_StringUTF16_indexOf:
+         case TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringUTF16:
+            return inlineVectorizedStringIndexOf(node, cg, false);
+         default:
+            break;
+         }
+      }
+
    if (cg->getSupportsInlineStringCaseConversion())
       {
       switch (symbol->getRecognizedMethod())
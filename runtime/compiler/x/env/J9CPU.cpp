@@ -340,6 +340,8 @@ J9::X86::CPU::supports_feature_test(uint32_t feature)
          return TR::CodeGenerator::getX86ProcessorInfo().hasThermalMonitor() == ans;
       case OMR_FEATURE_X86_AVX:
          return true;
+      case OMR_FEATURE_X86_FMA:
+         return true;
       default:
          return false;
       }
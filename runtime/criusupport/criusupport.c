@@ -299,14 +299,14 @@ Java_org_eclipse_openj9_criu_CRIUSupport_checkpointJVMImpl(JNIEnv *env,
 
 		if (FALSE == vmFuncs->jvmCheckpointHooks(currentThread)) {
 			resultType = vm->criuSupportJVMCheckpointFailure;
-			goto releaseExclusive;
+			goto rollbackCheckpoint;
 		}
 
 		systemReturnCode = criu_dump();
 		if (systemReturnCode < 0) {
 			vmFuncs->setCurrentExceptionNLSWithArgs(currentThread, J9NLS_JCL_CRIU_DUMP_FAILED, J9VMCONSTANTPOOL_JAVALANGINTERNALERROR, systemReturnCode);
 			resultType = vm->criuSupportSystemCheckpointFailure;
-			goto releaseExclusive;
+			goto rollbackCheckpoint;
 		}
 
 		/* We can only end up here if the CRIU restore was successful */
@@ -318,7 +318,11 @@ Java_org_eclipse_openj9_criu_CRIUSupport_checkpointJVMImpl(JNIEnv *env,
 		}
 
 		resultType = vm->criuSupportSuccess;
+		goto releaseExclusive;
 
+rollbackCheckpoint:
+		/* No image was written; undo what the checkpoint hooks did, since this process keeps running */
+		vmFuncs->jvmCheckpointFailedHooks(currentThread);
 releaseExclusive:
 		vmFuncs->releaseExclusiveVMAccess(currentThread);
 closeWorkDirFD:
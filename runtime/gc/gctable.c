@@ -110,6 +110,7 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_ext_check_is_valid_heap_object,
 #if defined(J9VM_GC_FINALIZATION)
 	j9gc_get_objects_pending_finalization_count,
+	j9gc_get_oldest_pending_finalization_age,
 #endif /* J9VM_GC_FINALIZATION */
 	j9gc_set_softmx,
 	j9gc_get_softmx,
@@ -255,5 +256,9 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_notifyGCOfClassReplacement,
 	j9gc_get_jit_string_dedup_policy,
 	j9gc_stringHashFn,
-	j9gc_stringHashEqualFn
+	j9gc_stringHashEqualFn,
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+	j9gc_reconfigure_for_restore,
+	j9gc_clear_softmx,
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 };
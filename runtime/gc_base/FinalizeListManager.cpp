@@ -109,10 +109,38 @@ GC_FinalizeListManager::tearDown()
 	}
 }
 
+void
+GC_FinalizeListManager::noteJobsAdded()
+{
+	if (0 == (_classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount)) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		_backlogStartTime = omrtime_current_time_millis();
+	}
+}
+
+U_64
+GC_FinalizeListManager::getOldestJobAge() const
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	U_64 age = 0;
+
+	lock();
+	if (0 != (_classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount)) {
+		U_64 now = omrtime_current_time_millis();
+		if (now > _backlogStartTime) {
+			age = now - _backlogStartTime;
+		}
+	}
+	unlock();
+
+	return age;
+}
+
 void
 GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t tail, UDATA objectCount)
 {
 	lock();
+	noteJobsAdded();
 
 	_extensions->accessBarrier->setFinalizeLink(tail, _systemFinalizableObjects);
 	_systemFinalizableObjects = head;
@@ -138,6 +166,7 @@ void
 GC_FinalizeListManager::addDefaultFinalizableObjects(j9object_t head, j9object_t tail, UDATA objectCount)
 {
 	lock();
+	noteJobsAdded();
 
 	_extensions->accessBarrier->setFinalizeLink(tail, _defaultFinalizableObjects);
 	_defaultFinalizableObjects = head;
@@ -163,6 +192,7 @@ void
 GC_FinalizeListManager::addReferenceObjects(j9object_t head, j9object_t tail, UDATA objectCount)
 {
 	lock();
+	noteJobsAdded();
 
 	_extensions->accessBarrier->setReferenceLink(tail, _referenceObjects);
 	_referenceObjects = head;
@@ -188,6 +218,7 @@ void
 GC_FinalizeListManager::addClassLoaders(J9ClassLoader *head, J9ClassLoader *tail, UDATA count)
 {
 	lock();
+	noteJobsAdded();
 
 	tail->unloadLink = _classLoaders;
 	_classLoaders = head;
@@ -237,7 +268,7 @@ GC_FinalizeListManager::popRequiredClassLoaderForForcedClassLoaderUnload()
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 GC_FinalizeJob *
-GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
+GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job, bool includeClassLoaders)
 {
 	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
 	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
@@ -252,7 +283,7 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		}
 	}
 
-	{
+	if (includeClassLoaders) {
 		J9ClassLoader *loader = popClassLoader();
 		if (NULL != loader) {
 			job->type = FINALIZE_JOB_TYPE_CLASSLOADER;
@@ -75,6 +75,7 @@ private:
     UDATA _referenceObjectCount; /** count of the reference object */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+    U_64 _backlogStartTime; /**< time (ms) at which jobs were added to the empty queue; no pending job is older than this */
 protected:
 public:
     
@@ -117,6 +118,14 @@ protected:
      */
     J9ClassLoader *popClassLoader();
 
+    /**
+     * Remember the time at which the queue stops being empty, so that the age of the oldest
+     * pending job can be reported. Jobs are consumed in LIFO order, so this is an upper bound.
+     *
+     * @note Must be called while holding this class' _mutex, before adding the jobs
+     */
+    void noteJobsAdded();
+
 public:
 	void lock() const;
 	void unlock() const;
@@ -133,6 +142,14 @@ public:
 		return count;
 	}
 
+	/**
+	 * Gets the time spent on the queue by the oldest pending job.
+	 * This is the time since the queue was last empty, so jobs that are added faster than
+	 * the finalizer threads consume them show up as a steadily increasing age.
+	 * @return The age of the oldest pending job in milliseconds, or 0 if the queue is empty.
+	 */
+	U_64 getOldestJobAge() const;
+
 	virtual UDATA getSystemCount() {return _systemFinalizableObjectCount;}
 	virtual UDATA getDefaultCount() {return _defaultFinalizableObjectCount;}
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
@@ -327,9 +344,11 @@ public:
 	 * 
 	 * @note Must be called while holding this class' _mutex
 	 *
+	 * @param includeClassLoaders[in] false if classloader jobs must be left for another thread
+	 *
 	 * @return the next job or NULL
 	 */
-	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
+	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job, bool includeClassLoaders = true);
 
 
 	/**
@@ -346,6 +365,7 @@ public:
 	    ,_referenceObjectCount(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_backlogStartTime(0)
 	{
 		_typeId = __FUNCTION__;
 	};
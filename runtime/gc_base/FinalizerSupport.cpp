@@ -177,7 +177,27 @@ struct finalizeWorkerData {
 	IDATA wakeUp;
 };
 
+/**
+ * Helper threads that drain the finalize queue in parallel with the worker thread when
+ * -Xgc:finalizeWorkerThreads is greater than 1. The worker thread stays in charge of the
+ * class loader jobs, of the forced and class unloading modes, and of the cycle time limit;
+ * helpers only consume finalizable objects and references.
+ */
+struct finalizeHelperPool {
+	omrthread_monitor_t monitor;
+	J9JavaVM *vm;
+	UDATA threadCount; /**< helper threads created and not yet exited */
+	UDATA activeCount; /**< helper threads currently consuming jobs */
+	UDATA workRequest; /**< incremented each time the helpers are asked to drain the queue */
+	UDATA startedCount; /**< helper threads that have picked up the latest work request */
+	IDATA die; /**< FINALIZE_WORKER_SHOULD_DIE while the main thread waits for the helpers to exit, FINALIZE_WORKER_ABANDONED once it stopped waiting */
+};
+
 static int J9THREAD_PROC FinalizeWorkerThread(void *arg);
+static int J9THREAD_PROC gpProtectedFinalizeHelperThread(void *entryArg);
+static void wakeFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool **indirectHelperPool, UDATA jobCount);
+static void waitForFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool *helperPool);
+static void shutdownFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool *helperPool);
 IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThreadHandle, struct finalizeWorkerData **indirectWorkerData, IDATA finalizeCycleLimit, IDATA mode);
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM);
 static int  J9THREAD_PROC gpProtectedFinalizeWorkerThread(void *entryArg);
@@ -188,6 +208,7 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 	omrthread_t workerThreadHandle;
 	int doneRunFinalizersOnExit, noCycleWait;
 	struct finalizeWorkerData *workerData = NULL;
+	struct finalizeHelperPool *helperPool = NULL;
 	IDATA finalizeCycleInterval, finalizeCycleLimit, currentWaitTime, finalizableListUsed;
 	IDATA cycleIntervalWaitResult;
 	UDATA workerMode, savedFinalizeMainFlags;
@@ -271,6 +292,11 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 
 		savedFinalizeMainFlags = vm->finalizeMainFlags;
 
+		/* Let the helpers share a backlog of jobs with the worker */
+		if ((FINALIZE_WORKER_MODE_NORMAL == workerMode) && (1 < extensions->finalizeWorkerThreads) && (1 < finalizableListUsed)) {
+			wakeFinalizeHelpers(vm, &helperPool, finalizableListUsed);
+		}
+
 		IDATA result = FinalizeMainRunFinalization(vm, &workerThreadHandle, &workerData, finalizeCycleLimit, workerMode);
 		if(result < 0) {
 			/* give up this run and hope next time will be better */
@@ -279,6 +305,11 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 			continue;
 		}
 
+		/* Jobs taken by the helpers must be complete before forced finalization is reported as done */
+		if (savedFinalizeMainFlags & J9_FINALIZE_FLAGS_RUN_FINALIZATION) {
+			waitForFinalizeHelpers(vm, helperPool);
+		}
+
 		/* Determine whether the worker actually did finish it's work */
 		omrthread_monitor_enter(workerData->monitor);
 		if(workerData->finished) {
@@ -348,6 +379,7 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 		forge->free(workerData);
 		omrthread_monitor_enter((omrthread_monitor_t)vm->finalizeMainMonitor);
 	}
+	shutdownFinalizeHelpers(vm, helperPool);
 
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	if(NULL != vm->javaOffloadSwitchOffNoEnvWithReasonFunc) {
@@ -466,6 +498,74 @@ process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInte
 	}
 }
 
+/**
+ * Look up the Java methods used to run finalizers and enqueue references.
+ * The methods are left NULL if the class library does not support finalization.
+ */
+static void
+lookupFinalizeMethods(J9VMThread *env, jclass *j9VMInternalsClass, jmethodID *runFinalizeMID, jmethodID *referenceEnqueueImplMID)
+{
+	J9JavaVM *vm = env->javaVM;
+	jclass referenceClazz = NULL;
+
+	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
+		/* Only look up finalization methods if the class library supports them */
+		*j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
+		if (*j9VMInternalsClass) {
+			*j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(*j9VMInternalsClass);
+			if (*j9VMInternalsClass) {
+				*runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(*j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
+			}
+		}
+		if (!*runFinalizeMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	
+		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
+		if (referenceClazz) {
+			*referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
+		}
+		if (!*referenceEnqueueImplMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	}
+}
+
+/**
+ * Mark reference processing as active if there are pending references
+ */
+static void
+startReferenceProcessing(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != finalizeListManager->getReferenceCount())) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		vm->processReferenceActive = 1;
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
+/**
+ * Called after processing a job to wake up the threads waiting for reference processing
+ */
+static void
+notifyReferenceProcessingProgress(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		if (0 == finalizeListManager->getReferenceCount()) {
+			/* There is no more pending reference. */
+			vm->processReferenceActive = 0;
+		}
+		/*
+		 * Notify any waiters that progress has been made.
+		 * This improves latency for Reference.waitForReferenceProcessing() and try to
+		 * avoid the performance issue if there are many of pending references in the queue.
+		 */
+		omrthread_monitor_notify_all(vm->processReferenceMonitor);
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
 /**
  * Worker thread consumes jobs from Finalize List Manager and process them
  */
@@ -475,7 +575,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	J9VMThread *env;
 	const GC_FinalizeJob *finalizeJob;
 	GC_FinalizeJob localJob;
-	jclass referenceClazz, j9VMInternalsClass = NULL;
+	jclass j9VMInternalsClass = NULL;
 	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
 	J9InternalVMFunctions* fns;
 	omrthread_monitor_t monitor;
@@ -512,27 +612,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	/* Remember that the thread was gpProtected -- important for the JIT */
 	env->gpProtected = 1;
 
-	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
-		/* Only look up finalization methods if the class library supports them */
-		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
-		if (j9VMInternalsClass) {
-			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
-			if (j9VMInternalsClass) {
-				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
-			}
-		}
-		if (!runFinalizeMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	
-		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
-		if (referenceClazz) {
-			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
-		}
-		if (!referenceEnqueueImplMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	}		
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
 	workerData->vmThread = env;
 
 	/* Notify that the worker has come on line (We should check the result from above) */
@@ -557,11 +637,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 		if(workerData->mode != FINALIZE_WORKER_MODE_CL_UNLOAD)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		{
-			if ((NULL != vm->processReferenceMonitor) && (0 != finalizeListManager->getReferenceCount())) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				vm->processReferenceActive = 1;
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			startReferenceProcessing(vm, finalizeListManager);
 		}
 
 		do {
@@ -606,20 +682,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 			/* processing will release/acquire VM access */
 			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
 
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
-				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			notifyReferenceProcessingProgress(vm, finalizeListManager);
 
 			fns->jniResetStackReferences((JNIEnv *)env);
 
@@ -822,6 +885,278 @@ gpProtectedFinalizeWorkerThread(void *entryArg)
 	return 0;
 }
 
+/**
+ * Called by a helper thread when it exits. The last helper to exit after the
+ * main thread gave up waiting for it in shutdownFinalizeHelpers() frees the pool.
+ */
+static void
+exitFinalizeHelperThread(struct finalizeHelperPool *helperPool, UDATA workRequestSeen)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(helperPool->vm)->getForge();
+	bool freePool = false;
+
+	omrthread_monitor_enter(helperPool->monitor);
+	helperPool->threadCount -= 1;
+	if (workRequestSeen == helperPool->workRequest) {
+		helperPool->startedCount -= 1;
+	}
+	/* Once the main thread has stopped waiting for the helpers, the last one out frees the pool */
+	freePool = (FINALIZE_WORKER_ABANDONED == helperPool->die) && (0 == helperPool->threadCount);
+	omrthread_monitor_notify_all(helperPool->monitor);
+	omrthread_monitor_exit(helperPool->monitor);
+
+	if (freePool) {
+		omrthread_monitor_destroy(helperPool->monitor);
+		forge->free(helperPool);
+	}
+}
+
+/**
+ * Helper thread consumes finalizable objects and references from Finalize List Manager
+ * each time the main thread requests it, until the queue is empty
+ */
+static int J9THREAD_PROC FinalizeHelperThread(void *arg)
+{
+	struct finalizeHelperPool *helperPool = (struct finalizeHelperPool *)arg;
+	J9JavaVM *vm = helperPool->vm;
+	J9InternalVMFunctions *fns = vm->internalVMFunctions;
+	GC_FinalizeListManager *finalizeListManager = MM_GCExtensions::getExtensions(vm)->finalizeListManager;
+	J9VMThread *env = NULL;
+	const GC_FinalizeJob *finalizeJob = NULL;
+	GC_FinalizeJob localJob;
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+	UDATA workRequestSeen = 0;
+
+	if (JNI_OK != fns->attachSystemDaemonThread(vm, &env, "Finalizer helper thread")) {
+		/* Failed to attach the thread; the worker and the other helpers do the work */
+		exitFinalizeHelperThread(helperPool, workRequestSeen);
+		return 0;
+	}
+
+#if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
+	if( vm->javaOffloadSwitchOnWithReasonFunc != NULL ) {
+		(*vm->javaOffloadSwitchOnWithReasonFunc)(env, J9_JNI_OFFLOAD_SWITCH_FINALIZE_WORKER_THREAD);
+		env->javaOffloadState = 1;
+	}
+#endif
+
+	fns->internalEnterVMFromJNI(env);
+	env->privateFlags |= (J9_PRIVATE_FLAGS_FINALIZE_WORKER | J9_PRIVATE_FLAGS_USE_BOOTSTRAP_LOADER);
+	fns->internalReleaseVMAccess(env);
+
+	/* Remember that the thread was gpProtected -- important for the JIT */
+	env->gpProtected = 1;
+
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
+
+	omrthread_monitor_enter(helperPool->monitor);
+	while (FINALIZE_WORKER_STAY_ALIVE == helperPool->die) {
+		if (workRequestSeen == helperPool->workRequest) {
+			omrthread_monitor_wait(helperPool->monitor);
+			continue;
+		}
+		workRequestSeen = helperPool->workRequest;
+		helperPool->startedCount += 1;
+		helperPool->activeCount += 1;
+		omrthread_monitor_exit(helperPool->monitor);
+
+		fns->internalEnterVMFromJNI(env);
+		startReferenceProcessing(vm, finalizeListManager);
+
+		while (FINALIZE_WORKER_STAY_ALIVE == helperPool->die) {
+			/* Class loaders are left to the worker thread */
+			finalizeListManager->lock();
+			finalizeJob = finalizeListManager->consumeJob(env, &localJob, false);
+			finalizeListManager->unlock();
+
+			if (NULL == finalizeJob) {
+				break;
+			}
+
+			/* processing will release/acquire VM access */
+			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+
+			notifyReferenceProcessingProgress(vm, finalizeListManager);
+
+			fns->jniResetStackReferences((JNIEnv *)env);
+		}
+
+		fns->internalReleaseVMAccess(env);
+
+		omrthread_monitor_enter(helperPool->monitor);
+		helperPool->activeCount -= 1;
+		omrthread_monitor_notify_all(helperPool->monitor);
+	}
+	omrthread_monitor_exit(helperPool->monitor);
+
+	if (j9VMInternalsClass) {
+		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
+	}
+
+	((JavaVM *)vm)->DetachCurrentThread();
+
+#if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
+	if( vm->javaOffloadSwitchOffNoEnvWithReasonFunc != NULL ) {
+		(*vm->javaOffloadSwitchOffNoEnvWithReasonFunc)(vm, omrthread_self(), J9_JNI_OFFLOAD_SWITCH_FINALIZE_WORKER_THREAD);
+	}
+#endif
+
+	exitFinalizeHelperThread(helperPool, workRequestSeen);
+
+	return 0;
+}
+
+static UDATA
+FinalizeHelperThreadGlue(J9PortLibrary* portLib, void* userData)
+{
+	return FinalizeHelperThread(userData);
+}
+
+static int J9THREAD_PROC 
+gpProtectedFinalizeHelperThread(void *entryArg)
+{
+	struct finalizeHelperPool *helperPool = (struct finalizeHelperPool *) entryArg;
+	PORT_ACCESS_FROM_PORT(helperPool->vm->portLibrary);
+	UDATA rc;
+
+	j9sig_protect(FinalizeHelperThreadGlue, helperPool, 
+		helperPool->vm->internalVMFunctions->structuredSignalHandlerVM, helperPool->vm,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION, 
+		&rc);
+
+	return 0;
+}
+
+/**
+ * Ask the helper threads to drain the finalize queue, creating helpers as needed
+ * so that up to -Xgc:finalizeWorkerThreads threads (including the worker) share the jobs.
+ *
+ * @param indirectHelperPool[in/out] the pool, allocated on first use
+ * @param jobCount[in] number of jobs on the queue
+ */
+static void
+wakeFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool **indirectHelperPool, UDATA jobCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	struct finalizeHelperPool *helperPool = *indirectHelperPool;
+
+	if (NULL == helperPool) {
+		helperPool = (struct finalizeHelperPool *) extensions->getForge()->allocate(sizeof(struct finalizeHelperPool), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+		if (NULL == helperPool) {
+			/* The worker does all the work */
+			return;
+		}
+		helperPool->vm = vm;
+		helperPool->threadCount = 0;
+		helperPool->activeCount = 0;
+		helperPool->workRequest = 0;
+		helperPool->startedCount = 0;
+		helperPool->die = FINALIZE_WORKER_STAY_ALIVE;
+		if (0 != omrthread_monitor_init_with_name(&helperPool->monitor, 0, "Finalizer helper pool")) {
+			extensions->getForge()->free(helperPool);
+			return;
+		}
+		*indirectHelperPool = helperPool;
+	}
+
+	omrthread_monitor_enter(helperPool->monitor);
+	/* One job is for the worker; there is no point in creating more helpers than remaining jobs */
+	while (((helperPool->threadCount + 1) < extensions->finalizeWorkerThreads) && ((helperPool->threadCount + 1) < jobCount)) {
+		helperPool->threadCount += 1;
+		IDATA result = vm->internalVMFunctions->createThreadWithCategory(
+							NULL,
+							vm->defaultOSStackSize,
+							extensions->finalizeWorkerPriority,
+							0,
+							&gpProtectedFinalizeHelperThread,
+							helperPool,
+							J9THREAD_CATEGORY_APPLICATION_THREAD);
+		if (0 != result) {
+			helperPool->threadCount -= 1;
+			break;
+		}
+	}
+	helperPool->workRequest += 1;
+	helperPool->startedCount = 0;
+	omrthread_monitor_notify_all(helperPool->monitor);
+	omrthread_monitor_exit(helperPool->monitor);
+}
+
+/*
+ * Wait for the helper threads to finish the jobs they took from the queue, including
+ * helpers that were woken up but have not picked up the request yet.
+ * The wait is bounded like the wait in runFinalization() so that a finalizer that
+ * never completes on a helper thread does not block the main thread.
+ *
+ * Preconditions:
+ * 	holds finalizeMainMonitor
+ * Postconditions:
+ * 	holds finalizeMainMonitor
+ */
+static void
+waitForFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool *helperPool)
+{
+	if (NULL != helperPool) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		I_64 deadline = j9time_current_time_millis() + 1000;
+
+		/* A finalizer running on a helper may call runFinalization(), which needs finalizeMainMonitor */
+		omrthread_monitor_exit(vm->finalizeMainMonitor);
+		omrthread_monitor_enter(helperPool->monitor);
+		while ((0 != helperPool->activeCount) || (helperPool->startedCount != helperPool->threadCount)) {
+			I_64 remaining = deadline - j9time_current_time_millis();
+			if (remaining <= 0) {
+				break;
+			}
+			omrthread_monitor_wait_timed(helperPool->monitor, remaining, 0);
+		}
+		omrthread_monitor_exit(helperPool->monitor);
+		omrthread_monitor_enter(vm->finalizeMainMonitor);
+	}
+}
+
+/**
+ * Tell the helper threads to exit and wait for the idle ones to be gone, so that no helper
+ * detaches from the VM while it is being torn down. Like an abandoned worker, a helper that
+ * is stuck in a finalizer is not waited for; the last such helper to exit frees the pool.
+ *
+ * Preconditions:
+ * 	holds finalizeMainMonitor
+ * Postconditions:
+ * 	holds finalizeMainMonitor
+ */
+static void
+shutdownFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool *helperPool)
+{
+	if (NULL != helperPool) {
+		MM_Forge *forge = MM_GCExtensions::getExtensions(vm)->getForge();
+		bool freePool = false;
+
+		/* A finalizer that is finishing on a helper may call runFinalization(), which needs finalizeMainMonitor */
+		omrthread_monitor_exit(vm->finalizeMainMonitor);
+		omrthread_monitor_enter(helperPool->monitor);
+		helperPool->die = FINALIZE_WORKER_SHOULD_DIE;
+		omrthread_monitor_notify_all(helperPool->monitor);
+		/* Active helpers notice the request between jobs, and then exit too */
+		while (helperPool->threadCount != helperPool->activeCount) {
+			omrthread_monitor_wait(helperPool->monitor);
+		}
+		if (0 == helperPool->threadCount) {
+			freePool = true;
+		} else {
+			helperPool->die = FINALIZE_WORKER_ABANDONED;
+		}
+		omrthread_monitor_exit(helperPool->monitor);
+
+		if (freePool) {
+			omrthread_monitor_destroy(helperPool->monitor);
+			forge->free(helperPool);
+		}
+		omrthread_monitor_enter(vm->finalizeMainMonitor);
+	}
+}
+
 void
 j9gc_finalizer_completeFinalizersOnExit(J9VMThread* vmThread)
 {
@@ -149,6 +149,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA finalizeMainPriority; /**< cmd line option to set finalize main thread priority */
 	UDATA finalizeWorkerPriority; /**< cmd line option to set finalize worker thread priority */
+	UDATA finalizeWorkerThreads; /**< cmd line option to set the number of threads that run finalizers and enqueue references */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -195,6 +196,14 @@ public:
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 	UDATA minimumFreeSizeForSurvivor; /**< minimum free size can be reused by collector as survivor, for balanced GC only */
 	UDATA freeSizeThresholdForSurvivor; /**< if average freeSize(freeSize/freeCount) of the region is smaller than the Threshold, the region would not be reused by collector as survivor, for balanced GC only */
+	UDATA tarokTargetMaxPauseTime; /**< -Xgc:targetPausetime= in milliseconds, for balanced GC only: eden is sized so that predicted PGC pauses stay within it (0 if not specified) */
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+	bool isSoftMxLoweredForRestore; /**< true if j9gc_reconfigure_for_restore() lowered the softmx for the memory of the restored process */
+	UDATA softMxBeforeRestore; /**< softmx before it was lowered by j9gc_reconfigure_for_restore() */
+	UDATA softMxSetForRestore; /**< softmx set by j9gc_reconfigure_for_restore() */
+	UDATA tlhMaximumSizeBeforeRestore; /**< maximum TLH size before it was reduced by j9gc_reconfigure_for_restore(), 0 if it was not */
+	bool isHeapLimitSetByUser; /**< true if -Xmx, -Xsoftmx or -XX:MaxRAMPercentage was specified; j9gc_reconfigure_for_restore() then leaves the softmx alone */
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 protected:
 private:
 protected:
@@ -308,6 +317,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMainPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeWorkerPriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeWorkerThreads(1)
 #endif /* J9VM_GC_FINALIZATION */
 		, classLoaderManager(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -327,6 +337,14 @@ public:
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, minimumFreeSizeForSurvivor(DEFAULT_SURVIVOR_MINIMUM_FREESIZE)
 		, freeSizeThresholdForSurvivor(DEFAULT_SURVIVOR_THRESHOLD)
+		, tarokTargetMaxPauseTime(0)
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+		, isSoftMxLoweredForRestore(false)
+		, softMxBeforeRestore(0)
+		, softMxSetForRestore(0)
+		, tlhMaximumSizeBeforeRestore(0)
+		, isHeapLimitSetByUser(false)
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -161,6 +161,10 @@ extern J9_CFUNC j9object_t j9gc_objaccess_staticReadObject(J9VMThread *vmThread,
 extern J9_CFUNC UDATA j9gc_objaccess_indexableReadU8(J9VMThread *vmThread, J9IndexableObject *srcObject, I_32 index, UDATA isVolatile);
 extern J9_CFUNC UDATA j9gc_get_softmx(J9JavaVM *javaVM);
 extern J9_CFUNC UDATA j9gc_set_softmx(J9JavaVM *javaVM, UDATA newsoftmx);
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+extern J9_CFUNC void j9gc_reconfigure_for_restore(J9VMThread *vmThread);
+extern J9_CFUNC void j9gc_clear_softmx(J9JavaVM *javaVM);
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 extern J9_CFUNC void j9gc_finalizer_shutdown(J9JavaVM * vm);
 extern J9_CFUNC UDATA j9gc_get_object_size_in_bytes(J9JavaVM* javaVM, j9object_t objectPtr);
 extern J9_CFUNC UDATA j9gc_get_object_total_footprint_in_bytes(J9JavaVM *javaVM, j9object_t objectPtr);
@@ -169,6 +173,7 @@ extern J9_CFUNC void j9gc_objaccess_indexableStoreU64Split(J9VMThread *vmThread,
 extern J9_CFUNC void cleanupMutatorModelJava(J9VMThread* vmThread);
 extern J9_CFUNC j9object_t j9gc_objaccess_mixedObjectReadObject(J9VMThread *vmThread, j9object_t srcObject, UDATA offset, UDATA isVolatile);
 extern J9_CFUNC UDATA j9gc_get_objects_pending_finalization_count(J9JavaVM* vm);
+extern J9_CFUNC U_64 j9gc_get_oldest_pending_finalization_age(J9JavaVM* vm);
 extern J9_CFUNC void j9gc_objaccess_indexableStoreU16(J9VMThread *vmThread, J9IndexableObject *destObject, I_32 index, U_32 value, UDATA isVolatile);
 extern J9_CFUNC void j9gc_objaccess_jniDeleteGlobalReference(J9VMThread *vmThread, j9object_t reference);
 extern J9_CFUNC UDATA isObjectInMemorySpace(J9VMThread *vmThread, void *memorySpace, j9object_t objectPtr);
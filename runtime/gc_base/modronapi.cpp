@@ -803,6 +803,87 @@ j9gc_get_maximum_heap_size(J9JavaVM *javaVM)
 	return size;
 }
 
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+/**
+ * API for the VM to adapt the heap sizing to the machine a checkpoint is restored on.
+ * The softmx is lowered when the restored process has less memory than the heap may grow to,
+ * unless the user chose the heap limits with -Xmx, -Xsoftmx or -XX:MaxRAMPercentage, or set
+ * a softmx at run time. The maximum TLH size is reduced when many CPUs share a small heap.
+ * The adjustments made by a previous restore are undone first, so they never accumulate.
+ *
+ * The number of active GC threads needs no adjustment: the dispatcher recomputes it from the
+ * target CPUs at the start of each cycle, bounded by the threads started with the VM.
+ *
+ * Must be called while holding exclusive VM access.
+ */
+void
+j9gc_reconfigure_for_restore(J9VMThread *vmThread)
+{
+	J9JavaVM *javaVM = vmThread->javaVM;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+	U_64 physicalMemory = j9sysinfo_get_physical_memory();
+
+	/* Leave a softmx changed since the previous restore (e.g. through j.l.management) alone */
+	if (extensions->isSoftMxLoweredForRestore) {
+		if (extensions->softMx == extensions->softMxSetForRestore) {
+			extensions->softMx = extensions->softMxBeforeRestore;
+		}
+		extensions->isSoftMxLoweredForRestore = false;
+	}
+	if (0 != extensions->tlhMaximumSizeBeforeRestore) {
+		extensions->tlhMaximumSize = extensions->tlhMaximumSizeBeforeRestore;
+		extensions->tlhMaximumSizeBeforeRestore = 0;
+	}
+
+	if (0 != physicalMemory) {
+		extensions->usablePhysicalMemory = physicalMemory;
+
+		/* Only a heap limit the JVM picked by default is adapted to the new machine */
+		if (!extensions->isHeapLimitSetByUser && (0 == extensions->softMx)) {
+			/* Same share of the memory as the default -Xmx in a container with a memory limit */
+			U_64 heapCeiling = OMR_MIN((physicalMemory / 4) * 3, (U_64)extensions->memoryMax);
+			UDATA softMx = MM_Math::roundToFloor(extensions->heapAlignment, (UDATA)heapCeiling);
+
+			softMx = OMR_MAX(softMx, extensions->initialMemorySize);
+			if (softMx < extensions->memoryMax) {
+				extensions->softMxBeforeRestore = extensions->softMx;
+				extensions->softMxSetForRestore = softMx;
+				extensions->softMx = softMx;
+				extensions->isSoftMxLoweredForRestore = true;
+			}
+		}
+	}
+
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+	/* The copy-forward caches of balanced are sized from the maximum TLH size at startup */
+	if (!extensions->isVLHGC()) {
+		/* Keep the TLHs held by one thread per CPU to a small share of the heap */
+		UDATA cpuCount = OMR_MAX((UDATA)1, j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET));
+		UDATA heapLimit = (0 == extensions->softMx) ? extensions->memoryMax : extensions->softMx;
+		UDATA tlhMaximumSize = MM_Math::roundToFloor(extensions->tlhIncrementSize, heapLimit / (16 * cpuCount));
+
+		tlhMaximumSize = OMR_MAX(tlhMaximumSize, OMR_MAX(extensions->tlhMinimumSize, extensions->tlhInitialSize));
+		if (tlhMaximumSize < extensions->tlhMaximumSize) {
+			extensions->tlhMaximumSizeBeforeRestore = extensions->tlhMaximumSize;
+			extensions->tlhMaximumSize = tlhMaximumSize;
+		}
+	}
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
+}
+
+/**
+ * API for the VM to remove the softmx, as if none had ever been set.
+ * Used to put back an unset softmx that was lowered for a checkpoint, which
+ * j9gc_set_softmx cannot do since it only accepts sizes within the heap bounds.
+ */
+void
+j9gc_clear_softmx(J9JavaVM *javaVM)
+{
+	MM_GCExtensions::getExtensions(javaVM)->softMx = 0;
+}
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
+
 /**
  * API to return a string representing the current GC mode.
  * Examples of the string returned are "optthruput", and "gencon".
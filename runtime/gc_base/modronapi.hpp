@@ -83,6 +83,10 @@ UDATA j9gc_set_softmx(J9JavaVM *javaVM, UDATA newsoftMx);
 UDATA j9gc_get_softmx(J9JavaVM *javaVM);
 UDATA j9gc_get_initial_heap_size(J9JavaVM *javaVM);
 UDATA j9gc_get_maximum_heap_size(J9JavaVM *javaVM);
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+void j9gc_reconfigure_for_restore(J9VMThread *vmThread);
+void j9gc_clear_softmx(J9JavaVM *javaVM);
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 const char *j9gc_get_gcmodestring(J9JavaVM *javaVM);
 UDATA j9gc_get_object_size_in_bytes(J9JavaVM *javaVM, j9object_t objectPtr);
 UDATA j9gc_get_object_total_footprint_in_bytes(J9JavaVM *javaVM, j9object_t objectPtr);
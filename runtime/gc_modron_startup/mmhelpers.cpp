@@ -217,6 +217,17 @@ j9gc_get_objects_pending_finalization_count(J9JavaVM *javaVM)
 {
 	return MM_GCExtensions::getExtensions(javaVM)->finalizeListManager->getJobCount();
 }
+
+/**
+ * Return how long the oldest object on the finalize queue has been waiting.
+ * A steadily increasing value means that finalization does not keep up with the application.
+ * @return age of the oldest pending job in milliseconds, or 0 if the queue is empty
+ */
+U_64
+j9gc_get_oldest_pending_finalization_age(J9JavaVM *javaVM)
+{
+	return MM_GCExtensions::getExtensions(javaVM)->finalizeListManager->getOldestJobAge();
+}
 #endif /* J9VM_GC_FINALIZATION */
 
 UDATA
@@ -2872,6 +2872,9 @@ gcInitializeDefaults(J9JavaVM* vm)
 		/* Update memory parameter table to appear that -Xmx was specified */
 		memoryParameterTable[opt_Xmx] = memoryParameterTable[opt_maxRAMPercent];
 	}
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+	extensions->isHeapLimitSetByUser = (-1 != memoryParameterTable[opt_Xmx]) || (-1 != memoryParameterTable[opt_Xsoftmx]);
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
 	if (gc_policy_metronome == extensions->configurationOptions._gcPolicy) {
 		/* Heap is segregated; take into account segregatedAllocationCache. */
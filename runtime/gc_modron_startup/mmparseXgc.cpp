@@ -162,28 +162,36 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		goto _exit;
 	}
 
+	if (try_scan(scan_start, "overrideHiresTimerCheck")) {
+		extensions->overrideHiresTimerCheck = true;
+		goto _exit;
+	}
+
+#endif /* J9VM_GC_REALTIME */
+
+#if defined(J9VM_GC_REALTIME) || defined(J9VM_GC_VLHGC)
 	if (try_scan(scan_start, "targetPausetime=")) {
 		/* the unit of target pause time option is in milliseconds */
-		UDATA beatMilli = 0;
-		if(!scan_udata_helper(javaVM, scan_start, &beatMilli, "targetPausetime=")) {
+		UDATA targetPauseMilli = 0;
+		if(!scan_udata_helper(javaVM, scan_start, &targetPauseMilli, "targetPausetime=")) {
 			goto _error;
 		}
-		if(0 == beatMilli) {
+		if(0 == targetPauseMilli) {
 			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "targetPausetime=", (UDATA)0);
 			goto _error;
 		}
-		/* convert the unit to microseconds and store in extensions */
-		extensions->beatMicro = beatMilli * 1000;
+#if defined(J9VM_GC_REALTIME)
+		/* metronome uses the target as its beat; convert the unit to microseconds and store in extensions */
+		extensions->beatMicro = targetPauseMilli * 1000;
+#endif /* J9VM_GC_REALTIME */
+#if defined(J9VM_GC_VLHGC)
+		/* balanced sizes eden so that predicted partial GC pauses stay within the target */
+		extensions->tarokTargetMaxPauseTime = targetPauseMilli;
+#endif /* J9VM_GC_VLHGC */
 
 		goto _exit;
 	}
-
-	if (try_scan(scan_start, "overrideHiresTimerCheck")) {
-		extensions->overrideHiresTimerCheck = true;
-		goto _exit;
-	}
-
-#endif /* J9VM_GC_REALTIME */
+#endif /* J9VM_GC_REALTIME || J9VM_GC_VLHGC */
 
 //todo temporary option to allow LOA to be enabled for testing with non-default gc policies
 //Remove once LOA code stable 
@@ -1298,6 +1306,18 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeWorkerThreads=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeWorkerThreads, "finalizeWorkerThreads=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((extensions->finalizeWorkerThreads < 1) || (extensions->finalizeWorkerThreads > 64)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:finalizeWorkerThreads", (UDATA)1, (UDATA)64);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
@@ -40,6 +40,44 @@
 
 #include "ReferenceStats.hpp"
 
+/**
+ * Copy-forward statistics for a single NUMA node.
+ * @ingroup GC_Stats
+ */
+class MM_CopyForwardNumaNodeStats
+{
+public:
+	uintptr_t _copyBytes; /**< bytes copied into survivor memory owned by allocation contexts of this node */
+	uintptr_t _copyBytesRemote; /**< part of _copyBytes which was copied by GC threads with affinity to another node */
+	uintptr_t _scanCachesLocal; /**< scan caches taken from this node's scan cache list by GC threads with affinity to this node */
+	uintptr_t _scanCachesStolen; /**< scan caches taken from this node's scan cache list by GC threads with affinity to another node */
+	uintptr_t _survivorRegionsForeign; /**< survivor regions acquired for allocation contexts of this node which had to be taken from another node */
+
+	MMINLINE void clear() {
+		_copyBytes = 0;
+		_copyBytesRemote = 0;
+		_scanCachesLocal = 0;
+		_scanCachesStolen = 0;
+		_survivorRegionsForeign = 0;
+	}
+
+	MMINLINE void merge(MM_CopyForwardNumaNodeStats *stats) {
+		_copyBytes += stats->_copyBytes;
+		_copyBytesRemote += stats->_copyBytesRemote;
+		_scanCachesLocal += stats->_scanCachesLocal;
+		_scanCachesStolen += stats->_scanCachesStolen;
+		_survivorRegionsForeign += stats->_survivorRegionsForeign;
+	}
+
+	MM_CopyForwardNumaNodeStats()
+		: _copyBytes(0)
+		, _copyBytesRemote(0)
+		, _scanCachesLocal(0)
+		, _scanCachesStolen(0)
+		, _survivorRegionsForeign(0)
+	{}
+};
+
 /**
  * Storage for statistics relevant to a copy forward collector.
  * @ingroup GC_Stats
@@ -74,6 +112,11 @@ public:
 
 	uint64_t _cycleStartTime; /**< The start time of a copy forward cycle */
 
+	enum {
+		MAX_NUMA_NODE_STATS = 16 /**< number of nodes with their own entry in _numaNodeStats; higher node numbers are accounted to the last entry */
+	};
+	MM_CopyForwardNumaNodeStats _numaNodeStats[MAX_NUMA_NODE_STATS]; /**< per-node stats indexed by NUMA node number (0 is the common context, which has no affinity) */
+
 private:
 	
 	/* 
@@ -105,6 +148,17 @@ public:
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+		for (uintptr_t i = 0; i < MAX_NUMA_NODE_STATS; i++) {
+			_numaNodeStats[i].clear();
+		}
+	}
+
+	/**
+	 * @return the per-node stats for the given NUMA node number
+	 */
+	MMINLINE MM_CopyForwardNumaNodeStats *getNumaNodeStats(uintptr_t numaNode) {
+		return &_numaNodeStats[(numaNode < MAX_NUMA_NODE_STATS) ? numaNode : (MAX_NUMA_NODE_STATS - 1)];
 	}
 	
 	/**
@@ -132,6 +186,10 @@ public:
 		_doubleMappedArrayletsCleared += stats->_doubleMappedArrayletsCleared;
 		_doubleMappedArrayletsCandidates += stats->_doubleMappedArrayletsCandidates;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+		for (uintptr_t i = 0; i < MAX_NUMA_NODE_STATS; i++) {
+			_numaNodeStats[i].merge(&stats->_numaNodeStats[i]);
+		}
 	}
 
 	MM_CopyForwardStats() :
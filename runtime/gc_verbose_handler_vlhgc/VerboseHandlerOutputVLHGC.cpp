@@ -30,6 +30,7 @@
 #include "GCExtensions.hpp"
 #include "MarkVLHGCStats.hpp"
 #include "ReferenceStats.hpp"
+#include "SchedulingDelegate.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseHandlerJava.hpp"
@@ -318,6 +319,22 @@ MM_VerboseHandlerOutputVLHGC::outputMemoryInfoInnerStanza(MM_EnvironmentBase *en
 				((UDATA)(((U_64)stats->_edenFreeHeapSize*100) / (U_64)stats->_edenHeapSize)));
 	}
 
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_CycleState *cycleState = env->_cycleState;
+	if ((0 != extensions->tarokTargetMaxPauseTime) && (NULL != cycleState) && (MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == cycleState->_collectionType)) {
+		MM_SchedulingDelegate *schedulingDelegate = static_cast<MM_CycleStateVLHGC*>(cycleState)->_schedulingDelegate;
+		/* the PGC is timed from within its increment, so only report at the end of the increment which the last measurement belongs to */
+		if (stats->_startTime <= schedulingDelegate->getLastPartialGCStartTime()) {
+			U_64 predictedMicros = schedulingDelegate->getLastPredictedPartialGCTimeMicros();
+			U_64 actualMicros = schedulingDelegate->getLastPartialGCTimeMicros();
+			/* predictedms is 0 until a copy-forward PGC has been measured */
+			writer->formatAndOutput(env, indent, "<pause-target targetms=\"%zu\" predictedms=\"%llu.%03llu\" actualms=\"%llu.%03llu\" />",
+					extensions->tarokTargetMaxPauseTime,
+					predictedMicros / 1000, predictedMicros % 1000,
+					actualMicros / 1000, actualMicros % 1000);
+		}
+	}
+
 	if (0 != stats->_arrayletReferenceObjects) {
 		writer->formatAndOutput(env, indent, "<arraylet-reference objects=\"%zu\" leaves=\"%zu\" largest=\"%zu\" />",
 				stats->_arrayletReferenceObjects, stats->_arrayletReferenceLeaves, stats->_largestReferenceArraylet);
@@ -407,6 +424,16 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 				(copyForwardStats->_edenEvacuateRegionCount + copyForwardStats->_nonEdenEvacuateRegionCount - copyForwardStats->_nonEvacuateRegionCount),
 				copyForwardStats->_nonEvacuateRegionCount);
 	}
+	if (extensions->_numaManager.isPhysicalNUMASupported()) {
+		UDATA lastNode = OMR_MIN(extensions->_numaManager.getMaximumNodeNumber(), (UDATA)MM_CopyForwardStats::MAX_NUMA_NODE_STATS - 1);
+		for (UDATA node = 0; node <= lastNode; node++) {
+			MM_CopyForwardNumaNodeStats *nodeStats = &copyForwardStats->_numaNodeStats[node];
+			if ((0 != nodeStats->_copyBytes) || (0 != nodeStats->_scanCachesLocal) || (0 != nodeStats->_scanCachesStolen) || (0 != nodeStats->_survivorRegionsForeign)) {
+				writer->formatAndOutput(env, 1, "<numa-node id=\"%zu\" bytescopied=\"%zu\" remotebytescopied=\"%zu\" localscancaches=\"%zu\" stolenscancaches=\"%zu\" foreignsurvivorregions=\"%zu\" />",
+						node, nodeStats->_copyBytes, nodeStats->_copyBytesRemote, nodeStats->_scanCachesLocal, nodeStats->_scanCachesStolen, nodeStats->_survivorRegionsForeign);
+			}
+		}
+	}
 	outputRememberedSetClearedInfo(env, irrsStats);
 
 	outputUnfinalizedInfo(env, 1, copyForwardStats->_unfinalizedCandidates, copyForwardStats->_unfinalizedEnqueued);
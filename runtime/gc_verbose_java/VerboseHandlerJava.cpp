@@ -47,7 +47,8 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	UDATA classloaderCount = finalizeListManager->getClassloaderCount();
 
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
-		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
+		U_64 oldestAge = finalizeListManager->getOldestJobAge();
+		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" oldestagems=\"%llu\" />", systemCount, defaultCount, referenceCount, classloaderCount, oldestAge);
 	}
 }
 
@@ -127,6 +127,9 @@
  */
 #define COMMON_CONTEXT_INDEX 0
 
+/* the number of times a GC thread yields and re-checks its own node's scan cache lists before it steals a scan cache from another node */
+#define REMOTE_SCAN_CACHE_STEAL_BACKOFF_YIELDS 4
+
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
@@ -770,6 +773,11 @@ MM_CopyForwardScheme::acquireEmptyRegion(MM_EnvironmentVLHGC *env, MM_ReservedRe
 		newRegion = allocationContext->collectorAcquireRegion(env);
 
 		if(NULL != newRegion) {
+			UDATA contextNumaNode = allocationContext->getNumaNode();
+			if ((COMMON_CONTEXT_INDEX != contextNumaNode) && (newRegion->getNumaNode() != contextNumaNode)) {
+				/* the context ran out of free regions on its own node and stole this one */
+				env->_copyForwardStats.getNumaNodeStats(contextNumaNode)->_survivorRegionsForeign += 1;
+			}
 			MM_CycleState *cycleState = env->_cycleState;
 			MM_CycleState *externalCycleState = env->_cycleState->_externalCycleState;
 			
@@ -1484,6 +1492,7 @@ MM_CopyForwardScheme::mergeGCStats(MM_EnvironmentVLHGC *env)
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 	MM_CopyForwardStats *localStats = &env->_copyForwardStats;
 	MM_CompactGroupPersistentStats *persistentStats = _extensions->compactGroupPersistentStats;
+	UDATA nodeOfThread = _extensions->_numaManager.isPhysicalNUMASupported() ? env->getNumaAffinity() : 0;
 
 	/* the following statistics are only updated at the merge point */
 	Assert_MM_true(0 == localStats->_copyObjectsTotal);
@@ -1536,6 +1545,16 @@ MM_CopyForwardScheme::mergeGCStats(MM_EnvironmentVLHGC *env)
 		if (0 != totalCopiedBytes) {
 			MM_AtomicOperations::add(&persistentStats[compactGroupNumber]._measuredBytesCopiedToGroupDuringCopyForward, totalCopiedBytes);
 			MM_AtomicOperations::addU64(&persistentStats[compactGroupNumber]._measuredAllocationAgeToGroupDuringCopyForward, compactGroup->_allocationAge);
+
+			/* survivor memory of a compact group comes from the node of the group's allocation context */
+			UDATA allocationContextNumber = MM_CompactGroupManager::getAllocationContextNumberFromGroup(env, compactGroupNumber);
+			MM_AllocationContextTarok *allocationContext = (MM_AllocationContextTarok *)_extensions->globalAllocationManager->getAllocationContextByIndex(allocationContextNumber);
+			UDATA destinationNode = allocationContext->getNumaNode();
+			MM_CopyForwardNumaNodeStats *nodeStats = localStats->getNumaNodeStats(destinationNode);
+			nodeStats->_copyBytes += totalCopiedBytes;
+			if ((COMMON_CONTEXT_INDEX != destinationNode) && (destinationNode != nodeOfThread)) {
+				nodeStats->_copyBytesRemote += totalCopiedBytes;
+			}
 		}
 
 		if (0 != (totalCopiedBytes + compactGroup->_discardedBytes)) {
@@ -2731,12 +2750,18 @@ MM_CopyForwardScheme::getNextWorkUnit(MM_EnvironmentVLHGC *env, UDATA preferredN
 }
 
 MM_CopyForwardScheme::ScanReason
-MM_CopyForwardScheme::getNextWorkUnitOnNode(MM_EnvironmentVLHGC *env, UDATA numaNode)
+MM_CopyForwardScheme::getNextWorkUnitOnNode(MM_EnvironmentVLHGC *env, UDATA numaNode, UDATA preferredNumaNode)
 {
 	ScanReason ret = SCAN_REASON_NONE;
 
 	MM_CopyScanCacheVLHGC *cache = _cacheScanLists[numaNode].popCache(env);
 	if(NULL != cache) {
+		MM_CopyForwardNumaNodeStats *nodeStats = env->_copyForwardStats.getNumaNodeStats(numaNode);
+		if ((numaNode == preferredNumaNode) || (COMMON_CONTEXT_INDEX == numaNode) || (COMMON_CONTEXT_INDEX == preferredNumaNode)) {
+			nodeStats->_scanCachesLocal += 1;
+		} else {
+			nodeStats->_scanCachesStolen += 1;
+		}
 		/* Check if there are threads waiting that should be notified because of pending entries */
 		if((0 != *_workQueueWaitCountPtr) && isScanCacheWorkAvailable(&_cacheScanLists[numaNode])) {
 			omrthread_monitor_enter(*_workQueueMonitorPtr);
@@ -2752,27 +2777,39 @@ MM_CopyForwardScheme::getNextWorkUnitOnNode(MM_EnvironmentVLHGC *env, UDATA numa
 	return ret;
 }
 
+MM_CopyForwardScheme::ScanReason
+MM_CopyForwardScheme::getNextLocalWorkUnit(MM_EnvironmentVLHGC *env, UDATA preferredNumaNode)
+{
+	/* local node first */
+	ScanReason ret = getNextWorkUnitOnNode(env, preferredNumaNode, preferredNumaNode);
+	if ((SCAN_REASON_NONE == ret) && (COMMON_CONTEXT_INDEX != preferredNumaNode)) {
+		/* the common node has no affinity so its caches are as close to us as to anyone else */
+		ret = getNextWorkUnitOnNode(env, COMMON_CONTEXT_INDEX, preferredNumaNode);
+	}
+	return ret;
+}
+
 MM_CopyForwardScheme::ScanReason
 MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA preferredNumaNode)
 {
 	UDATA nodeLists = _scanCacheListSize;
-	ScanReason ret = SCAN_REASON_NONE;
-	/* local node first */
-	ret = getNextWorkUnitOnNode(env, preferredNumaNode);
-	if (SCAN_REASON_NONE == ret) {
-		/* we failed to find a scan cache on our preferred node */
-		if (COMMON_CONTEXT_INDEX != preferredNumaNode) {
-			/* try the common node */
-			ret = getNextWorkUnitOnNode(env, COMMON_CONTEXT_INDEX);
-		}
-		/* now try the remaining nodes */
-		UDATA nextNode = (preferredNumaNode + 1) % nodeLists;
-		while ((SCAN_REASON_NONE == ret) && (nextNode != preferredNumaNode)) {
-			if (COMMON_CONTEXT_INDEX != nextNode) {
-				ret = getNextWorkUnitOnNode(env, nextNode);
-			}
-			nextNode = (nextNode + 1) % nodeLists;
+	ScanReason ret = getNextLocalWorkUnit(env, preferredNumaNode);
+	if ((SCAN_REASON_NONE == ret) && (COMMON_CONTEXT_INDEX != preferredNumaNode) && isAnyScanCacheWorkAvailable()) {
+		/* Scanning another node's cache means copying its objects through remote memory. Give the threads
+		 * of that node a chance to take it, and give our own node a chance to produce more work, before stealing.
+		 */
+		for (UDATA backoff = 0; (SCAN_REASON_NONE == ret) && (backoff < REMOTE_SCAN_CACHE_STEAL_BACKOFF_YIELDS); backoff++) {
+			omrthread_yield();
+			ret = getNextLocalWorkUnit(env, preferredNumaNode);
+		}
+	}
+	/* now steal from the remaining nodes */
+	UDATA nextNode = (preferredNumaNode + 1) % nodeLists;
+	while ((SCAN_REASON_NONE == ret) && (nextNode != preferredNumaNode)) {
+		if (COMMON_CONTEXT_INDEX != nextNode) {
+			ret = getNextWorkUnitOnNode(env, nextNode, preferredNumaNode);
 		}
+		nextNode = (nextNode + 1) % nodeLists;
 	}
 	if (SCAN_REASON_NONE == ret && (0 != _regionCountCannotBeEvacuated) && !abortFlagRaised()) {
 		if (env->_workStack.retrieveInputPacket(env)) {
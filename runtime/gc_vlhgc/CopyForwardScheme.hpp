@@ -608,11 +608,22 @@ private:
 	 */
 	ScanReason getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA preferredNumaNode);
 
+	/**
+	 * Tries to find a scan cache on the caller's NUMA node or on the common node (which has no affinity), without stealing from other nodes
+	 * @param env[in] The GC thread
+	 * @param preferredNumaNode[in] The NUMA node number of the caller
+	 * @return possible return value(SCAN_REASON_NONE, SCAN_REASON_COPYSCANCACHE)
+	 */
+	ScanReason getNextLocalWorkUnit(MM_EnvironmentVLHGC *env, UDATA preferredNumaNode);
+
 	/**
 	 * Tries to find a scan cache from the specified NUMA node or return SCAN_REASON_NONE if there was no work available on that node
+	 * @param env[in] The GC thread
+	 * @param numaNode[in] The NUMA node number of the scan cache list to take from
+	 * @param preferredNumaNode[in] The NUMA node number of the caller, used to account local and stolen scan caches
 	 * @return possible return value(SCAN_REASON_NONE, SCAN_REASON_COPYSCANCACHE)
 	 */
-	ScanReason getNextWorkUnitOnNode(MM_EnvironmentVLHGC *env, UDATA numaNode);
+	ScanReason getNextWorkUnitOnNode(MM_EnvironmentVLHGC *env, UDATA numaNode, UDATA preferredNumaNode);
 
 	/**
 	 * Complete scanning in Copy-Forward fashion (consume&produce CopyScanCaches)
@@ -60,6 +60,7 @@ const double measureScanRateHistoricWeightForPGC = 0.95;
 const double partialGCTimeHistoricWeight = 0.80;
 const double incrementalScanTimePerGMPHistoricWeight = 0.50;
 const double bytesScannedConcurrentlyPerGMPHistoricWeight = 0.50;
+const double partialGCTimeModelHistoricWeight = 0.70;
 
 MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager)
 	: MM_BaseNonVirtual()
@@ -99,6 +100,14 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _historicBytesScannedConcurrentlyPerGMP(0)
 	, _partialGcStartTime(0)
 	, _historicalPartialGCTime(0)
+	, _partialGCTimeModelSamples(0)
+	, _averageEdenBytesCopiedPerRegion(0.0)
+	, _averageNonEdenBytesCopied(0.0)
+	, _averagePartialGCOverheadMicros(0.0)
+	, _predictedPartialGCTimeMicros(0)
+	, _lastPredictedPartialGCTimeMicros(0)
+	, _lastPartialGCTimeMicros(0)
+	, _lastPartialGCStartTime(0)
 	, _dynamicGlobalMarkIncrementTimeMillis(50)
 	, _scanRateStats()
 {
@@ -246,6 +255,11 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 	_globalSweepRequired = false;
 	/* copy out the Eden size of the previous interval (between the last PGC and this one) before we recalculate the next one */
 	UDATA edenCountBeforeCollect = getCurrentEdenSizeInRegions(env);
+	/* the time of this PGC feeds the pause time model, so it has to be measured before the next Eden size is calculated */
+	U_64 pgcTimeMicros = j9time_hires_delta(_partialGcStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	_lastPredictedPartialGCTimeMicros = _predictedPartialGCTimeMicros;
+	_lastPartialGCTimeMicros = pgcTimeMicros;
+	_lastPartialGCStartTime = _partialGcStartTime;
 	
 	Trc_MM_SchedulingDelegate_partialGarbageCollectCompleted_stats(env->getLanguageVMThread(),
 			copyForwardStats->_edenEvacuateRegionCount,
@@ -272,6 +286,10 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 		if (0 != edenCountBeforeCollect) {
 			double thisSurvivalRate = (double)edenSurvivorCount / (double)edenCountBeforeCollect;
 			updateSurvivalRatesAfterCopyForward(thisSurvivalRate, nonEdenSurvivorCount);
+			/* an aborted copy-forward marks the remaining objects in place, so its time is not representative */
+			if (!copyForwardStats->_aborted && (U_32_MAX >= pgcTimeMicros)) {
+				updatePartialGCTimeModel(env, edenCountBeforeCollect, pgcTimeMicros);
+			}
 		}
 
 		if (copyForwardStats->_aborted && (0 ==_remainingGMPIntermissionIntervals)) {
@@ -1004,6 +1022,11 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	} else if (desiredEdenCount < edenMinimumCount) {
 		desiredEdenCount = edenMinimumCount;
 	}
+	if (0 != _extensions->tarokTargetMaxPauseTime) {
+		/* shrink Eden so that the predicted PGC time stays within the pause target, but never below the minimum Eden size */
+		UDATA pauseTargetEdenCount = OMR_MAX(calculateEdenRegionCountForPauseTarget(env), edenMinimumCount);
+		desiredEdenCount = OMR_MIN(desiredEdenCount, pauseTargetEdenCount);
+	}
 	Trc_MM_SchedulingDelegate_calculateEdenSize_dynamic(env->getLanguageVMThread(), desiredEdenCount, _edenSurvivalRateCopyForward, _nonEdenSurvivalCountCopyForward, freeRegions, edenMinimumCount, edenMaximumCount);
 	if (desiredEdenCount <= freeRegions) {
 		_edenRegionCount = desiredEdenCount;
@@ -1014,9 +1037,73 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 		_edenRegionCount = freeRegions;
 		Trc_MM_SchedulingDelegate_calculateEdenSize_reduceToFreeBytes(env->getLanguageVMThread(), desiredEdenCount, _edenRegionCount);
 	}
+	_predictedPartialGCTimeMicros = predictPartialGCTimeMicros(env, _edenRegionCount);
 	Trc_MM_SchedulingDelegate_calculateEdenSize_Exit(env->getLanguageVMThread(), (_edenRegionCount * regionSize));
 }
 
+U_64
+MM_SchedulingDelegate::predictPartialGCTimeMicros(MM_EnvironmentVLHGC *env, UDATA edenRegionCount) const
+{
+	U_64 predictedMicros = 0;
+
+	if ((0 != _partialGCTimeModelSamples) && (0.0 < _averageCopyForwardRate)) {
+		double bytesToCopy = ((double)edenRegionCount * _averageEdenBytesCopiedPerRegion) + _averageNonEdenBytesCopied;
+		predictedMicros = (U_64)((bytesToCopy / _averageCopyForwardRate) + _averagePartialGCOverheadMicros);
+	}
+
+	return predictedMicros;
+}
+
+UDATA
+MM_SchedulingDelegate::calculateEdenRegionCountForPauseTarget(MM_EnvironmentVLHGC *env) const
+{
+	UDATA edenRegionCount = UDATA_MAX;
+
+	if ((0 != _partialGCTimeModelSamples) && (0.0 < _averageCopyForwardRate) && (0.0 < _averageEdenBytesCopiedPerRegion)) {
+		double targetMicros = (double)_extensions->tarokTargetMaxPauseTime * 1000.0;
+		double fixedMicros = (_averageNonEdenBytesCopied / _averageCopyForwardRate) + _averagePartialGCOverheadMicros;
+		double microsPerEdenRegion = _averageEdenBytesCopiedPerRegion / _averageCopyForwardRate;
+
+		if (targetMicros <= fixedMicros) {
+			edenRegionCount = 0;
+		} else {
+			double regions = (targetMicros - fixedMicros) / microsPerEdenRegion;
+			if (regions < (double)UDATA_MAX) {
+				edenRegionCount = (UDATA)regions;
+			}
+		}
+	}
+
+	return edenRegionCount;
+}
+
+void
+MM_SchedulingDelegate::updatePartialGCTimeModel(MM_EnvironmentVLHGC *env, UDATA edenCountBeforeCollect, U_64 pgcTimeMicros)
+{
+	MM_CopyForwardStats *copyForwardStats = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats;
+
+	double edenBytesCopiedPerRegion = (double)copyForwardStats->_copyBytesEden / (double)edenCountBeforeCollect;
+	double nonEdenBytesCopied = (double)copyForwardStats->_copyBytesNonEden;
+	/* copyForwardCompleted() has already folded this PGC into _averageCopyForwardRate. Card cleaning runs inside the
+	 * copy-forward, so its cost is part of that rate; whatever the rate does not explain is treated as fixed overhead.
+	 */
+	double copyMicros = (0.0 < _averageCopyForwardRate) ? ((double)copyForwardStats->_copyBytesTotal / _averageCopyForwardRate) : 0.0;
+	double overheadMicros = OMR_MAX((double)pgcTimeMicros - copyMicros, 0.0);
+
+	if (0 == _partialGCTimeModelSamples) {
+		/* no history yet, so do not average with the initial values */
+		_averageEdenBytesCopiedPerRegion = edenBytesCopiedPerRegion;
+		_averageNonEdenBytesCopied = nonEdenBytesCopied;
+		_averagePartialGCOverheadMicros = overheadMicros;
+	} else {
+		const double newWeight = 1.0 - partialGCTimeModelHistoricWeight;
+		_averageEdenBytesCopiedPerRegion = (_averageEdenBytesCopiedPerRegion * partialGCTimeModelHistoricWeight) + (edenBytesCopiedPerRegion * newWeight);
+		_averageNonEdenBytesCopied = (_averageNonEdenBytesCopied * partialGCTimeModelHistoricWeight) + (nonEdenBytesCopied * newWeight);
+		_averagePartialGCOverheadMicros = (_averagePartialGCOverheadMicros * partialGCTimeModelHistoricWeight) + (overheadMicros * newWeight);
+	}
+	_partialGCTimeModelSamples += 1;
+}
+
 UDATA
 MM_SchedulingDelegate::currentGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC *env) const
 {
@@ -1030,6 +1117,10 @@ MM_SchedulingDelegate::currentGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC
 			markIncrementMillis = UDATA_MAX;
 		} else {
 			UDATA desiredGlobalMarkIncrementMillis = _dynamicGlobalMarkIncrementTimeMillis;
+			if (0 != _extensions->tarokTargetMaxPauseTime) {
+				/* GMP increments are pauses as well, so keep them within the target unless that would not finish the GMP before AF */
+				desiredGlobalMarkIncrementMillis = OMR_MIN(desiredGlobalMarkIncrementMillis, _extensions->tarokTargetMaxPauseTime);
+			}
 			double remainingMillisToScan = estimateRemainingTimeMillisToScan();
 			UDATA minimumGlobalMarkIncrementMillis = (UDATA) (remainingMillisToScan / (double)partialCollectsRemaining);
 
@@ -79,6 +79,15 @@ private:
 	U_64 _partialGcStartTime;  /**< Start time of the in progress Partial GC in hi-resolution format (recorded to track total time spent in Partial GC) */
 	U_64 _historicalPartialGCTime;  /**< Weighted historical average of Partial GC times */
 
+	UDATA _partialGCTimeModelSamples; /**< The number of copy-forward PGCs which have been used to update the PGC pause time model */
+	double _averageEdenBytesCopiedPerRegion; /**< Weighted average of bytes copied out of each Eden region by copy-forward PGCs, used to predict PGC pause times */
+	double _averageNonEdenBytesCopied; /**< Weighted average of bytes copied out of non-Eden regions by copy-forward PGCs, used to predict PGC pause times */
+	double _averagePartialGCOverheadMicros; /**< Weighted average of copy-forward PGC time which is not explained by copying at _averageCopyForwardRate (remembered set processing, sweep, etc.), in microseconds */
+	U_64 _predictedPartialGCTimeMicros; /**< Predicted time of the next PGC with the current Eden size, in microseconds (0 if there is no prediction yet) */
+	U_64 _lastPredictedPartialGCTimeMicros; /**< Time which was predicted for the most recent PGC, in microseconds (0 if there was no prediction) */
+	U_64 _lastPartialGCTimeMicros; /**< Measured time of the most recent PGC, in microseconds */
+	U_64 _lastPartialGCStartTime; /**< Start time of the most recent completed PGC in hi-resolution format */
+
 	UDATA _dynamicGlobalMarkIncrementTimeMillis;  /**< The dynamically calculated current time to be spent per GMP increment (subject to change over the course of the run) */
 
 	struct MM_SchedulingDelegate_ScanRateStats {
@@ -201,6 +210,32 @@ private:
 	 */
 	void calculateEdenSize(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Predict the time of a copy-forward PGC collecting the given number of Eden regions, based on the average
+	 * number of bytes surviving in Eden and non-Eden regions, the average copy-forward rate and the average
+	 * PGC overhead which is not proportional to the bytes copied.
+	 * @param env[in] the main GC thread
+	 * @param edenRegionCount[in] the number of Eden regions in the collection set
+	 * @return the predicted PGC time in microseconds, or 0 if no copy-forward PGC has been measured yet
+	 */
+	U_64 predictPartialGCTimeMicros(MM_EnvironmentVLHGC *env, UDATA edenRegionCount) const;
+
+	/**
+	 * Calculate the largest number of Eden regions whose predicted PGC time stays within -Xgc:targetPausetime.
+	 * @param env[in] the main GC thread
+	 * @return the number of Eden regions (could be 0 if the fixed costs alone exceed the target), or UDATA_MAX if
+	 * no copy-forward PGC has been measured yet or Eden survival does not contribute to the predicted time
+	 */
+	UDATA calculateEdenRegionCountForPauseTarget(MM_EnvironmentVLHGC *env) const;
+
+	/**
+	 * Called after a copy-forward PGC to update the averages used to predict PGC times.
+	 * @param env[in] the main GC thread
+	 * @param edenCountBeforeCollect[in] the number of Eden regions collected by this PGC
+	 * @param pgcTimeMicros[in] the measured time of this PGC, in microseconds
+	 */
+	void updatePartialGCTimeModel(MM_EnvironmentVLHGC *env, UDATA edenCountBeforeCollect, U_64 pgcTimeMicros);
+
 	/**
 	 * Calculate the new Global Mark increment time given the most recent Partial GC time.
 	 * Attempt to keep the GMP times in line with the times in PGC.  Keep track of a weighted
@@ -462,6 +497,21 @@ public:
 	
 	double getAvgEdenSurvivalRateCopyForward(MM_EnvironmentVLHGC *env) { return _edenSurvivalRateCopyForward; }
 
+	/**
+	 * @return the time which was predicted for the most recent PGC in microseconds, or 0 if there was no prediction
+	 */
+	U_64 getLastPredictedPartialGCTimeMicros() const { return _lastPredictedPartialGCTimeMicros; }
+
+	/**
+	 * @return the measured time of the most recent PGC in microseconds
+	 */
+	U_64 getLastPartialGCTimeMicros() const { return _lastPartialGCTimeMicros; }
+
+	/**
+	 * @return the start time of the most recent completed PGC in hi-resolution format
+	 */
+	U_64 getLastPartialGCStartTime() const { return _lastPartialGCStartTime; }
+
 	MM_SchedulingDelegate(MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager);
 };
 
@@ -84,6 +84,28 @@ Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getMemoryU
 	return getCollectorField(env, id, FIELD_MEMORY_USED);
 }
 
+jlong JNICALL
+Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getPendingFinalizationCountImpl(JNIEnv *env, jobject beanInstance)
+{
+#if defined(J9VM_GC_FINALIZATION)
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	return (jlong)javaVM->memoryManagerFunctions->j9gc_get_objects_pending_finalization_count(javaVM);
+#else
+	return (jlong)0;
+#endif
+}
+
+jlong JNICALL
+Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getOldestPendingFinalizationAgeImpl(JNIEnv *env, jobject beanInstance)
+{
+#if defined(J9VM_GC_FINALIZATION)
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	return (jlong)javaVM->memoryManagerFunctions->j9gc_get_oldest_pending_finalization_age(javaVM);
+#else
+	return (jlong)0;
+#endif
+}
+
 static UDATA
 getIndexFromCollectorID(J9JavaLangManagementData *mgmt, UDATA id)
 {
@@ -39,6 +39,8 @@ omr_add_exports(jclse
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getLastCollectionEndTimeImpl
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getLastCollectionStartTimeImpl
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getMemoryUsedImpl
+	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getOldestPendingFinalizationAgeImpl
+	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getPendingFinalizationCountImpl
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getTotalCompactsImpl
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getTotalMemoryFreedImpl
 	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_createMemoryManagers
@@ -1498,6 +1498,18 @@ typedef struct J9MonitorTableListEntry {
 	struct J9MonitorTableListEntry* next;
 } J9MonitorTableListEntry;
 
+/* Lock and statistics for one of the J9JavaVM->monitorTables.
+ * The counters are only updated while holding the mutex.
+ * Padded so that the stripes used by different threads do not share a cache line.
+ */
+typedef struct J9MonitorTableStripe {
+	omrthread_monitor_t mutex;
+	UDATA hitCount; /* lookups which found the monitor in the table */
+	UDATA missCount; /* lookups which added a new monitor to the table */
+	UDATA contendedCount; /* lookups which had to block on the mutex */
+	U_8 padding[64 - (4 * sizeof(UDATA))];
+} J9MonitorTableStripe;
+
 typedef struct J9UnsafeMemoryBlock {
 	struct J9UnsafeMemoryBlock* linkNext;
 	struct J9UnsafeMemoryBlock* linkPrevious;
@@ -4271,6 +4283,7 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA  ( *j9gc_ext_check_is_valid_heap_object)(struct J9JavaVM *javaVM, j9object_t ptr, UDATA flags) ;
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA  ( *j9gc_get_objects_pending_finalization_count)(struct J9JavaVM* vm) ;
+	U_64  ( *j9gc_get_oldest_pending_finalization_age)(struct J9JavaVM* vm) ;
 #endif /* J9VM_GC_FINALIZATION */
 	UDATA  ( *j9gc_set_softmx)(struct J9JavaVM *javaVM, UDATA newsoftmx) ;
 	UDATA  ( *j9gc_get_softmx)(struct J9JavaVM *javaVM) ;
@@ -4417,6 +4430,10 @@ typedef struct J9MemoryManagerFunctions {
 	I_32  ( *j9gc_get_jit_string_dedup_policy)(struct J9JavaVM *javaVM) ;
 	UDATA ( *j9gc_stringHashFn)(void *key, void *userData);
 	BOOLEAN ( *j9gc_stringHashEqualFn)(void *leftKey, void *rightKey, void *userData);
+#if defined(J9VM_OPT_CRIU_SUPPORT)
+	void ( *j9gc_reconfigure_for_restore)(struct J9VMThread *vmThread);
+	void ( *j9gc_clear_softmx)(struct J9JavaVM *javaVM);
+#endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 } J9MemoryManagerFunctions;
 
 typedef struct J9InternalVMFunctions {
@@ -4791,6 +4808,7 @@ typedef struct J9InternalVMFunctions {
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 	BOOLEAN (*jvmCheckpointHooks)(struct J9VMThread *currentThread);
 	BOOLEAN (*jvmRestoreHooks)(struct J9VMThread *currentThread);
+	void (*jvmCheckpointFailedHooks)(struct J9VMThread *currentThread);
 	BOOLEAN (*isCRIUSupportEnabled)(struct J9VMThread *currentThread);
 	BOOLEAN (*isCheckpointAllowed)(struct J9VMThread *currentThread);
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
@@ -5092,6 +5110,8 @@ typedef struct J9VMThread {
 typedef struct J9CRIUCheckpointState {
 	BOOLEAN isCheckPointAllowed;
 	BOOLEAN isNonPortableRestoreMode;
+	BOOLEAN isSoftMxLoweredForCheckpoint;
+	UDATA softMxBeforeCheckpoint;
 } J9CRIUCheckpointState;
 
 typedef struct J9ReflectFunctionTable {
@@ -5320,7 +5340,7 @@ typedef struct J9JavaVM {
 	J9SidecarExitFunction * sidecarExitFunctions;
 	struct J9HashTable** monitorTables;
 	UDATA monitorTableCount;
-	omrthread_monitor_t monitorTableMutex;
+	struct J9MonitorTableStripe* monitorTableStripes;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
 	UDATA thrStaggerStep;
@@ -354,6 +354,10 @@ extern J9_CFUNC jlong JNICALL
 Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getTotalCompactsImpl(JNIEnv *env, jobject beanInstance, jint id);
 extern J9_CFUNC jlong JNICALL
 Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getMemoryUsedImpl(JNIEnv *env, jobject beanInstance, jint id);
+extern J9_CFUNC jlong JNICALL
+Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getPendingFinalizationCountImpl(JNIEnv *env, jobject beanInstance);
+extern J9_CFUNC jlong JNICALL
+Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getOldestPendingFinalizationAgeImpl(JNIEnv *env, jobject beanInstance);
 extern J9_CFUNC jobject JNICALL
 Java_com_ibm_lang_management_internal_ExtendedGarbageCollectorMXBeanImpl_getLastGcInfoImpl(JNIEnv *env, jobject beanInstance, jint id);
 
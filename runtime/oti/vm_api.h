@@ -517,6 +517,16 @@ jvmCheckpointHooks(J9VMThread *currentThread);
 BOOLEAN
 jvmRestoreHooks(J9VMThread *currentThread);
 
+/**
+ * @brief JVM hooks to run when a checkpoint fails after jvmCheckpointHooks
+ * was called. Undoes the preparation for the checkpoint, since the process
+ * continues to run without being restored.
+ *
+ * @param currentThread vmthread token
+ */
+void
+jvmCheckpointFailedHooks(J9VMThread *currentThread);
+
 /* ---------------- classloadersearch.c ---------------- */
 
 /**
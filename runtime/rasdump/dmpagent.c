@@ -1855,7 +1855,7 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 					"        [+<name>...]     (see -Xdump:request)\n");
 
 				if (strcmp(spec->name, "heap") == 0) {
-					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC|HPROF[+PARALLEL[<threads>]][+GZIP]\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -2808,6 +2808,23 @@ runDumpAgent(struct J9JavaVM *vm, J9RASdumpAgent * agent, J9RASdumpContext * con
 				if (agent->dumpFn == doHeapDump) {
 					if (agent->dumpOptions && strstr(agent->dumpOptions, "PHD")) {
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), label);
+						/* compressed heap dumps get a .gz suffix, see BinaryHeapDumpWriter */
+						if (strstr(agent->dumpOptions, "GZIP") && !(reqLen >= 3 && strcmp(&label[reqLen - 3], ".gz") == 0)) {
+							writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), ".gz");
+						}
+						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), "\t");
+					}
+
+					if (agent->dumpOptions && strstr(agent->dumpOptions, "HPROF")) {
+						/* do label hackery for HPROF, see HprofHeapDumpWriter */
+						if (reqLen >= 4 && strcmp(&label[reqLen - 4], ".phd") == 0) {
+							label[reqLen - 4] = '\0';
+							writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), label);
+							writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), ".hprof");
+							label[reqLen - 4] = '.';
+						} else {
+							writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), label);
+						}
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), "\t");
 					}
 
@@ -26,6 +26,9 @@
 #include "j2sever.h"
 #include "HeapIteratorAPI.h"
 #include "j9dmpnls.h"
+#include "j9modron.h"
+#include "omrthread.h"
+#include "zlib.h"
 #include "FileStream.hpp"
 
 #include "ut_j9dmp.h"
@@ -43,6 +46,18 @@ static jvmtiIterationControl binaryHeapDumpObjectIteratorCallback (J9JavaVM* vm,
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 
+static jvmtiIterationControl parallelHeapDumpRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+static jvmtiIterationControl parallelHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+static int J9THREAD_PROC parallelHeapDumpThreadProc(void* entryArg);
+
+static jvmtiIterationControl hprofHeapDumpHeapIteratorCallback  (J9JavaVM* vm, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
+static jvmtiIterationControl hprofHeapDumpSpaceIteratorCallback (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
+static jvmtiIterationControl hprofHeapDumpRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+static jvmtiIterationControl hprofHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+static jvmtiIterationControl hprofHeapDumpRootIteratorCallback  (void* root, J9MM_HeapRootSlotDescriptor* rootDescriptor, void* userData);
+static UDATA hprofFieldLayoutHashFunction     (void* entry, void* userData);
+static UDATA hprofFieldLayoutHashEqualFunction(void* left, void* right, void* userData);
+
 #define allClassesStartDo(vm, state, loader) \
 	vm->internalVMFunctions->allClassesStartDo(state, vm, loader)
 
@@ -725,6 +740,339 @@ public:
 	}
 };
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* Function for building the name of a class as written in heap dumps                             */
+/*                                                                                                */
+/**************************************************************************************************/
+static void
+appendClassName(CharacterString& className, J9Class* clazz)
+{
+	/* Handle array and normal classes separately */
+	if (J9ROMCLASS_IS_ARRAY(clazz->romClass)) {
+		/* Cast the class pointer to be an array class pointer                */
+		/* NB : This only works because of the similarity of these structures */
+		J9ArrayClass* arrayClass = (J9ArrayClass*)clazz;
+
+		/* Add a [ to the class name for each depth of the array */
+		for (UDATA i = 1; i < arrayClass->arity; i++) {
+			className += '[';
+		}
+
+		/* Extract a pointer to the array element class */
+		J9Class* leafClass = arrayClass->leafComponentType;
+
+		/* Complete the class name */
+		J9UTF8* className1 =  J9ROMCLASS_CLASSNAME(leafClass->arrayClass->romClass);
+		className.append((char*)J9UTF8_DATA(className1), J9UTF8_LENGTH(className1));
+
+		if (!J9ROMCLASS_IS_PRIMITIVE_TYPE(leafClass->romClass)) {
+			J9UTF8* className2 = J9ROMCLASS_CLASSNAME(leafClass->romClass);
+			className.append((char*)J9UTF8_DATA(className2), J9UTF8_LENGTH(className2));
+			className += ';';
+		}
+
+	} else {
+		J9UTF8* className1 = J9ROMCLASS_CLASSNAME(clazz->romClass);
+		className.append((char*)J9UTF8_DATA(className1), J9UTF8_LENGTH(className1));
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* Class for accumulating heap dump records in memory, optionally compressed                      */
+/*                                                                                                */
+/*   When compressing, the data forms a gzip member. Members may be concatenated in a file and    */
+/*   are read back as a single stream, which lets each thread of a parallel heap dump compress    */
+/*   its own records.                                                                             */
+/*                                                                                                */
+/**************************************************************************************************/
+class HeapDumpBuffer
+{
+public :
+	/* Constructor */
+	HeapDumpBuffer(J9PortLibrary* portLibrary, bool compress);
+
+	/* Destructor */
+	~HeapDumpBuffer();
+
+	/* Methods for writing data to the buffer */
+	void writeCharacters (const char* data, IDATA length);
+	void writeNumber     (IDATA data, int length);
+
+	/* Method for completing the gzip member; no data may be written until reset() */
+	void finish(void);
+
+	/* Method for discarding the data and starting a new gzip member */
+	void reset(void);
+
+	/* Method for discarding the data once it has been written elsewhere */
+	void drain(void);
+
+	/* Methods for getting the object's attributes */
+	const char* data  (void) const;
+	UDATA       length(void) const;
+	bool        hasError(void) const;
+
+private :
+	/* Prevent use of the copy constructor and assignment operator */
+	HeapDumpBuffer(const HeapDumpBuffer& source);
+	HeapDumpBuffer& operator=(const HeapDumpBuffer& source);
+
+	void append(const char* data, UDATA length);
+	void compressInput(int flush);
+
+	/* Declared data */
+	J9PortLibrary* _PortLibrary;
+	bool           _Compress;
+	bool           _StreamInitialized;
+	bool           _Error;
+	char*          _Data;
+	UDATA          _Length;
+	UDATA          _Capacity;
+	char*          _Input;
+	UDATA          _InputLength;
+	z_stream       _Stream;
+
+	/* Static methods returning constant values */
+	inline static UDATA inputSize(void)       {return 64 * 1024;}
+	inline static UDATA granularity(void)     {return 256 * 1024;}
+	/* gzip wrapper around the deflate data */
+	inline static int   windowBits(void)      {return 15 + 16;}
+};
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::HeapDumpBuffer() method implementation                                         */
+/*                                                                                                */
+/**************************************************************************************************/
+HeapDumpBuffer::HeapDumpBuffer(J9PortLibrary* portLibrary, bool compress) :
+	_PortLibrary(portLibrary),
+	_Compress(compress),
+	_StreamInitialized(false),
+	_Error(false),
+	_Data(NULL),
+	_Length(0),
+	_Capacity(0),
+	_Input(NULL),
+	_InputLength(0)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_Compress) {
+		_Input = (char*)j9mem_allocate_memory(inputSize(), OMRMEM_CATEGORY_VM);
+		if (NULL == _Input) {
+			_Error = true;
+			return;
+		}
+
+		memset(&_Stream, 0, sizeof(_Stream));
+		/* Favour speed: the dump is taken while the application is paused */
+		if (Z_OK != deflateInit2(&_Stream, Z_BEST_SPEED, Z_DEFLATED, windowBits(), 8, Z_DEFAULT_STRATEGY)) {
+			_Error = true;
+			return;
+		}
+		_StreamInitialized = true;
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::~HeapDumpBuffer() method implementation                                        */
+/*                                                                                                */
+/**************************************************************************************************/
+HeapDumpBuffer::~HeapDumpBuffer()
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_StreamInitialized) {
+		deflateEnd(&_Stream);
+	}
+	j9mem_free_memory(_Input);
+	j9mem_free_memory(_Data);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::writeCharacters() method implementation                                        */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HeapDumpBuffer::writeCharacters(const char* data, IDATA length)
+{
+	if (_Error) {
+		return;
+	}
+
+	if (!_Compress) {
+		append(data, length);
+		return;
+	}
+
+	/* Stage the data so that deflate() is called for large blocks rather than for each number */
+	while (length > 0) {
+		UDATA count = inputSize() - _InputLength;
+		if ((UDATA)length < count) {
+			count = length;
+		}
+		memcpy(_Input + _InputLength, data, count);
+		_InputLength += count;
+		data         += count;
+		length       -= count;
+
+		if (_InputLength == inputSize()) {
+			compressInput(Z_NO_FLUSH);
+			if (_Error) {
+				return;
+			}
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::writeNumber() method implementation                                            */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HeapDumpBuffer::writeNumber(IDATA data, int length)
+{
+	/* Same network order encoding as FileStream::writeNumber() */
+	IDATA number = data;
+	int   count  = (length > 8) ? 8 : length;
+	char  buffer[8] = {0,0,0,0,0,0,0,0};
+
+	while (count-- > 0) {
+		buffer[count] = (char)(number & 0xFF);
+		number >>= 8;
+	}
+
+	writeCharacters(buffer, length);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::finish() method implementation                                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HeapDumpBuffer::finish(void)
+{
+	if (_Compress && !_Error) {
+		compressInput(Z_FINISH);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::reset() method implementation                                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HeapDumpBuffer::reset(void)
+{
+	_Length      = 0;
+	_InputLength = 0;
+
+	if (_StreamInitialized && (Z_OK != deflateReset(&_Stream))) {
+		_Error = true;
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::drain() method implementation                                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HeapDumpBuffer::drain(void)
+{
+	_Length = 0;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer attribute methods implementation                                                */
+/*                                                                                                */
+/**************************************************************************************************/
+const char*
+HeapDumpBuffer::data(void) const
+{
+	return _Data;
+}
+
+UDATA
+HeapDumpBuffer::length(void) const
+{
+	return _Length;
+}
+
+bool
+HeapDumpBuffer::hasError(void) const
+{
+	return _Error;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::append() method implementation                                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HeapDumpBuffer::append(const char* data, UDATA length)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_Length + length > _Capacity) {
+		UDATA newCapacity = ((_Length + length + granularity()) / granularity()) * granularity();
+		char* newData     = (char*)j9mem_reallocate_memory(_Data, newCapacity, OMRMEM_CATEGORY_VM);
+
+		if (NULL == newData) {
+			_Error = true;
+			return;
+		}
+		_Data     = newData;
+		_Capacity = newCapacity;
+	}
+
+	memcpy(_Data + _Length, data, length);
+	_Length += length;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HeapDumpBuffer::compressInput() method implementation                                          */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HeapDumpBuffer::compressInput(int flush)
+{
+	char output[16 * 1024];
+	int  rc = Z_OK;
+
+	_Stream.next_in  = (Bytef*)_Input;
+	_Stream.avail_in = (uInt)_InputLength;
+
+	/* Run deflate() until it has consumed all the input and, when finishing, written the trailer */
+	do {
+		_Stream.next_out  = (Bytef*)output;
+		_Stream.avail_out = sizeof(output);
+
+		rc = deflate(&_Stream, flush);
+		if (Z_STREAM_ERROR == rc) {
+			_Error = true;
+			return;
+		}
+
+		append(output, sizeof(output) - _Stream.avail_out);
+		if (_Error) {
+			return;
+		}
+	} while ((0 == _Stream.avail_out) || ((Z_FINISH == flush) && (Z_STREAM_END != rc)));
+
+	_InputLength = 0;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* Class for writing binary portable heap dump files                                              */
@@ -756,6 +1104,9 @@ private :
 	friend jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpHeapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl parallelHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl parallelHeapDumpObjectIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData);
+	friend int J9THREAD_PROC parallelHeapDumpThreadProc(void* entryArg);
 
 	/* Nested class for determining the characteristics of the references */
 	class ReferenceTraits
@@ -839,6 +1190,38 @@ private :
 		int         _Index;
 	};
 
+	/* Nested class holding the records of one region written by a thread of a parallel heap dump.  */
+	/* The records of a region are written to the file once those of all the regions before it     */
+	/* have been written. The record of the first object is written at that point, as its address   */
+	/* delta is relative to the last object of the previous region.                                 */
+	class RegionRecords
+	{
+	public :
+		/* Constructor */
+		RegionRecords(J9PortLibrary* portLibrary, bool compress);
+
+		UDATA                        _Index;
+		bool                         _InUse;
+		bool                         _Started;
+		bool                         _Complete;
+		bool                         _HasFirstObject;
+		J9MM_IterateObjectDescriptor _FirstObject;
+		void*                        _LastObject;
+		HeapDumpBuffer               _Records;
+		/* Next records in region order */
+		RegionRecords*               _Next;
+		/* Next records owned by the same thread */
+		RegionRecords*               _NextSlot;
+
+	private :
+		/* Prevent use of the copy constructor and assignment operator */
+		RegionRecords(const RegionRecords& source);
+		RegionRecords& operator=(const RegionRecords& source);
+	};
+
+	/* Constructor for the writers used by the threads of a parallel heap dump */
+	BinaryHeapDumpWriter(BinaryHeapDumpWriter* mainWriter);
+
 	friend class ReferenceTraits;
 	friend class ReferenceWriter;
 
@@ -856,7 +1239,19 @@ private :
 	static int       numberSizeEncoding(int numberSize);
 	static int       wordSize(void);
 	void             checkForIOError(void);
-	/* Methods for writing data to output file (proxies to _OutputStream */
+	void             checkForBufferError(HeapDumpBuffer* buffer);
+	void             flushBuffer(void);
+	/* Methods for parallel heap dumps */
+	static UDATA     parallelThreadCount(J9JavaVM* virtualMachine, const char* dumpOptions);
+	void             writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor);
+	void             writeClaimedRegions(void);
+	void             writeClaimedRegion(J9MM_IterateRegionDescriptor* regionDescription);
+	RegionRecords*   claimRegion(RegionRecords* slots);
+	void             releaseRegions(RegionRecords* slots);
+	void             writeRegionRecords(RegionRecords* records, bool complete);
+	void             writeRegionRecordsToFile(RegionRecords* records);
+	void             setError(void);
+	/* Methods for writing data to output file (proxies to _OutputStream or _Buffer) */
 	void             writeCharacters (const char* data, IDATA length);
 	void             writeCharacters (const char* data);
 	void             writeNumber (IDATA data, int length);
@@ -873,6 +1268,23 @@ private :
 	ClassCache        _ClassCache;
 	bool              _FileMode;
 	bool              _Error;
+	/* State for compressed and parallel heap dumps */
+	bool              _Compress;
+	bool              _UseClassCache;
+	UDATA             _ThreadCount;
+	HeapDumpBuffer*   _Buffer;
+	HeapDumpBuffer    _CompressedOutput;
+	/* State of the threads of a parallel heap dump, owned by the main writer */
+	BinaryHeapDumpWriter*        _MainWriter;
+	omrthread_monitor_t          _Monitor;
+	J9MM_IterateSpaceDescriptor* _SpaceDescriptor;
+	UDATA                        _NextRegionToClaim;
+	UDATA                        _ActiveThreads;
+	RegionRecords*               _PendingRegions;
+	/* State of a thread of a parallel heap dump */
+	RegionRecords*    _Slots;
+	RegionRecords*    _RegionRecords;
+	UDATA             _RegionIndex;
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
@@ -907,6 +1319,11 @@ private :
 	inline static char        arrayObjectRecordField(void) {return 0x08;}
 	inline static char        classObjectRecordField(void) {return 0x06;}
 	inline static char        dumpEndField(void)           {return 0x03;}
+
+	/* Amount of data after which buffered records are written to the file */
+	inline static UDATA       bufferFlushThreshold(void)   {return 4 * 1024 * 1024;}
+	/* Amount of records a parallel heap dump thread may hold for a region before it waits for its turn to write them */
+	inline static UDATA       regionRecordsLimit(void)     {return 32 * 1024 * 1024;}
 };
 
 /**************************************************************************************************/
@@ -1107,6 +1524,25 @@ BinaryHeapDumpWriter::ClassCache::clear(void)
 	_Index = 0;
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::RegionRecords::RegionRecords() method implementation                     */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::RegionRecords::RegionRecords(J9PortLibrary* portLibrary, bool compress) :
+	_Index(0),
+	_InUse(false),
+	_Started(false),
+	_Complete(false),
+	_HasFirstObject(false),
+	_LastObject(NULL),
+	_Records(portLibrary, compress),
+	_Next(NULL),
+	_NextSlot(NULL)
+{
+	memset(&_FirstObject, 0, sizeof(_FirstObject));
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::BinaryHeapDumpWriter() method implementation                             */
@@ -1124,7 +1560,21 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
 	_FileMode(false),
-	_Error(false)
+	_Error(false),
+	_Compress(false),
+	_UseClassCache(true),
+	_ThreadCount(1),
+	_Buffer(NULL),
+	_CompressedOutput(context->javaVM->portLibrary, (agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "GZIP") != 0)),
+	_MainWriter(NULL),
+	_Monitor(NULL),
+	_SpaceDescriptor(NULL),
+	_NextRegionToClaim(0),
+	_ActiveThreads(0),
+	_PendingRegions(NULL),
+	_Slots(NULL),
+	_RegionRecords(NULL),
+	_RegionIndex(0)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 
@@ -1135,11 +1585,26 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	
 	/* Remember the file name */
 	_FileName += fileName;
-	
+
+	if ((agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "GZIP") != 0)) {
+		UDATA length = strlen(fileName);
+
+		/* The records are compressed in _CompressedOutput before being written to the file */
+		_Compress = true;
+		_Buffer   = &_CompressedOutput;
+		if ((length < 3) || (strcmp(fileName + length - 3, ".gz") != 0)) {
+			_FileName += ".gz";
+		}
+	}
+
+	/* Parallel heap dumps can't use the class cache, see writeRegionsInParallel() */
+	_ThreadCount   = parallelThreadCount(_VirtualMachine, agent->dumpOptions);
+	_UseClassCache = (1 == _ThreadCount);
+
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		reportDumpRequest(_PortLibrary,_Context,"Heap",_FileName.data());
 		
 		/* It's a single file so open it */
 		_OutputStream.open(_FileName.data());
@@ -1149,6 +1614,7 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		*/
 
 		/* Start writing the file */
+		checkForBufferError(_Buffer);
 		writeDumpFileHeader();
 	}
 
@@ -1161,6 +1627,11 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		if (! _Error) {
 			writeDumpFileTrailer();
 		}
+		if ((NULL != _Buffer) && !_Error) {
+			_Buffer->finish();
+			checkForBufferError(_Buffer);
+			flushBuffer();
+		}
 
 		/* Performance measuring code 
 		stopTimer();
@@ -1176,16 +1647,52 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
 		if (! _Error) {
 			if (_FileMode) {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			} else {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			}
 		}
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::BinaryHeapDumpWriter() method implementation for parallel heap dumps     */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::BinaryHeapDumpWriter(BinaryHeapDumpWriter* mainWriter) :
+	_Id(0),
+	_RegionStart(NULL),
+	_RegionEnd(NULL),
+	_Context(mainWriter->_Context),
+	_Agent(mainWriter->_Agent),
+	_VirtualMachine(mainWriter->_VirtualMachine),
+	_PortLibrary(mainWriter->_PortLibrary),
+	_FileName(mainWriter->_PortLibrary),
+	_OutputStream(mainWriter->_PortLibrary),
+	_CurrentObject(0),
+	_FileMode(false),
+	_Error(false),
+	_Compress(mainWriter->_Compress),
+	_UseClassCache(false),
+	_ThreadCount(1),
+	_Buffer(NULL),
+	_CompressedOutput(mainWriter->_PortLibrary, false),
+	_MainWriter(mainWriter),
+	_Monitor(NULL),
+	_SpaceDescriptor(NULL),
+	_NextRegionToClaim(0),
+	_ActiveThreads(0),
+	_PendingRegions(NULL),
+	_Slots(NULL),
+	_RegionRecords(NULL),
+	_RegionIndex(0)
+{
+	/* Nothing to do - the records are written to the file by the main writer, see writeClaimedRegions() */
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::~BinaryHeapDumpWriter() method implementation                            */
@@ -1225,6 +1732,10 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		/* Initialize the data members */
 		_CurrentObject = 0;
 		_ClassCache.clear();
+		if (NULL != _Buffer) {
+			_Buffer->reset();
+			checkForBufferError(_Buffer);
+		}
 
 		/* Open the file */
 		_OutputStream.open(fileName.data());
@@ -1234,13 +1745,19 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 	}
 
 	/* Iterate through the regions etc. */
-	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
-			_VirtualMachine,
-			_PortLibrary,
-			spaceDescriptor,
-			j9mm_iterator_flag_regions_read_only,
-			binaryHeapDumpRegionIteratorCallback,
-			this);
+	if (_Error) {
+		/* Nothing more can be written */
+	} else if (_ThreadCount > 1) {
+		writeRegionsInParallel(spaceDescriptor);
+	} else {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+				_VirtualMachine,
+				_PortLibrary,
+				spaceDescriptor,
+				j9mm_iterator_flag_regions_read_only,
+				binaryHeapDumpRegionIteratorCallback,
+				this);
+	}
 
 	/* Handle the single and multiple dump file cases separately */
 	if (_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
@@ -1248,6 +1765,11 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		if (! _Error) {
 			writeDumpFileTrailer();
 		}
+		if ((NULL != _Buffer) && !_Error) {
+			_Buffer->finish();
+			checkForBufferError(_Buffer);
+			flushBuffer();
+		}
 
 		/* Record the status of the operation */
 		_FileMode = _FileMode || _OutputStream.isOpen();
@@ -1403,6 +1925,11 @@ BinaryHeapDumpWriter::writeObjectRecord(J9MM_IterateObjectDescriptor* objectDesc
 	/* Handle class, array and normal objects separately */
 	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, currentObject)) {
 		/* Do nothing - heap classes are handled in a separate walk */
+	} else if ((NULL != _RegionRecords) && !_RegionRecords->_HasFirstObject) {
+		/* The first object of a region of a parallel heap dump is written by writeRegionRecordsToFile() */
+		_RegionRecords->_FirstObject    = *objectDescriptor;
+		_RegionRecords->_HasFirstObject = true;
+		_CurrentObject = currentObject;
 	} else if (J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
 		writeArrayObjectRecord(objectDescriptor);
 	} else {
@@ -1448,7 +1975,7 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 	void* objectClassAddress = J9VM_J9CLASS_TO_HEAPCLASS(objectClass);
 
 	/* Determine whether this class is cached */
-	int classCacheIndex = _ClassCache.find(objectClassAddress);
+	int classCacheIndex = _UseClassCache ? _ClassCache.find(objectClassAddress) : -1;
 
 	int hashCode = getObjectHashCode(currentObject);
 
@@ -2082,37 +2609,9 @@ BinaryHeapDumpWriter::writeClassRecord(J9Class *currentClass)
 
 	/* Calculate the class name */
 	CharacterString className(_PortLibrary);
+	appendClassName(className, currentClass);
 
-	/* Handle array and normal classes separately */
-	if (J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
-		/* Cast the class pointer to be an array class pointer                */
-		/* NB : This only works because of the similarity of these structures */
-		J9ArrayClass* arrayClass = (J9ArrayClass*)currentClass;
-
-		/* Add a [ to the class name for each depth of the array */
-		for (UDATA i = 1; i < arrayClass->arity; i++) {
-			className += '[';
-		}
-
-		/* Extract a pointer to the array element class */
-		J9Class* leafClass = arrayClass->leafComponentType;
-
-		/* Complete the class name */
-		J9UTF8* className1 =  J9ROMCLASS_CLASSNAME(leafClass->arrayClass->romClass);
-		className.append((char*)J9UTF8_DATA(className1), J9UTF8_LENGTH(className1));
-
-		if (!J9ROMCLASS_IS_PRIMITIVE_TYPE(leafClass->romClass)) {
-			J9UTF8* className2 = J9ROMCLASS_CLASSNAME(leafClass->romClass);
-			className.append((char*)J9UTF8_DATA(className2), J9UTF8_LENGTH(className2));
-			className += ';';
-		}
-
-	} else {
-		J9UTF8* className1 = J9ROMCLASS_CLASSNAME(currentClass->romClass);
-		className.append((char*)J9UTF8_DATA(className1), J9UTF8_LENGTH(className1));
-	}
-
-	int hashCode = getObjectHashCode(currentObject);
+	int hashCode = getObjectHashCode(currentObject);
 
 	/* Write the class record start tag */
 	writeNumber(classObjectRecordField(), 1);
@@ -2392,33 +2891,403 @@ BinaryHeapDumpWriter::checkForIOError(void)
 }
 
 void
-BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
+BinaryHeapDumpWriter::checkForBufferError(HeapDumpBuffer* buffer)
 {
-	if (!_Error) {
-		_OutputStream.writeCharacters(data,length);
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	if ((NULL != buffer) && buffer->hasError()) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", "unable to buffer or compress the heap dump data");
+		Trc_dump_reportDumpError_Event2("Heap", "unable to buffer or compress the heap dump data");
+		_Error = true;
+	}
+}
+
+void
+BinaryHeapDumpWriter::flushBuffer(void)
+{
+	if (!_Error && (NULL != _Buffer) && (0 != _Buffer->length())) {
+		_OutputStream.writeCharacters(_Buffer->data(), _Buffer->length());
+		_Buffer->drain();
 
 		checkForIOError();
 	}
 }
 
 void
-BinaryHeapDumpWriter::writeCharacters (const char* data)
+BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 {
 	if (!_Error) {
-		_OutputStream.writeCharacters(data);
+		if (NULL != _Buffer) {
+			_Buffer->writeCharacters(data, length);
 
-		checkForIOError();
+			checkForBufferError(_Buffer);
+			/* Only the main writer owns the file, see writeRegionRecords() for the other writers */
+			if ((NULL == _MainWriter) && (_Buffer->length() >= bufferFlushThreshold())) {
+				flushBuffer();
+			}
+		} else {
+			_OutputStream.writeCharacters(data,length);
+
+			checkForIOError();
+		}
 	}
 }
 
+void
+BinaryHeapDumpWriter::writeCharacters (const char* data)
+{
+	writeCharacters(data, strlen(data));
+}
+
 void
 BinaryHeapDumpWriter::writeNumber (IDATA data, int length)
 {
 	if (!_Error) {
-		_OutputStream.writeNumber(data, length);
+		if (NULL != _Buffer) {
+			_Buffer->writeNumber(data, length);
+
+			checkForBufferError(_Buffer);
+			if ((NULL == _MainWriter) && (_Buffer->length() >= bufferFlushThreshold())) {
+				flushBuffer();
+			}
+		} else {
+			_OutputStream.writeNumber(data, length);
+
+			checkForIOError();
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::parallelThreadCount() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+UDATA
+BinaryHeapDumpWriter::parallelThreadCount(J9JavaVM* virtualMachine, const char* dumpOptions)
+{
+	PORT_ACCESS_FROM_JAVAVM(virtualMachine);
+	const char* parallel = (dumpOptions != 0) ? strstr(dumpOptions, "PARALLEL") : NULL;
+	UDATA threadCount = 0;
+
+	if (NULL == parallel) {
+		return 1;
+	}
+
+	/* PARALLEL may be followed by the number of threads */
+	for (parallel += strlen("PARALLEL"); (*parallel >= '0') && (*parallel <= '9'); parallel++) {
+		threadCount = (threadCount * 10) + (*parallel - '0');
+	}
+
+	if (0 == threadCount) {
+		/* Default to the number of threads the GC uses to walk the heap */
+		if (FALSE == virtualMachine->memoryManagerFunctions->j9gc_modron_getConfigurationValueForKey(virtualMachine, j9gc_modron_configuration_gcThreadCount, &threadCount)) {
+			threadCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET);
+		}
+	}
+
+	return (0 == threadCount) ? 1 : threadCount;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRegionsInParallel() method implementation                           */
+/*                                                                                                */
+/*   Each thread walks the regions of the space and writes the objects of the regions it claims   */
+/*   to its own records. The regions are claimed in order and the records are appended to the     */
+/*   file in the same order, so the file is the same as the one written by a single thread except */
+/*   that short object records aren't used: the class cache they rely on would depend on the      */
+/*   objects of the previous regions.                                                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor)
+{
+	UDATA threadCount = 1;
+
+	if (0 != omrthread_monitor_init_with_name(&_Monitor, 0, "Heap dump writer")) {
+		/* Fall back to writing the regions on this thread */
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+				_VirtualMachine,
+				_PortLibrary,
+				spaceDescriptor,
+				j9mm_iterator_flag_regions_read_only,
+				binaryHeapDumpRegionIteratorCallback,
+				this);
+		return;
+	}
+
+	/* Initialize the shared state */
+	_SpaceDescriptor   = spaceDescriptor;
+	_NextRegionToClaim = 0;
+	_PendingRegions    = NULL;
+	_ActiveThreads     = _ThreadCount;
+
+	Trc_dump_parallelHeapdump_Event1(_ThreadCount, _Compress ? "on" : "off");
+
+	/* Start the other threads, this thread does its share of the work too */
+	for (UDATA i = 1; i < _ThreadCount; i++) {
+		omrthread_t thread = NULL;
+
+		if (0 == omrthread_create(&thread, _VirtualMachine->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, parallelHeapDumpThreadProc, this)) {
+			threadCount += 1;
+		} else {
+			omrthread_monitor_enter(_Monitor);
+			_ActiveThreads -= 1;
+			omrthread_monitor_exit(_Monitor);
+		}
+	}
+
+	BinaryHeapDumpWriter worker(this);
+	worker.writeClaimedRegions();
+
+	/* Wait for the other threads to finish */
+	omrthread_monitor_enter(_Monitor);
+	_ActiveThreads -= 1;
+	while (0 != _ActiveThreads) {
+		omrthread_monitor_wait(_Monitor);
+	}
+	omrthread_monitor_exit(_Monitor);
+
+	Trc_dump_parallelHeapdump_Event2(worker._RegionIndex, threadCount);
+
+	omrthread_monitor_destroy(_Monitor);
+	_Monitor         = NULL;
+	_SpaceDescriptor = NULL;
+	_PendingRegions  = NULL;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeClaimedRegions() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeClaimedRegions(void)
+{
+	/* One set of records is filled while the other waits for the previous regions to be written */
+	RegionRecords first(_PortLibrary, _Compress);
+	RegionRecords second(_PortLibrary, _Compress);
+
+	first._NextSlot = &second;
+	_Slots          = &first;
+	_RegionIndex    = 0;
+	_RegionRecords  = _MainWriter->claimRegion(_Slots);
+
+	if (NULL != _RegionRecords) {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+				_VirtualMachine,
+				_PortLibrary,
+				_MainWriter->_SpaceDescriptor,
+				j9mm_iterator_flag_regions_read_only,
+				parallelHeapDumpRegionIteratorCallback,
+				this);
+	}
+
+	if (_Error) {
+		_MainWriter->setError();
+	}
+
+	/* The last region claimed is past the end of the space so it has no records */
+	if (NULL != _RegionRecords) {
+		_MainWriter->writeRegionRecords(_RegionRecords, true);
+		_RegionRecords = NULL;
+	}
+
+	/* The records are on the stack so wait for them to be written */
+	_MainWriter->releaseRegions(_Slots);
+	_Slots = NULL;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeClaimedRegion() method implementation                               */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeClaimedRegion(J9MM_IterateRegionDescriptor* regionDescription)
+{
+	RegionRecords* records = _RegionRecords;
+
+	_Id            = regionDescription->id;
+	_RegionStart   = (char*)regionDescription->regionStart;
+	_RegionEnd     = (char*)((UDATA)regionDescription->regionStart + regionDescription->regionSize);
+	_Buffer        = &records->_Records;
+	_CurrentObject = 0;
+
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_region_objects(_VirtualMachine, _PortLibrary, regionDescription, 0, parallelHeapDumpObjectIteratorCallback, this);
+
+	_Buffer = NULL;
+	records->_LastObject = _CurrentObject;
+	records->_Records.finish();
+	checkForBufferError(&records->_Records);
+	if (_Error) {
+		return;
+	}
+
+	/* Hand the records over and claim the next region */
+	_MainWriter->writeRegionRecords(records, true);
+	_RegionRecords = _MainWriter->claimRegion(_Slots);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::claimRegion() method implementation                                      */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::RegionRecords*
+BinaryHeapDumpWriter::claimRegion(RegionRecords* slots)
+{
+	RegionRecords* records = NULL;
+
+	omrthread_monitor_enter(_Monitor);
+
+	/* Wait for one of the thread's records to be free */
+	while (!_Error) {
+		for (records = slots; (NULL != records) && records->_InUse; records = records->_NextSlot) {
+			/* Keep looking */
+		}
+		if (NULL != records) {
+			break;
+		}
+		omrthread_monitor_wait(_Monitor);
+	}
+
+	if (NULL != records) {
+		records->_Index          = _NextRegionToClaim++;
+		records->_InUse          = true;
+		records->_Started        = false;
+		records->_Complete       = false;
+		records->_HasFirstObject = false;
+		records->_LastObject     = NULL;
+		records->_Next           = NULL;
+		records->_Records.reset();
+
+		/* Queue the records in region order */
+		RegionRecords** tail = &_PendingRegions;
+		while (NULL != *tail) {
+			tail = &(*tail)->_Next;
+		}
+		*tail = records;
+	}
+
+	omrthread_monitor_exit(_Monitor);
+
+	return records;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::releaseRegions() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::releaseRegions(RegionRecords* slots)
+{
+	omrthread_monitor_enter(_Monitor);
+
+	for (RegionRecords* records = slots; NULL != records; records = records->_NextSlot) {
+		while (!_Error && records->_InUse) {
+			omrthread_monitor_wait(_Monitor);
+		}
+	}
+
+	omrthread_monitor_exit(_Monitor);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRegionRecords() method implementation                               */
+/*                                                                                                */
+/*   Writes the records at the head of the queue that are complete. Incomplete records are only   */
+/*   written by the thread filling them, once all the previous regions have been written.         */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeRegionRecords(RegionRecords* records, bool complete)
+{
+	omrthread_monitor_enter(_Monitor);
+
+	records->_Complete = complete;
+	if (!complete) {
+		while (!_Error && (_PendingRegions != records)) {
+			omrthread_monitor_wait(_Monitor);
+		}
+	}
+
+	while (!_Error && (NULL != _PendingRegions)) {
+		RegionRecords* head = _PendingRegions;
+
+		if (!head->_Complete && (head != records)) {
+			break;
+		}
+
+		writeRegionRecordsToFile(head);
+		if (!head->_Complete) {
+			break;
+		}
+
+		/* The next region's address deltas follow on from the last object of this one */
+		if (head->_HasFirstObject) {
+			_CurrentObject = head->_LastObject;
+		}
+		_PendingRegions = head->_Next;
+		head->_InUse    = false;
+	}
+
+	omrthread_monitor_notify_all(_Monitor);
+	omrthread_monitor_exit(_Monitor);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRegionRecordsToFile() method implementation                         */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeRegionRecordsToFile(RegionRecords* records)
+{
+	/* A region without objects has no records */
+	if (!records->_HasFirstObject) {
+		records->_Records.drain();
+		return;
+	}
+
+	if (!records->_Started) {
+		records->_Started = true;
+
+		/* The first object's address delta is relative to the last object of the previous region */
+		writeObjectRecord(&records->_FirstObject);
+
+		/* Complete the current gzip member, the region's records are a member of their own */
+		if ((NULL != _Buffer) && !_Error) {
+			_Buffer->finish();
+			checkForBufferError(_Buffer);
+			flushBuffer();
+			_Buffer->reset();
+			checkForBufferError(_Buffer);
+		}
+	}
+
+	if (!_Error && (0 != records->_Records.length())) {
+		_OutputStream.writeCharacters(records->_Records.data(), records->_Records.length());
 
 		checkForIOError();
 	}
+	records->_Records.drain();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::setError() method implementation                                         */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::setError(void)
+{
+	omrthread_monitor_enter(_Monitor);
+	_Error = true;
+	omrthread_monitor_notify_all(_Monitor);
+	omrthread_monitor_exit(_Monitor);
 }
 
 /**************************************************************************************************/
@@ -2477,30 +3346,1030 @@ binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9
 	return referenceWriter->_HeapDumpWriter->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
-void
-writePHD(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
+static jvmtiIterationControl
+parallelHeapDumpRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData)
 {
-	BinaryHeapDumpWriter(label, context, agent);
+	BinaryHeapDumpWriter* heapDumpWriter = (BinaryHeapDumpWriter*)userData;
+
+	/* Only write the region if this thread has claimed it */
+	if ((NULL != heapDumpWriter->_RegionRecords) && (heapDumpWriter->_RegionIndex == heapDumpWriter->_RegionRecords->_Index)) {
+		heapDumpWriter->writeClaimedRegion(regionDescription);
+	}
+	heapDumpWriter->_RegionIndex += 1;
+	return (heapDumpWriter->_Error || heapDumpWriter->_MainWriter->_Error) ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
-/* Primary entry point */
-extern "C" void
-runHeapdump(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
+static jvmtiIterationControl
+parallelHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData)
 {
-	PORT_ACCESS_FROM_JAVAVM(context->javaVM);
+	BinaryHeapDumpWriter* heapDumpWriter = (BinaryHeapDumpWriter*)userData;
 
-	if (agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
-		if (strstr(label, "%id") == NULL) {
-			/* multiple heaps requested but the %id insertion point has been removed */
-			j9nls_printf(PORTLIB, J9NLS_WARNING | J9NLS_STDERR, J9NLS_DMP_MULTIPLE_DUMP_OVERWRITE);
-		}
+	heapDumpWriter->writeObjectRecord(objectDescriptor);
+
+	/* Bound the memory used for a big region by writing its records once the previous regions have been written */
+	if (!heapDumpWriter->_Error && (heapDumpWriter->_Buffer->length() >= BinaryHeapDumpWriter::regionRecordsLimit())) {
+		heapDumpWriter->_MainWriter->writeRegionRecords(heapDumpWriter->_RegionRecords, false);
 	}
+	return (heapDumpWriter->_Error || heapDumpWriter->_MainWriter->_Error) ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
 
-	if (agent->dumpOptions && strstr(agent->dumpOptions, "CLASSIC")) {
-		writeClassicHeapdump(label, context, agent);
+static int J9THREAD_PROC
+parallelHeapDumpThreadProc(void* entryArg)
+{
+	BinaryHeapDumpWriter* mainWriter = (BinaryHeapDumpWriter*)entryArg;
+
+	{
+		BinaryHeapDumpWriter worker(mainWriter);
+		worker.writeClaimedRegions();
 	}
 
-	if (agent->dumpOptions && strstr(agent->dumpOptions, "PHD")) {
-		writePHD(label, context, agent);
+	omrthread_monitor_enter(mainWriter->_Monitor);
+	mainWriter->_ActiveThreads -= 1;
+	omrthread_monitor_notify_all(mainWriter->_Monitor);
+	omrthread_monitor_exit(mainWriter->_Monitor);
+
+	return 0;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* Class for writing HPROF heap dump files                                                        */
+/*                                                                                                */
+/*   The file holds the class names, a single empty stack trace and a heap dump made of segments. */
+/*   Segments are collected in a bounded buffer and records too big for it are written straight  */
+/*   to the file in a segment of their own, so the memory used doesn't grow with the heap.        */
+/*   Roots are recorded without their type, as sticky classes or unknown roots.                   */
+/*                                                                                                */
+/**************************************************************************************************/
+class HprofHeapDumpWriter
+{
+public :
+	/* Constructor */
+	HprofHeapDumpWriter(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent);
+
+	/* Destructor */
+	~HprofHeapDumpWriter();
+
+private :
+	/* Prevent use of the copy constructor and assignment operator */
+	HprofHeapDumpWriter(const HprofHeapDumpWriter& source);
+	HprofHeapDumpWriter& operator=(const HprofHeapDumpWriter& source);
+
+	/* Allow the callback functions access */
+	friend jvmtiIterationControl hprofHeapDumpHeapIteratorCallback  (J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
+	friend jvmtiIterationControl hprofHeapDumpSpaceIteratorCallback (J9JavaVM* virtualMachine, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
+	friend jvmtiIterationControl hprofHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl hprofHeapDumpObjectIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+	friend jvmtiIterationControl hprofHeapDumpRootIteratorCallback  (void* root, J9MM_HeapRootSlotDescriptor* rootDescriptor, void* userData);
+	friend UDATA hprofFieldLayoutHashFunction     (void* entry, void* userData);
+	friend UDATA hprofFieldLayoutHashEqualFunction(void* left, void* right, void* userData);
+
+	/* Nested structures describing the instance fields of a class and its superclasses, in HPROF order */
+	struct FieldDescription
+	{
+		UDATA _Offset;
+		U_8   _Type;
+	};
+
+	struct FieldLayout
+	{
+		J9Class*          _Class;
+		UDATA             _FieldCount;
+		UDATA             _ValuesSize;
+		FieldDescription* _Fields;
+	};
+
+	/* Methods for writing the parts of the file */
+	void             writeFileHeader(void);
+	void             writeLoadClassRecords(void);
+	void             writeLoadClassRecord(J9Class* clazz, U_32 serialNumber);
+	void             writeStackTraceRecord(void);
+	void             writeHeapDump(void);
+	void             writeRootRecord(void* root, J9MM_HeapRootSlotDescriptor* rootDescriptor);
+	void             writeClassDumpRecord(J9Class* clazz);
+	void             writeObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
+	void             writeInstanceDumpRecord(j9object_t object, J9Class* clazz);
+	void             writeObjectArrayDumpRecord(j9object_t object, J9Class* clazz);
+	void             writePrimitiveArrayDumpRecord(j9object_t object, J9Class* clazz);
+	/* Methods for writing records */
+	void             writeRecordHeader(U_8 tag, UDATA length);
+	void             writeUTF8Record(UDATA id, const char* data, UDATA length);
+	void             beginSegmentRecord(UDATA length);
+	void             flushSegment(void);
+	/* Methods for describing classes */
+	bool             isDumpableClass(J9Class* clazz);
+	FieldLayout*     fieldLayout(J9Class* clazz);
+	static U_8       basicType(J9ROMFieldShape* field);
+	UDATA            basicTypeSize(U_8 type);
+	/* Methods for writing data (proxies to _OutputStream or _Segment) */
+	void             checkForIOError(void);
+	void             checkForBufferError(void);
+	void             writeCharacters(const char* data, IDATA length);
+	void             writeNumber(IDATA data, int length);
+	void             writeU64(U_64 data);
+	void             writeId(const void* id);
+
+	/* Declared data */
+	/* NB : The initialization order is not guaranteed on all C++ compilers */
+	J9RASdumpContext* _Context;
+	J9RASdumpAgent*   _Agent;
+	J9JavaVM*         _VirtualMachine;
+	J9PortLibrary*    _PortLibrary;
+	CharacterString   _FileName;
+	FileStream        _OutputStream;
+	HeapDumpBuffer    _Segment;
+	bool              _InSegment;
+	bool              _Error;
+	UDATA             _IdSize;
+	J9HashTable*      _FieldLayouts;
+
+	/* Static methods returning constant values */
+	inline static const char* identifierField(void)        {return "JAVA PROFILE 1.0.2";}
+	inline static U_8         utf8Tag(void)                {return 0x01;}
+	inline static U_8         loadClassTag(void)           {return 0x02;}
+	inline static U_8         stackTraceTag(void)          {return 0x05;}
+	inline static U_8         heapDumpSegmentTag(void)     {return 0x1C;}
+	inline static U_8         heapDumpEndTag(void)         {return 0x2C;}
+	inline static U_8         rootUnknownTag(void)         {return 0xFF;}
+	inline static U_8         rootStickyClassTag(void)     {return 0x05;}
+	inline static U_8         classDumpTag(void)           {return 0x20;}
+	inline static U_8         instanceDumpTag(void)        {return 0x21;}
+	inline static U_8         objectArrayDumpTag(void)     {return 0x22;}
+	inline static U_8         primitiveArrayDumpTag(void)  {return 0x23;}
+	inline static U_8         objectType(void)             {return 2;}
+	inline static U_8         booleanType(void)            {return 4;}
+	inline static U_8         charType(void)               {return 5;}
+	inline static U_8         floatType(void)              {return 6;}
+	inline static U_8         doubleType(void)             {return 7;}
+	inline static U_8         byteType(void)               {return 8;}
+	inline static U_8         shortType(void)              {return 9;}
+	inline static U_8         intType(void)                {return 10;}
+	inline static U_8         longType(void)               {return 11;}
+	/* The serial number of the empty stack trace every object refers to */
+	inline static U_32        stackTraceSerialNumber(void) {return 1;}
+	/* Size of the buffer collecting the records of a heap dump segment */
+	inline static UDATA       segmentSize(void)            {return 1024 * 1024;}
+	/* Size of a record header: tag, time and length */
+	inline static UDATA       recordHeaderSize(void)       {return 1 + 4 + 4;}
+};
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::HprofHeapDumpWriter() method implementation                               */
+/*                                                                                                */
+/**************************************************************************************************/
+HprofHeapDumpWriter::HprofHeapDumpWriter(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent) :
+	_Context(context),
+	_Agent(agent),
+	_VirtualMachine(context->javaVM),
+	_PortLibrary(context->javaVM->portLibrary),
+	_FileName(context->javaVM->portLibrary),
+	_OutputStream(context->javaVM->portLibrary),
+	_Segment(context->javaVM->portLibrary, false),
+	_InSegment(false),
+	_Error(false),
+	_IdSize(sizeof(UDATA)),
+	_FieldLayouts(NULL)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	UDATA length = strlen(fileName);
+
+	/* Re-label if necessary, as for classic heap dumps */
+	if ((length >= 4) && (strcmp(fileName + length - 4, ".phd") == 0)) {
+		_FileName.append(fileName, length - 4);
+		_FileName += ".hprof";
+	} else {
+		_FileName += fileName;
+	}
+
+	/* Write a message to standard error saying we are about to write a dump file */
+	reportDumpRequest(_PortLibrary, _Context, "Heap", _FileName.data());
+
+	_FieldLayouts = hashTableNew(
+		OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 0,
+		sizeof(FieldLayout), 0, 0,
+		OMRMEM_CATEGORY_VM,
+		hprofFieldLayoutHashFunction,
+		hprofFieldLayoutHashEqualFunction,
+		NULL, NULL
+	);
+	if (NULL == _FieldLayouts) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", "unable to allocate the HPROF class layouts");
+		Trc_dump_reportDumpError_Event2("Heap", "unable to allocate the HPROF class layouts");
+		return;
+	}
+
+	_OutputStream.open(_FileName.data());
+
+	writeFileHeader();
+	writeLoadClassRecords();
+	writeStackTraceRecord();
+	writeHeapDump();
+
+	/* Record the status of the operation */
+	bool fileMode = _OutputStream.isOpen();
+
+	_OutputStream.close();
+
+	/* If an error occurred, the error message has already been printed */
+	if (! _Error) {
+		if (fileMode) {
+			j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", _FileName.data());
+		} else {
+			j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName.data());
+		}
+		Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::~HprofHeapDumpWriter() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+HprofHeapDumpWriter::~HprofHeapDumpWriter()
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (NULL != _FieldLayouts) {
+		J9HashTableState hashState;
+		FieldLayout* layout = (FieldLayout*)hashTableStartDo(_FieldLayouts, &hashState);
+
+		while (NULL != layout) {
+			j9mem_free_memory(layout->_Fields);
+			layout = (FieldLayout*)hashTableNextDo(&hashState);
+		}
+		hashTableFree(_FieldLayouts);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeFileHeader() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeFileHeader(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	/* The identifier includes its terminating null */
+	writeCharacters(identifierField(), strlen(identifierField()) + 1);
+	writeNumber(_IdSize, 4);
+	writeU64((U_64)j9time_current_time_millis());
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeLoadClassRecords() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeLoadClassRecords(void)
+{
+	J9ClassWalkState state;
+	U_32 serialNumber = 1;
+
+	J9Class* clazz = allClassesStartDo(_VirtualMachine, &state, NULL);
+	while ((NULL != clazz) && !_Error) {
+		if (isDumpableClass(clazz)) {
+			writeLoadClassRecord(clazz, serialNumber);
+			serialNumber += 1;
+		}
+		clazz = allClassesNextDo(_VirtualMachine, &state);
+	}
+	allClassesEndDo(_VirtualMachine, &state);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeLoadClassRecord() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeLoadClassRecord(J9Class* clazz, U_32 serialNumber)
+{
+	J9ROMFieldOffsetWalkState state;
+	CharacterString className(_PortLibrary);
+
+	appendClassName(className, clazz);
+
+	/* The class name is identified by the RAM class and the field names by their ROM strings */
+	writeUTF8Record((UDATA)clazz, className.data(), className.length());
+
+	J9ROMFieldOffsetWalkResult* result = _VirtualMachine->internalVMFunctions->fieldOffsetsStartDo(
+			_VirtualMachine, clazz->romClass, NULL, &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_STATIC | J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE
+#if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
+			, clazz->flattenedClassCache
+#endif /* defined(J9VM_OPT_VALHALLA_VALUE_TYPES) */
+			);
+	while ((NULL != result->field) && !_Error) {
+		J9UTF8* fieldName = J9ROMFIELDSHAPE_NAME(result->field);
+
+		writeUTF8Record((UDATA)fieldName, (const char*)J9UTF8_DATA(fieldName), J9UTF8_LENGTH(fieldName));
+		result = _VirtualMachine->internalVMFunctions->fieldOffsetsNextDo(&state);
+	}
+
+	writeRecordHeader(loadClassTag(), 4 + _IdSize + 4 + _IdSize);
+	writeNumber(serialNumber, 4);
+	writeId(J9VM_J9CLASS_TO_HEAPCLASS(clazz));
+	writeNumber(stackTraceSerialNumber(), 4);
+	writeId(clazz);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeStackTraceRecord() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeStackTraceRecord(void)
+{
+	/* Allocation sites aren't known so every object refers to an empty trace */
+	writeRecordHeader(stackTraceTag(), 4 + 4 + 4);
+	writeNumber(stackTraceSerialNumber(), 4);
+	writeNumber(0, 4);
+	writeNumber(0, 4);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeHeapDump() method implementation                                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeHeapDump(void)
+{
+	J9ClassWalkState state;
+
+	/* Write the roots, weak roots are left out as they don't keep objects alive */
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_roots(
+		_VirtualMachine,
+		_PortLibrary,
+		SCAN_CLASSES | SCAN_VM_CLASS_SLOTS | SCAN_CLASS_LOADERS | SCAN_THREADS | SCAN_FINALIZABLE_OBJECTS | SCAN_JNI_GLOBAL | SCAN_MONITORS,
+		hprofHeapDumpRootIteratorCallback,
+		this);
+
+	/* Write the classes */
+	J9Class* clazz = allClassesStartDo(_VirtualMachine, &state, NULL);
+	while ((NULL != clazz) && !_Error) {
+		if (isDumpableClass(clazz)) {
+			writeClassDumpRecord(clazz);
+		}
+		clazz = allClassesNextDo(_VirtualMachine, &state);
+	}
+	allClassesEndDo(_VirtualMachine, &state);
+
+	/* Write the objects */
+	if (!_Error) {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_heaps(_VirtualMachine, _PortLibrary, 0, hprofHeapDumpHeapIteratorCallback, this);
+	}
+
+	flushSegment();
+
+	writeRecordHeader(heapDumpEndTag(), 0);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeRootRecord() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeRootRecord(void* root, J9MM_HeapRootSlotDescriptor* rootDescriptor)
+{
+	if (RootScannerEntityReachability_Strong != rootDescriptor->slotReachability) {
+		return;
+	}
+
+	beginSegmentRecord(1 + _IdSize);
+	if (HEAP_ROOT_SLOT_DESCRIPTOR_CLASS == rootDescriptor->scanType) {
+		writeNumber(rootStickyClassTag(), 1);
+		writeId(J9VM_J9CLASS_TO_HEAPCLASS((J9Class*)root));
+	} else {
+		writeNumber(rootUnknownTag(), 1);
+		writeId(root);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeClassDumpRecord() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeClassDumpRecord(J9Class* clazz)
+{
+	UDATA const objectHeaderSize = J9JAVAVM_OBJECT_HEADER_SIZE(_VirtualMachine);
+	J9InternalVMFunctions* vmFunctions = _VirtualMachine->internalVMFunctions;
+	J9ROMFieldOffsetWalkState state;
+	J9ROMFieldOffsetWalkResult* result = NULL;
+	UDATA staticCount = 0;
+	UDATA staticValuesSize = 0;
+	UDATA instanceFieldCount = 0;
+
+	/* Count the fields to calculate the length of the record */
+	result = vmFunctions->fieldOffsetsStartDo(_VirtualMachine, clazz->romClass, NULL, &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_STATIC | J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE
+#if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
+			, clazz->flattenedClassCache
+#endif /* defined(J9VM_OPT_VALHALLA_VALUE_TYPES) */
+			);
+	while (NULL != result->field) {
+		if (J9_ARE_ANY_BITS_SET(result->field->modifiers, J9AccStatic)) {
+			staticCount      += 1;
+			staticValuesSize += basicTypeSize(basicType(result->field));
+		} else {
+			instanceFieldCount += 1;
+		}
+		result = vmFunctions->fieldOffsetsNextDo(&state);
+	}
+
+	J9Class* superClass = (0 == J9CLASS_DEPTH(clazz)) ? NULL : clazz->superclasses[J9CLASS_DEPTH(clazz) - 1];
+	j9object_t classLoader = (NULL == clazz->classLoader) ? NULL : clazz->classLoader->classLoaderObject;
+
+	/* Calculate the instance size preventing sizes bigger than 32 bits breaking the dump */
+	UDATA instanceSize = (clazz->totalInstanceSize + objectHeaderSize) & 0xFFFFFFFF;
+
+	beginSegmentRecord(
+		1 + (7 * _IdSize) + 4 + 4 + 2
+		+ 2 + (staticCount * (_IdSize + 1)) + staticValuesSize
+		+ 2 + (instanceFieldCount * (_IdSize + 1)));
+
+	writeNumber(classDumpTag(), 1);
+	writeId(J9VM_J9CLASS_TO_HEAPCLASS(clazz));
+	writeNumber(stackTraceSerialNumber(), 4);
+	writeId((NULL == superClass) ? NULL : J9VM_J9CLASS_TO_HEAPCLASS(superClass));
+	writeId(classLoader);
+	/* Signers, protection domain and two reserved identifiers */
+	writeId(NULL);
+	writeId(NULL);
+	writeId(NULL);
+	writeId(NULL);
+	writeNumber(instanceSize, 4);
+	/* The constant pool isn't written */
+	writeNumber(0, 2);
+
+	/* Write the static fields and their values */
+	writeNumber(staticCount, 2);
+	result = vmFunctions->fieldOffsetsStartDo(_VirtualMachine, clazz->romClass, NULL, &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_STATIC
+#if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
+			, clazz->flattenedClassCache
+#endif /* defined(J9VM_OPT_VALHALLA_VALUE_TYPES) */
+			);
+	while ((NULL != result->field) && !_Error) {
+		U_8  type    = basicType(result->field);
+		U_8* address = (U_8*)clazz->ramStatics + result->offset;
+
+		writeId(J9ROMFIELDSHAPE_NAME(result->field));
+		writeNumber(type, 1);
+		if (objectType() == type) {
+			writeId(*(j9object_t*)address);
+		} else if (8 == basicTypeSize(type)) {
+			writeU64(*(U_64*)address);
+		} else {
+			writeNumber(*(U_32*)address, (int)basicTypeSize(type));
+		}
+		result = vmFunctions->fieldOffsetsNextDo(&state);
+	}
+
+	/* Write the instance fields declared by the class */
+	writeNumber(instanceFieldCount, 2);
+	result = vmFunctions->fieldOffsetsStartDo(_VirtualMachine, clazz->romClass, NULL, &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE
+#if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
+			, clazz->flattenedClassCache
+#endif /* defined(J9VM_OPT_VALHALLA_VALUE_TYPES) */
+			);
+	while ((NULL != result->field) && !_Error) {
+		writeId(J9ROMFIELDSHAPE_NAME(result->field));
+		writeNumber(basicType(result->field), 1);
+		result = vmFunctions->fieldOffsetsNextDo(&state);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeObjectRecord() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor)
+{
+	/* Extract pointers to the current object and its class */
+	j9object_t currentObject = objectDescriptor->object;
+	J9Class*   currentClass  = J9OBJECT_CLAZZ_VM(_VirtualMachine, currentObject);
+
+	/* Handle class, array and normal objects separately */
+	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, currentObject)) {
+		/* Do nothing - heap classes are written as class dump records */
+	} else if (!J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
+		writeInstanceDumpRecord(currentObject, currentClass);
+	} else if ((1 == ((J9ArrayClass*)currentClass)->arity) && J9ROMCLASS_IS_PRIMITIVE_TYPE(((J9ArrayClass*)currentClass)->leafComponentType->romClass)) {
+		writePrimitiveArrayDumpRecord(currentObject, currentClass);
+	} else {
+		writeObjectArrayDumpRecord(currentObject, currentClass);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeInstanceDumpRecord() method implementation                           */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeInstanceDumpRecord(j9object_t object, J9Class* clazz)
+{
+	FieldLayout* layout = fieldLayout(clazz);
+	if (NULL == layout) {
+		return;
+	}
+
+	beginSegmentRecord(1 + _IdSize + 4 + _IdSize + 4 + layout->_ValuesSize);
+	writeNumber(instanceDumpTag(), 1);
+	writeId(object);
+	writeNumber(stackTraceSerialNumber(), 4);
+	writeId(J9VM_J9CLASS_TO_HEAPCLASS(clazz));
+	writeNumber(layout->_ValuesSize, 4);
+
+	/* Write the field values, those of the class first followed by those of its superclasses */
+	for (UDATA i = 0; (i < layout->_FieldCount) && !_Error; i++) {
+		FieldDescription* field = &layout->_Fields[i];
+
+		if (objectType() == field->_Type) {
+			writeId(J9OBJECT_OBJECT_LOAD_VM(_VirtualMachine, object, field->_Offset));
+		} else if (8 == basicTypeSize(field->_Type)) {
+			writeU64(J9OBJECT_U64_LOAD_VM(_VirtualMachine, object, field->_Offset));
+		} else {
+			/* Fields narrower than an int are held in 32 bits */
+			writeNumber(J9OBJECT_U32_LOAD_VM(_VirtualMachine, object, field->_Offset), (int)basicTypeSize(field->_Type));
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeObjectArrayDumpRecord() method implementation                        */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeObjectArrayDumpRecord(j9object_t object, J9Class* clazz)
+{
+	UDATA headerSize = 1 + _IdSize + 4 + 4 + _IdSize;
+	U_32  length     = J9INDEXABLEOBJECT_SIZE_VM(_VirtualMachine, object);
+
+	/* Truncate arrays which don't fit in a record */
+	if (length > (U_32_MAX - headerSize) / _IdSize) {
+		length = (U_32)((U_32_MAX - headerSize) / _IdSize);
+	}
+
+	beginSegmentRecord(headerSize + (length * _IdSize));
+	writeNumber(objectArrayDumpTag(), 1);
+	writeId(object);
+	writeNumber(stackTraceSerialNumber(), 4);
+	writeNumber(length, 4);
+	writeId(J9VM_J9CLASS_TO_HEAPCLASS(clazz));
+
+	for (U_32 i = 0; (i < length) && !_Error; i++) {
+		writeId(J9JAVAARRAYOFOBJECT_LOAD_VM(_VirtualMachine, object, i));
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writePrimitiveArrayDumpRecord() method implementation                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writePrimitiveArrayDumpRecord(j9object_t object, J9Class* clazz)
+{
+	J9UTF8* leafName   = J9ROMCLASS_CLASSNAME(((J9ArrayClass*)clazz)->leafComponentType->romClass);
+	UDATA   headerSize = 1 + _IdSize + 4 + 4 + 1;
+	U_32    length     = J9INDEXABLEOBJECT_SIZE_VM(_VirtualMachine, object);
+	U_8     type       = booleanType();
+
+	switch (J9UTF8_DATA(leafName)[0]) {
+		case 'c': type = charType(); break;
+		case 'f': type = floatType(); break;
+		case 'd': type = doubleType(); break;
+		case 'b': if (J9UTF8_DATA(leafName)[1] == 'y') type = byteType(); break;
+		case 's': type = shortType(); break;
+		case 'i': type = intType(); break;
+		case 'l': type = longType(); break;
+		default : break;
+	}
+
+	UDATA elementSize = basicTypeSize(type);
+
+	/* Truncate arrays which don't fit in a record */
+	if (length > (U_32_MAX - headerSize) / elementSize) {
+		length = (U_32)((U_32_MAX - headerSize) / elementSize);
+	}
+
+	beginSegmentRecord(headerSize + (length * elementSize));
+	writeNumber(primitiveArrayDumpTag(), 1);
+	writeId(object);
+	writeNumber(stackTraceSerialNumber(), 4);
+	writeNumber(length, 4);
+	writeNumber(type, 1);
+
+	/* The elements are written in big endian order, as for all the numbers in the file */
+	switch (elementSize) {
+	case 1:
+		if (J9ISCONTIGUOUSARRAY_VM(_VirtualMachine, object)) {
+			writeCharacters((const char*)J9JAVAARRAYCONTIGUOUS_EA_VM(_VirtualMachine, object, 0, I_8), length);
+		} else {
+			for (U_32 i = 0; (i < length) && !_Error; i++) {
+				writeNumber(J9JAVAARRAYOFBYTE_LOAD_VM(_VirtualMachine, object, i), 1);
+			}
+		}
+		break;
+	case 2:
+		for (U_32 i = 0; (i < length) && !_Error; i++) {
+			writeNumber(J9JAVAARRAYOFCHAR_LOAD_VM(_VirtualMachine, object, i), 2);
+		}
+		break;
+	case 4:
+		for (U_32 i = 0; (i < length) && !_Error; i++) {
+			writeNumber(J9JAVAARRAYOFINT_LOAD_VM(_VirtualMachine, object, i), 4);
+		}
+		break;
+	default:
+		for (U_32 i = 0; (i < length) && !_Error; i++) {
+			writeU64(J9JAVAARRAYOFLONG_LOAD_VM(_VirtualMachine, object, i));
+		}
+		break;
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeRecordHeader() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeRecordHeader(U_8 tag, UDATA length)
+{
+	writeNumber(tag, 1);
+	/* Time offset from the file header */
+	writeNumber(0, 4);
+	writeNumber(length, 4);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::writeUTF8Record() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::writeUTF8Record(UDATA id, const char* data, UDATA length)
+{
+	writeRecordHeader(utf8Tag(), _IdSize + length);
+	writeId((void*)id);
+	writeCharacters(data, length);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::beginSegmentRecord() method implementation                                */
+/*                                                                                                */
+/*   Makes room in the segment buffer for a record of the given length. A record which doesn't    */
+/*   fit in the buffer is given a segment of its own and written straight to the file.            */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::beginSegmentRecord(UDATA length)
+{
+	if (_Segment.length() + length > segmentSize()) {
+		flushSegment();
+	}
+
+	if (length > segmentSize()) {
+		/* The segment is complete once the record has been written */
+		_InSegment = false;
+		writeRecordHeader(heapDumpSegmentTag(), length);
+	} else {
+		_InSegment = true;
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::flushSegment() method implementation                                      */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+HprofHeapDumpWriter::flushSegment(void)
+{
+	_InSegment = false;
+	if ((0 != _Segment.length()) && !_Error) {
+		writeRecordHeader(heapDumpSegmentTag(), _Segment.length());
+		writeCharacters(_Segment.data(), _Segment.length());
+	}
+	_Segment.drain();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::isDumpableClass() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+HprofHeapDumpWriter::isDumpableClass(J9Class* clazz)
+{
+	/* Skip the same classes as the binary heap dump */
+	if (J9_ARE_ANY_BITS_SET(J9CLASS_FLAGS(clazz), J9AccClassHotSwappedOut | J9AccClassDying)) {
+		return false;
+	}
+
+	return J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::fieldLayout() method implementation                                       */
+/*                                                                                                */
+/*   Returns the instance fields of a class and its superclasses. The layouts are kept for the    */
+/*   duration of the dump, so their size depends on the number of classes not of objects.        */
+/*                                                                                                */
+/**************************************************************************************************/
+HprofHeapDumpWriter::FieldLayout*
+HprofHeapDumpWriter::fieldLayout(J9Class* clazz)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	UDATA const objectHeaderSize = J9JAVAVM_OBJECT_HEADER_SIZE(_VirtualMachine);
+	J9InternalVMFunctions* vmFunctions = _VirtualMachine->internalVMFunctions;
+	FieldLayout  key;
+	FieldLayout* layout = NULL;
+
+	key._Class = clazz;
+	layout = (FieldLayout*)hashTableFind(_FieldLayouts, &key);
+	if (NULL != layout) {
+		return layout;
+	}
+
+	key._FieldCount = 0;
+	key._ValuesSize = 0;
+	key._Fields     = NULL;
+
+	/* Count the fields of the class and its superclasses */
+	for (UDATA pass = 0; pass < 2; pass++) {
+		UDATA index = 0;
+
+		for (J9Class* current = clazz; NULL != current; ) {
+			J9Class* superClass = (0 == J9CLASS_DEPTH(current)) ? NULL : current->superclasses[J9CLASS_DEPTH(current) - 1];
+			J9ROMFieldOffsetWalkState state;
+			J9ROMFieldOffsetWalkResult* result = vmFunctions->fieldOffsetsStartDo(_VirtualMachine, current->romClass, superClass, &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE
+#if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
+					, current->flattenedClassCache
+#endif /* defined(J9VM_OPT_VALHALLA_VALUE_TYPES) */
+					);
+
+			while (NULL != result->field) {
+				U_8 type = basicType(result->field);
+
+				if (0 == pass) {
+					key._FieldCount += 1;
+					key._ValuesSize += basicTypeSize(type);
+				} else {
+					key._Fields[index]._Offset = objectHeaderSize + result->offset;
+					key._Fields[index]._Type   = type;
+					index += 1;
+				}
+				result = vmFunctions->fieldOffsetsNextDo(&state);
+			}
+			current = superClass;
+		}
+
+		/* Allocate the descriptions once the fields have been counted */
+		if ((0 == pass) && (0 != key._FieldCount)) {
+			key._Fields = (FieldDescription*)j9mem_allocate_memory(key._FieldCount * sizeof(FieldDescription), OMRMEM_CATEGORY_VM);
+			if (NULL == key._Fields) {
+				break;
+			}
+		}
+	}
+
+	if ((0 != key._FieldCount) && (NULL == key._Fields)) {
+		checkForBufferError();
+		_Error = true;
+		return NULL;
+	}
+
+	layout = (FieldLayout*)hashTableAdd(_FieldLayouts, &key);
+	if (NULL == layout) {
+		j9mem_free_memory(key._Fields);
+		checkForBufferError();
+		_Error = true;
+	}
+
+	return layout;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::basicType() method implementation                                         */
+/*                                                                                                */
+/**************************************************************************************************/
+U_8
+HprofHeapDumpWriter::basicType(J9ROMFieldShape* field)
+{
+	J9UTF8* signature = J9ROMFIELDSHAPE_SIGNATURE(field);
+
+	switch (J9UTF8_DATA(signature)[0]) {
+		case 'Z': return booleanType();
+		case 'C': return charType();
+		case 'F': return floatType();
+		case 'D': return doubleType();
+		case 'B': return byteType();
+		case 'S': return shortType();
+		case 'I': return intType();
+		case 'J': return longType();
+	}
+
+	return objectType();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HprofHeapDumpWriter::basicTypeSize() method implementation                                     */
+/*                                                                                                */
+/**************************************************************************************************/
+UDATA
+HprofHeapDumpWriter::basicTypeSize(U_8 type)
+{
+	switch (type) {
+		case 4 : /* boolean */
+		case 8 : /* byte */
+			return 1;
+		case 5 : /* char */
+		case 9 : /* short */
+			return 2;
+		case 6 : /* float */
+		case 10: /* int */
+			return 4;
+		case 7 : /* double */
+		case 11: /* long */
+			return 8;
+	}
+
+	return _IdSize;
+}
+
+void
+HprofHeapDumpWriter::checkForIOError(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	if (_OutputStream.hasError()) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", j9error_last_error_message());
+		Trc_dump_reportDumpError_Event2("Heap", j9error_last_error_message());
+		_Error = true;
+	}
+}
+
+void
+HprofHeapDumpWriter::checkForBufferError(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	if (!_Error) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", "unable to allocate memory for the heap dump");
+		Trc_dump_reportDumpError_Event2("Heap", "unable to allocate memory for the heap dump");
+		_Error = true;
+	}
+}
+
+void
+HprofHeapDumpWriter::writeCharacters(const char* data, IDATA length)
+{
+	if (!_Error) {
+		if (_InSegment) {
+			_Segment.writeCharacters(data, length);
+			if (_Segment.hasError()) {
+				checkForBufferError();
+			}
+		} else {
+			_OutputStream.writeCharacters(data, length);
+
+			checkForIOError();
+		}
+	}
+}
+
+void
+HprofHeapDumpWriter::writeNumber(IDATA data, int length)
+{
+	if (!_Error) {
+		if (_InSegment) {
+			_Segment.writeNumber(data, length);
+			if (_Segment.hasError()) {
+				checkForBufferError();
+			}
+		} else {
+			_OutputStream.writeNumber(data, length);
+
+			checkForIOError();
+		}
+	}
+}
+
+void
+HprofHeapDumpWriter::writeU64(U_64 data)
+{
+	/* Split the number as IDATA is only 32 bits on some platforms */
+	writeNumber((IDATA)(U_32)(data >> 32), 4);
+	writeNumber((IDATA)(U_32)data, 4);
+}
+
+void
+HprofHeapDumpWriter::writeId(const void* id)
+{
+	writeNumber((IDATA)(UDATA)id, (int)_IdSize);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* HPROF iterator call back functions                                                             */
+/*                                                                                                */
+/**************************************************************************************************/
+static jvmtiIterationControl
+hprofHeapDumpHeapIteratorCallback(J9JavaVM* vm, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData)
+{
+	vm->memoryManagerFunctions->j9mm_iterate_spaces(vm, vm->portLibrary, heapDescriptor, 0, hprofHeapDumpSpaceIteratorCallback, userData);
+	return ((HprofHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+hprofHeapDumpSpaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDescriptor, void* userData)
+{
+	vm->memoryManagerFunctions->j9mm_iterate_regions(vm, vm->portLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, hprofHeapDumpRegionIteratorCallback, userData);
+	return ((HprofHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+hprofHeapDumpRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData)
+{
+	vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, vm->portLibrary, regionDescription, 0, hprofHeapDumpObjectIteratorCallback, userData);
+	return ((HprofHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+hprofHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData)
+{
+	((HprofHeapDumpWriter*)userData)->writeObjectRecord(objectDescriptor);
+	return ((HprofHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+hprofHeapDumpRootIteratorCallback(void* root, J9MM_HeapRootSlotDescriptor* rootDescriptor, void* userData)
+{
+	((HprofHeapDumpWriter*)userData)->writeRootRecord(root, rootDescriptor);
+	return ((HprofHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static UDATA
+hprofFieldLayoutHashFunction(void* entry, void* userData)
+{
+	return ((UDATA)((HprofHeapDumpWriter::FieldLayout*)entry)->_Class) / sizeof(UDATA);
+}
+
+static UDATA
+hprofFieldLayoutHashEqualFunction(void* left, void* right, void* userData)
+{
+	return ((HprofHeapDumpWriter::FieldLayout*)left)->_Class == ((HprofHeapDumpWriter::FieldLayout*)right)->_Class;
+}
+
+void
+writeHPROF(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
+{
+	HprofHeapDumpWriter(label, context, agent);
+}
+
+void
+writePHD(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
+{
+	BinaryHeapDumpWriter(label, context, agent);
+}
+
+/* Primary entry point */
+extern "C" void
+runHeapdump(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
+{
+	PORT_ACCESS_FROM_JAVAVM(context->javaVM);
+
+	if (agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
+		if (strstr(label, "%id") == NULL) {
+			/* multiple heaps requested but the %id insertion point has been removed */
+			j9nls_printf(PORTLIB, J9NLS_WARNING | J9NLS_STDERR, J9NLS_DMP_MULTIPLE_DUMP_OVERWRITE);
+		}
+	}
+
+	if (agent->dumpOptions && strstr(agent->dumpOptions, "CLASSIC")) {
+		writeClassicHeapdump(label, context, agent);
+	}
+
+	if (agent->dumpOptions && strstr(agent->dumpOptions, "PHD")) {
+		writePHD(label, context, agent);
+	}
+
+	if (agent->dumpOptions && strstr(agent->dumpOptions, "HPROF")) {
+		writeHPROF(label, context, agent);
 	}
 }
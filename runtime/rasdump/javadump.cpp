@@ -487,11 +487,13 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeMemorySection, _Error);
 
 	/* The monitor section is crash prone as objects mutate under it.
-	 * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutex ahead of the
-	 * thread lock as we will attempt to get it again for uninflated locks when calling getVMThreadRawState while looking
-	 * for waiting threads on any given monitor
+	 * Lock ordering imposed by the lock inflation path means that we have to get the monitor table locks ahead of the
+	 * thread lock as we will attempt to get them again for uninflated locks when calling getVMThreadRawState while looking
+	 * for waiting threads on any given monitor. The table locks are always taken in index order.
 	 */
-	omrthread_monitor_enter(_VirtualMachine->monitorTableMutex);
+	for (UDATA tableIndex = 0; tableIndex < _VirtualMachine->monitorTableCount; tableIndex++) {
+		omrthread_monitor_enter(_VirtualMachine->monitorTableStripes[tableIndex].mutex);
+	}
 	omrthread_t self = omrthread_self();
 	if (!omrthread_lib_try_lock(self)) {
 		/* got both locks so we shouldn't deadlock getting thread state */
@@ -506,7 +508,9 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 			"1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
 			"NULL           ------------------------------------------------------------------------\n");
 	}
-	omrthread_monitor_exit(_VirtualMachine->monitorTableMutex);
+	for (UDATA tableIndex = _VirtualMachine->monitorTableCount; tableIndex > 0; tableIndex--) {
+		omrthread_monitor_exit(_VirtualMachine->monitorTableStripes[tableIndex - 1].mutex);
+	}
 
 	/* If request=preempt (for native stack collection) we attempt to acquire the mutex and note if we got it */
 	if (_Agent->requestMask & J9RAS_DUMP_DO_PREEMPT_THREADS) {
@@ -1842,7 +1846,7 @@ JavaCoreDumpWriter::writeNativeAllocator(const char * name, U_32 depth, BOOLEAN
 void
 JavaCoreDumpWriter::writeMonitorSection(void)
 {
-	/* The code calling this method must have taken the monitorTableMutex and the thread library monitor_mutex
+	/* The code calling this method must have taken the monitor table locks and the thread library monitor_mutex
 	 * (in that order) prior to calling and must release those locks on return from this method.
 	 */
 	J9ThreadMonitor* monitor = NULL;
@@ -1868,6 +1872,26 @@ JavaCoreDumpWriter::writeMonitorSection(void)
 
 	_OutputStream.writeInteger(getObjectMonitorCount(_VirtualMachine), "%zu");
 	_OutputStream.writeCharacters("\n");
+
+	/* The counters are stable as we hold all of the monitor table locks */
+	UDATA tableHits = 0;
+	UDATA tableMisses = 0;
+	UDATA tableContended = 0;
+	for (UDATA tableIndex = 0; tableIndex < _VirtualMachine->monitorTableCount; tableIndex++) {
+		J9MonitorTableStripe *stripe = &_VirtualMachine->monitorTableStripes[tableIndex];
+		tableHits += stripe->hitCount;
+		tableMisses += stripe->missCount;
+		tableContended += stripe->contendedCount;
+	}
+	_OutputStream.writeCharacters("2LKPOOLTABLES    Monitor table lookups: ");
+	_OutputStream.writeInteger(tableHits, "%zu");
+	_OutputStream.writeCharacters(" found, ");
+	_OutputStream.writeInteger(tableMisses, "%zu");
+	_OutputStream.writeCharacters(" added, ");
+	_OutputStream.writeInteger(tableContended, "%zu");
+	_OutputStream.writeCharacters(" contended, in ");
+	_OutputStream.writeInteger(_VirtualMachine->monitorTableCount, "%zu");
+	_OutputStream.writeCharacters(" tables\n");
 	_OutputStream.writeCharacters("NULL\n");
 
 	/* Stack-allocate a store for blocked thread information, to save having to re-walk the threads. First
@@ -996,6 +996,10 @@ triggerDumpAgents(struct J9JavaVM *vm, struct J9VMThread *self, UDATA eventFlags
 						/* fake up a slot for the dual dump */
 						dumpAgentCount++;
 					}
+					if (node->dumpFn == doHeapDump && strstr(node->dumpOptions, "HPROF") && (strstr(node->dumpOptions, "CLASSIC") || strstr(node->dumpOptions, "PHD"))) {
+						/* and another for an HPROF dump written alongside them */
+						dumpAgentCount++;
+					}
 				}
 			}
 		}
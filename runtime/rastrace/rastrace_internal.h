@@ -48,6 +48,8 @@ extern "C" {
 #define UT_FASTPATH                   17
 #define UT_TRC_SPECIAL_MASK              0x3ff
 #define UT_TRACE_WRITE_PRIORITY       8
+#define UT_WRITE_BATCH_BUFFERS        8     /* Buffers written to a trace file with a single write */
+#define UT_LATE_RECORD_MILLIS         1000  /* Delay between queuing and writing a buffer after which it is late */
 #define UT_TRACE_INTERNAL             0
 #define UT_TRACE_EXTERNAL             1
 #define UT_STRUCT_ALIGN               4
@@ -430,6 +432,7 @@ int32_t             traceGenerations;       /* Number of trace files           *
 int32_t             nextGeneration;         /* Next generation of file         */
 int32_t             exceptTraceWrap;        /* Limit for exception trace file  */
 uint32_t             lostRecords;            /* Lost record counter             */
+uint32_t             lateRecords;            /* Records written late counter    */
 int32_t             platformTraceStarted;   /* Platform trace active flag      */
 int32_t             traceDebug;             /* Trace debug level               */
 int32_t             initialSuspendResume;   /* Initial thread suspend count    */
@@ -544,6 +547,11 @@ typedef struct TraceWorkerData {
 	intptr_t        exceptFile;
 	int64_t         exceptSize;
 	int64_t         maxExcept;
+	char           *batch;          /* Buffers waiting to be written, NULL if writes are not batched */
+	int32_t         batchLength;    /* Number of bytes in the batch */
+	int32_t         batchCapacity;
+	intptr_t        batchFile;      /* File the batched buffers are written to */
+	char           *batchFilename;
 } TraceWorkerData;
 
 /*
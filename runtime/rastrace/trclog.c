@@ -758,6 +758,72 @@ cleanup:
 }
 
 
+/*******************************************************************************
+ * name        - flushWriteBatch
+ * description - Write the buffers batched by the trace writer to their file
+ * parameters  - TraceWorkerData *
+ * returns     - OMR_ERROR_NONE on success, otherwise error
+ ******************************************************************************/
+static omr_error_t
+flushWriteBatch(TraceWorkerData *state)
+{
+	int32_t length = state->batchLength;
+	int32_t rc;
+	PORT_ACCESS_FROM_PORT(UT_GLOBAL(portLibrary));
+
+	if (length == 0) {
+		return OMR_ERROR_NONE;
+	}
+
+	state->batchLength = 0;
+	rc = (int32_t)j9file_write(state->batchFile, state->batch, length);
+	if (rc != length) {
+		/* Error writing %d bytes to tracefile: %s rc: %d */
+		j9nls_printf(PORTLIB, J9NLS_WARNING | J9NLS_STDERR, J9NLS_TRC_TRACE_WRITE_FAIL_STR, length, state->batchFilename, rc);
+		return OMR_ERROR_INTERNAL;
+	}
+
+	return OMR_ERROR_NONE;
+}
+
+/*******************************************************************************
+ * name        - batchWrite
+ * description - Write a buffer to a trace file, batching it with the buffers
+ *               written just before it to the same file when possible
+ * parameters  - TraceWorkerData *, file, filename, data, length
+ * returns     - OMR_ERROR_NONE on success, otherwise error
+ ******************************************************************************/
+static omr_error_t
+batchWrite(TraceWorkerData *state, intptr_t outputFile, char *filename, void *data, int32_t length)
+{
+	int32_t rc;
+	PORT_ACCESS_FROM_PORT(UT_GLOBAL(portLibrary));
+
+	if ((state->batchLength > 0) && ((state->batchFile != outputFile) || (state->batchLength + length > state->batchCapacity))) {
+		if (OMR_ERROR_NONE != flushWriteBatch(state)) {
+			return OMR_ERROR_INTERNAL;
+		}
+	}
+
+	if ((state->batch != NULL) && (length <= state->batchCapacity)) {
+		/* the buffer is copied as it is released back to the queue as soon as this returns */
+		memcpy(state->batch + state->batchLength, data, length);
+		state->batchLength += length;
+		state->batchFile = outputFile;
+		state->batchFilename = filename;
+		return OMR_ERROR_NONE;
+	}
+
+	rc = (int32_t)j9file_write(outputFile, data, length);
+	if (rc != length) {
+		/* Error writing %d bytes to tracefile: %s rc: %d */
+		j9nls_printf(PORTLIB, J9NLS_WARNING | J9NLS_STDERR, J9NLS_TRC_TRACE_WRITE_FAIL_STR, length, filename, rc);
+		return OMR_ERROR_INTERNAL;
+	}
+
+	return OMR_ERROR_NONE;
+}
+
 /*******************************************************************************
  * name        - writeBuffer
  * description - Trace Writer main function to write buffers to disk
@@ -777,6 +843,7 @@ writeBuffer(UtSubscription *subscription)
 	int32_t bufferType;
 	char *filename;
 	int32_t rc;
+	omr_error_t result = OMR_ERROR_NONE;
 	PORT_ACCESS_FROM_PORT(UT_GLOBAL(portLibrary));
 
 	thr = subscription->thr;
@@ -805,21 +872,23 @@ writeBuffer(UtSubscription *subscription)
 			break;
 		default:
 			/* not a buffer type we know about so skip it */
-			return OMR_ERROR_NONE;
+			return isNextMessageAvailable(subscription->queueSubscription) ? OMR_ERROR_NONE : flushWriteBatch(state);
 			break;
 	}
 
 	if (outputFile != -1) {
 		UT_DBGOUT(5, ("<UT thr=" UT_POINTER_SPEC "> writeBuffer writing buffer " UT_POINTER_SPEC " to %s\n", thr, trcBuf, filename));
 
+		/* Count buffers that waited too long on the queue, i.e. the writer is not keeping up */
+		if ((uint64_t)j9time_current_time_millis() - trcBuf->record.writeSystem > UT_LATE_RECORD_MILLIS) {
+			UT_ATOMIC_INC((volatile uint32_t*)&UT_GLOBAL(lateRecords));
+		}
+
 		/*
 		 *  Write the record
 		 */
 		*fileSize += subscription->dataLength;
-		rc = (int32_t)j9file_write(outputFile, subscription->data, (int32_t)subscription->dataLength);
-		if (rc != subscription->dataLength) {
-			/* Error writing %d bytes to tracefile: %s rc: %d */
-			j9nls_printf(PORTLIB, J9NLS_WARNING | J9NLS_STDERR, J9NLS_TRC_TRACE_WRITE_FAIL_STR, subscription->dataLength, filename, rc);
+		if (OMR_ERROR_NONE != batchWrite(state, outputFile, filename, subscription->data, (int32_t)subscription->dataLength)) {
 			*fileSize = -1;
 			return OMR_ERROR_INTERNAL;
 		}
@@ -828,6 +897,12 @@ writeBuffer(UtSubscription *subscription)
 		 * Check for file wrap
 		 */
 		if (*wrap != 0 && *fileSize >= *wrap) {
+			/* The batched buffers belong before the wrap point */
+			if (OMR_ERROR_NONE != flushWriteBatch(state)) {
+				*fileSize = -1;
+				return OMR_ERROR_INTERNAL;
+			}
+
 			/* Trace options may have changed, re-initialize the trace file header data if necessary */
 			initTraceHeader();
 			
@@ -871,7 +946,12 @@ writeBuffer(UtSubscription *subscription)
 		}
 	}
 
-	return OMR_ERROR_NONE;
+	/* Don't hold on to batched buffers while waiting for more to be queued */
+	if (!isNextMessageAvailable(subscription->queueSubscription)) {
+		result = flushWriteBatch(state);
+	}
+
+	return result;
 }
 
 
@@ -2313,6 +2393,11 @@ cleanupTraceWorkerThread(UtSubscription *subscription)
 	UT_GLOBAL(traceWriteStarted) = FALSE;
 	UT_GLOBAL(traceInitialized) = FALSE;
 
+	flushWriteBatch(data);
+	if (data->batch != NULL) {
+		j9mem_free_memory(data->batch);
+	}
+
 	if (data->trcFile != -1) {
 		closeTraceFile(data->trcFile, UT_GLOBAL(traceFilename),
 				data->maxTrc);
@@ -2380,10 +2465,22 @@ setupTraceWorkerThread(UtThreadData **thr)
 		}
 	}
 
+	/* Buffers queued while the writer is busy are written together, with a single write.
+	 * If the batch can't be allocated each buffer is written on its own.
+	 */
+	data->batchCapacity = UT_GLOBAL(bufferSize) * UT_WRITE_BATCH_BUFFERS;
+	data->batch = (char *)j9mem_allocate_memory(data->batchCapacity, OMRMEM_CATEGORY_TRACE);
+	data->batchLength = 0;
+	data->batchFile = -1;
+	data->batchFilename = NULL;
+
 	UT_DBGOUT(1, ("<UT> Registering trace write subscriber\n"));
 	result = trcRegisterRecordSubscriber(thr, "Trace Engine Thread", writeBuffer, cleanupTraceWorkerThread, data, NULL, NULL, &subscription, TRUE);
 
 	if (OMR_ERROR_NONE != result) {
+		if (data->batch != NULL) {
+			j9mem_free_memory(data->batch);
+		}
 		j9mem_free_memory( data);
 		/* Error registering trace write subscriber */
 		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_TRC_REGISTER_SUBSCRIBER_FAILED);
@@ -861,6 +861,9 @@ out:
 	if (UT_GLOBAL(lostRecords) != 0) {
 		UT_DBGOUT(1, ("<UT> Discarded %d trace buffers\n", UT_GLOBAL(lostRecords)));
 	}
+	if (UT_GLOBAL(lateRecords) != 0) {
+		UT_DBGOUT(1, ("<UT> %d trace buffers were written more than %d ms after being queued\n", UT_GLOBAL(lateRecords), UT_LATE_RECORD_MILLIS));
+	}
 	return result;
 }
 
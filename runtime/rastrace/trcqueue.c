@@ -1111,17 +1111,38 @@ unsubscribe(qSubscription *sub)
 
 /*
  * Wakes all subscribers waiting for messages on the queue
+ *
+ * This is called by every thread that publishes a buffer, so the alarm monitor is not entered
+ * if a wake up has already been posted and not yet consumed. The subscribers check the queue
+ * again after consuming the post, so they will find the message being notified.
  */
 void
 notifySubscribers(qQueue *queue)
 {
 	UtEventSem *alarm = queue->alarm;
 
-	if (alarm != NULL) {
+	if (alarm != NULL && alarm->pfmInfo.flags != UT_SEM_POSTED) {
 		postEventAll(alarm);
 	}
 }
 
+/*
+ * Returns TRUE if the message following the current message of the subscription has been
+ * published, i.e. if the next call to acquireNextMessage will not have to wait.
+ * This is only a hint: a FALSE result does not mean that acquireNextMessage will block.
+ */
+int32_t
+isNextMessageAvailable(qSubscription *sub)
+{
+	qMessage *current = sub->current;
+
+	if (current == NULL) {
+		return FALSE;
+	}
+
+	return IS_VALID_MSG_PTR(current->next);
+}
+
 /*
  * Calling this for a message that is queued or will be queued blocks freeing of
  * this and subsequent messages from the queue. This is useful mainly in
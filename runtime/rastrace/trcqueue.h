@@ -75,6 +75,7 @@ int32_t publishMessage(qQueue *queue, qMessage *msg);
 qMessage * acquireNextMessage(qSubscription *sub);
 void releaseCurrentMessage(qSubscription *sub);
 void notifySubscribers(qQueue *queue);
+int32_t isNextMessageAvailable(qSubscription *sub);
 
 void pauseDequeueAtMessage(qMessage *msg);
 void resumeDequeueAtMessage(qMessage *msg);
@@ -478,7 +478,7 @@ getInflatedMonitorState(const J9VMThread *targetThread, const omrthread_t j9self
  * The inflated monitor is usually stored in the object lockword, but
  * this function may need to look up the monitor in vm->monitorTable.
  * 
- * This function may block on vm->monitorTableMutex.
+ * This function may block on the lock of one of the vm->monitorTableStripes.
  * This function can work out-of-process.
  * 
  * @pre The object monitor must be inflated.
@@ -520,7 +520,7 @@ getLockWord(J9VMThread *vmThread, j9object_t object)
  * Search vm->monitorTable for the inflated monitor corresponding to an object.
  * Similar to monitorTableAt(), but doesn't add the monitor if it isn't found in the hashtable.
  * 
- * This function may block on vm->monitorTableMutex.
+ * This function may block on the lock of one of the vm->monitorTableStripes.
  * This function can work out-of-process.
  * 
  * @param[in] vm the JavaVM. For out-of-process: may be a local or target pointer. 
@@ -548,7 +548,7 @@ monitorTablePeekMonitor(J9JavaVM *vm, j9object_t object)
  * Search vm->monitorTable for the inflated monitor corresponding to an object.
  * Similar to monitorTableAt(), but doesn't add the monitor if it isn't found in the hashtable.
  * 
- * This function may block on vm->monitorTableMutex.
+ * This function may block on the lock of one of the vm->monitorTableStripes.
  * This function can work out-of-process.
  * 
  * @param[in] vm the JavaVM. For out-of-process: may be a local or target pointer. 
@@ -577,23 +577,21 @@ monitorTablePeek(J9JavaVM *vm, j9object_t object)
 	 */
 	if (0 != (J9OBJECT_FLAGS_FROM_CLAZZ_VM(vm, object) & (OBJECT_HEADER_HAS_BEEN_HASHED_IN_CLASS | OBJECT_HEADER_HAS_BEEN_MOVED_IN_CLASS))) {
 		J9HashTable *monitorTable = NULL;
-		omrthread_monitor_t mutex = vm->monitorTableMutex;
+		omrthread_monitor_t mutex = NULL;
 		J9ObjectMonitor key_objectMonitor;
 		J9ThreadAbstractMonitor key_monitor;
+		UDATA index = 0;
 
 		/* Create a "fake" monitor just to probe the hash-table */
 		key_monitor.userData = (UDATA)object;
 		key_objectMonitor.monitor = (omrthread_monitor_t) &key_monitor;
 		key_objectMonitor.hash = objectHashCode(vm, object);
+		index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
+		monitorTable = vm->monitorTables[index];
+		mutex = vm->monitorTableStripes[index].mutex;
 
 		omrthread_monitor_enter(mutex);
-		if (NULL == monitorTable) {
-			UDATA index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
-			monitorTable = vm->monitorTables[index];
-		}
-
 		monitor = hashTableFind(monitorTable, &key_objectMonitor);
-
 		omrthread_monitor_exit(mutex);
 	}
 	return monitor;
@@ -20,17 +20,112 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 #include "j9.h"
+#include "j9modron.h"
 #include "ut_j9vm.h"
 
 extern "C" {
 
+/**
+ * Compact the heap and lower the soft heap limit toward the live data, so that the
+ * committed heap written to the checkpoint image is as small as the GC allows.
+ * The soft limit is put back by restoreSoftMxAfterCheckpoint.
+ *
+ * Must be called while holding exclusive VM access.
+ */
+static void
+shrinkHeapForCheckpoint(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+	J9CRIUCheckpointState *checkpointState = vm->checkpointState;
+	UDATA committedHeap = 0;
+	UDATA usedHeap = 0;
+	UDATA targetHeap = 0;
+
+	/* J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT allows the GC to run while the current thread is holding
+	 * exclusive VM access. It also frees the nursery garbage that would otherwise be saved.
+	 */
+	mmFuncs->j9gc_modron_global_collect_with_overrides(currentThread, J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT);
+
+	/* Leave a quarter of the live data as free space, and never go below -Xms */
+	committedHeap = mmFuncs->j9gc_heap_total_memory(vm);
+	usedHeap = committedHeap - mmFuncs->j9gc_heap_free_memory(vm);
+	targetHeap = OMR_MAX(usedHeap + (usedHeap / 4), mmFuncs->j9gc_get_initial_heap_size(vm));
+	if (targetHeap < committedHeap) {
+		UDATA softMx = mmFuncs->j9gc_get_softmx(vm);
+		if (0 == mmFuncs->j9gc_set_softmx(vm, targetHeap)) {
+			checkpointState->softMxBeforeCheckpoint = softMx;
+			checkpointState->isSoftMxLoweredForCheckpoint = TRUE;
+			Trc_VM_jvmCheckpointHooks_heapShrunk(currentThread, softMx, mmFuncs->j9gc_get_softmx(vm));
+			/* The heap contracts toward the soft limit at the end of a collection */
+			mmFuncs->j9gc_modron_global_collect_with_overrides(currentThread, J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT);
+		}
+	}
+}
+
+/**
+ * Put back the soft heap limit lowered by shrinkHeapForCheckpoint, if it was lowered.
+ */
+static void
+restoreSoftMxAfterCheckpoint(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9CRIUCheckpointState *checkpointState = vm->checkpointState;
+	J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+
+	if (checkpointState->isSoftMxLoweredForCheckpoint) {
+		UDATA softMx = checkpointState->softMxBeforeCheckpoint;
+		/* A soft limit of 0 means none was set, which lets the restore adapt the heap limit */
+		if (0 == softMx) {
+			mmFuncs->j9gc_clear_softmx(vm);
+		} else {
+			mmFuncs->j9gc_set_softmx(vm, softMx);
+		}
+		checkpointState->isSoftMxLoweredForCheckpoint = FALSE;
+	}
+}
+
+/**
+ * Adapt the GC to the CPUs and memory of the machine the checkpoint is restored on,
+ * which can be very different from the machine the checkpoint was taken on.
+ *
+ * Must be called while holding exclusive VM access.
+ */
+static void
+reconfigureForRestore(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+	UDATA gcThreadCount = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	mmFuncs->j9gc_reconfigure_for_restore(currentThread);
+
+	mmFuncs->j9gc_modron_getConfigurationValueForKey(vm, j9gc_modron_configuration_gcThreadCount, &gcThreadCount);
+	Trc_VM_jvmRestoreHooks_reconfigured(currentThread, j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET),
+			j9sysinfo_get_physical_memory(), gcThreadCount, mmFuncs->j9gc_get_softmx(vm));
+}
+
 BOOLEAN
 jvmCheckpointHooks(J9VMThread *currentThread)
 {
 	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	I_64 startTime = j9time_nano_time();
+
+	Trc_VM_jvmCheckpointHooks_Entry(currentThread, mmFuncs->j9gc_heap_total_memory(vm), mmFuncs->j9gc_heap_free_memory(vm));
 
+	/* The JIT parks its compilation threads, releasing their scratch memory */
 	TRIGGER_J9HOOK_VM_PREPARING_FOR_CHECKPOINT(vm->hookInterface, currentThread);
 
+	if (0 == mmFuncs->j9gc_is_garbagecollection_disabled(vm)) {
+		shrinkHeapForCheckpoint(currentThread);
+	}
+
+	Trc_VM_jvmCheckpointHooks_Exit(currentThread, mmFuncs->j9gc_heap_total_memory(vm), mmFuncs->j9gc_heap_free_memory(vm),
+			(j9time_nano_time() - startTime) / 1000);
+
 	return TRUE;
 }
 
@@ -38,18 +133,49 @@ BOOLEAN
 jvmRestoreHooks(J9VMThread *currentThread)
 {
 	J9JavaVM *vm = currentThread->javaVM;
+	J9CRIUCheckpointState *checkpointState = vm->checkpointState;
+	J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	I_64 startTime = j9time_nano_time();
 
-	Assert_VM_notNull(vm->checkpointState);
+	Trc_VM_jvmRestoreHooks_Entry(currentThread);
+
+	Assert_VM_notNull(checkpointState);
 
-	if (vm->checkpointState->isNonPortableRestoreMode) {
-		vm->checkpointState->isCheckPointAllowed = FALSE;
+	if (checkpointState->isNonPortableRestoreMode) {
+		checkpointState->isCheckPointAllowed = FALSE;
 	}
 
+	restoreSoftMxAfterCheckpoint(currentThread);
+
+	reconfigureForRestore(currentThread);
+
+	/* The JIT re-reads the CPU entitlement before resuming its compilation threads */
 	TRIGGER_J9HOOK_VM_PREPARING_FOR_RESTORE(vm->hookInterface, currentThread);
 
+	Trc_VM_jvmRestoreHooks_Exit(currentThread, mmFuncs->j9gc_get_softmx(vm), (j9time_nano_time() - startTime) / 1000);
+
 	return TRUE;
 }
 
+void
+jvmCheckpointFailedHooks(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+
+	Trc_VM_jvmCheckpointFailedHooks_Entry(currentThread);
+
+	Assert_VM_notNull(vm->checkpointState);
+
+	restoreSoftMxAfterCheckpoint(currentThread);
+
+	/* The JIT resumes the compilation threads it suspended for the checkpoint */
+	TRIGGER_J9HOOK_VM_CHECKPOINT_FAILED(vm->hookInterface, currentThread);
+
+	Trc_VM_jvmCheckpointFailedHooks_Exit(currentThread, mmFuncs->j9gc_get_softmx(vm));
+}
+
 BOOLEAN
 isCRIUSupportEnabled(J9VMThread *currentThread)
 {
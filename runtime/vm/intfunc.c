@@ -403,6 +403,7 @@ J9InternalVMFunctions J9InternalFunctions = {
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 	jvmCheckpointHooks,
 	jvmRestoreHooks,
+	jvmCheckpointFailedHooks,
 	isCRIUSupportEnabled,
 	isCheckpointAllowed,
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
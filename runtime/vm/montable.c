@@ -132,9 +132,18 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 
-	if (omrthread_monitor_init_with_name(&vm->monitorTableMutex, 0, "VM monitor table")) {
+	/* Each table has its own lock so that threads inflating unrelated objects do not serialize */
+	vm->monitorTableStripes = (J9MonitorTableStripe *)j9mem_allocate_memory(sizeof(J9MonitorTableStripe) * tableCount, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableStripes) {
 		return -1;
 	}
+	memset(vm->monitorTableStripes, 0, sizeof(J9MonitorTableStripe) * tableCount);
+	vm->monitorTableCount = tableCount;
+	for (tableIndex = 0; tableIndex < tableCount; tableIndex++) {
+		if (omrthread_monitor_init_with_name(&vm->monitorTableStripes[tableIndex].mutex, 0, "VM monitor table")) {
+			return -1;
+		}
+	}
 
 	vm->monitorTableListPool = pool_new(sizeof(J9MonitorTableListEntry), 0, 0, 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(vm->portLibrary));
 	if (NULL == vm->monitorTableListPool) {
@@ -169,8 +178,6 @@ initializeMonitorTable(J9JavaVM* vm)
 		monitorTableListEntry->monitorTable = table;
 	}
 
-	vm->monitorTableCount = tableCount;
-	
 	return 0;
 }
 
@@ -203,9 +210,16 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTableListPool = NULL;
 	}
 
-	if (NULL != vm->monitorTableMutex) {
-		omrthread_monitor_destroy(vm->monitorTableMutex);
-		vm->monitorTableMutex = NULL;
+	if (NULL != vm->monitorTableStripes) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		UDATA tableIndex = 0;
+		for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+			if (NULL != vm->monitorTableStripes[tableIndex].mutex) {
+				omrthread_monitor_destroy(vm->monitorTableStripes[tableIndex].mutex);
+			}
+		}
+		j9mem_free_memory(vm->monitorTableStripes);
+		vm->monitorTableStripes = NULL;
 	}
 
 	/* Note: destroyMonitorTable is called after the GC hook interface has shut down,
@@ -224,7 +238,7 @@ J9ObjectMonitor *
 monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 {
 	J9JavaVM* vm = vmStruct->javaVM;
-	omrthread_monitor_t mutex = vm->monitorTableMutex;
+	J9MonitorTableStripe *stripe = NULL;
 	J9ObjectMonitor * objectMonitor = NULL;
 	J9ObjectMonitor key_objectMonitor;
 	J9ThreadAbstractMonitor key_monitor;
@@ -271,9 +285,13 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	key_objectMonitor.hash = objectHashCode(vm, object);
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
+	stripe = &vm->monitorTableStripes[index];
 
-
-	omrthread_monitor_enter(mutex);
+	if (0 != omrthread_monitor_try_enter(stripe->mutex)) {
+		omrthread_monitor_enter(stripe->mutex);
+		stripe->contendedCount += 1;
+		Trc_VM_monitorTableAt_StripeContended(vmStruct, index, stripe->contendedCount);
+	}
 
 	if (NULL == monitorTable){
 		TRACE("Out of memory creating tenant monitor table");
@@ -326,6 +344,9 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 				if (objectMonitor == NULL) {
 					omrthread_monitor_destroy(monitor);
 					TRACE("Out of memory adding to hash table");
+				} else {
+					stripe->missCount += 1;
+					Trc_VM_monitorTableAt_TableMiss(vmStruct, objectMonitor, index, stripe->missCount);
 				}
 			} else {
 				TRACE("Out of memory creating omrthread_monitor_t");
@@ -333,6 +354,8 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 			}
 		} else {
 			TRACE("Found monitor");
+			stripe->hitCount += 1;
+			Trc_VM_monitorTableAt_TableHit(vmStruct, objectMonitor, index, stripe->hitCount);
 		}
 	}
 
@@ -340,7 +363,7 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
 	}
 
-	omrthread_monitor_exit(mutex);
+	omrthread_monitor_exit(stripe->mutex);
 
 	Trc_VM_monitorTableAt_Exit(vmStruct, objectMonitor);
 
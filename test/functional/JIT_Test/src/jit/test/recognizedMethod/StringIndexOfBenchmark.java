@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package jit.test.recognizedMethod;
+
+/**
+ * Micro-benchmark for {@link String#indexOf(String)} on Latin1 and UTF16 strings.
+ * <p>
+ * Run it once with -Xint and once with the JIT, for example
+ * <pre>
+ * java -Xint -cp jitt.jar jit.test.recognizedMethod.StringIndexOfBenchmark
+ * java -Xjit -cp jitt.jar jit.test.recognizedMethod.StringIndexOfBenchmark
+ * java -Xjit:disableFastStringIndexOf -cp jitt.jar jit.test.recognizedMethod.StringIndexOfBenchmark
+ * </pre>
+ * to compare the inlined search with the Java implementation. The optional arguments are the number of
+ * iterations and the length of the searched strings.
+ */
+public class StringIndexOfBenchmark {
+
+    private static String buildLine(String filler, String pattern, int length) {
+        StringBuilder builder = new StringBuilder(length);
+        while (builder.length() < length - pattern.length()) {
+            builder.append(filler);
+        }
+        builder.setLength(length - pattern.length());
+        builder.append(pattern);
+        return builder.toString();
+    }
+
+    private static long run(String[] lines, String pattern, int iterations) {
+        long sum = 0;
+        for (int i = 0; i < iterations; i++) {
+            for (int j = 0; j < lines.length; j++) {
+                sum += lines[j].indexOf(pattern);
+            }
+        }
+        return sum;
+    }
+
+    private static void measure(String name, String[] lines, String pattern, int iterations) {
+        // Warm up so that run() is compiled when the JIT is enabled
+        long check = run(lines, pattern, Math.max(iterations / 10, 1));
+        long start = System.nanoTime();
+        check += run(lines, pattern, iterations);
+        long elapsed = System.nanoTime() - start;
+        System.out.println(name + ": " + (elapsed / ((long)iterations * lines.length)) + " ns per indexOf (checksum " + check + ")");
+    }
+
+    public static void main(String[] args) {
+        int iterations = (args.length > 0) ? Integer.parseInt(args[0]) : 100000;
+        int length = (args.length > 1) ? Integer.parseInt(args[1]) : 200;
+
+        String[] latin1Lines = {
+            buildLine("2021-06-01 12:00:00 INFO  [main] request served in 3 ms; ", " ERROR connection reset", length),
+            buildLine("EEEE RRRR OOOO ", " ERROR", length),
+            buildLine("abcdefghijklmnopqrstuvwxyz", "", length),
+        };
+        String[] utf16Lines = {
+            buildLine("2021-06-01 12:00:00 \u4FE1\u606F [main] request served in 3 ms; ", " ERROR connection reset", length),
+            buildLine("EEEE RRRR OOOO \u4E2D", " ERROR", length),
+            buildLine("abcdefghijklmnopqrstuvwxyz\u4E2D", "", length),
+        };
+
+        measure("Latin1 5 chars", latin1Lines, "ERROR", iterations);
+        measure("Latin1 22 chars", latin1Lines, "ERROR connection reset", iterations);
+        measure("UTF16 5 chars", utf16Lines, "ERROR", iterations);
+        measure("UTF16 22 chars", utf16Lines, "ERROR connection reset", iterations);
+    }
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package jit.test.recognizedMethod;
+import org.testng.AssertJUnit;
+import org.testng.annotations.Test;
+
+public class TestJavaLangCharacter {
+
+    /* Code points checked by each test; includes values on both sides of the Latin-1 range and invalid code points */
+    private static final int FIRST_CODE_POINT = -2;
+    private static final int LAST_CODE_POINT = 0x1FF;
+    private static final int[] OTHER_CODE_POINTS = { 0x660, 0x2028, 0x3000, 0xFF21, 0x10400, Character.MAX_CODE_POINT, Character.MAX_CODE_POINT + 1, Integer.MAX_VALUE, Integer.MIN_VALUE };
+
+    /*
+     * The expected results are derived from Character.getType, which is not
+     * a recognized method, following the definitions in the Character javadoc.
+     */
+    private static boolean isLetterType(int type) {
+        return type == Character.UPPERCASE_LETTER || type == Character.LOWERCASE_LETTER
+                || type == Character.TITLECASE_LETTER || type == Character.MODIFIER_LETTER
+                || type == Character.OTHER_LETTER;
+    }
+
+    private static boolean expectedIsWhitespace(int codePoint) {
+        int type = Character.getType(codePoint);
+        if (type == Character.SPACE_SEPARATOR || type == Character.LINE_SEPARATOR || type == Character.PARAGRAPH_SEPARATOR) {
+            return codePoint != 0xA0 && codePoint != 0x2007 && codePoint != 0x202F;
+        }
+        return (codePoint >= 0x09 && codePoint <= 0x0D) || (codePoint >= 0x1C && codePoint <= 0x1F);
+    }
+
+    private static void check(String method, int codePoint, boolean expected, boolean actual) {
+        AssertJUnit.assertEquals("Incorrect result for Character." + method + "(0x" + Integer.toHexString(codePoint) + ")", expected, actual);
+    }
+
+    private static void checkCodePoint(int codePoint) {
+        int type = Character.getType(codePoint);
+        check("isDigit", codePoint, type == Character.DECIMAL_DIGIT_NUMBER, Character.isDigit(codePoint));
+        check("isLetter", codePoint, isLetterType(type), Character.isLetter(codePoint));
+        check("isWhitespace", codePoint, expectedIsWhitespace(codePoint), Character.isWhitespace(codePoint));
+        if (codePoint >= 0 && codePoint <= 0xFF) {
+            /* Latin-1 has no Other_Uppercase or letter numbers; U+00AA and U+00BA are Other_Lowercase */
+            check("isUpperCase", codePoint, type == Character.UPPERCASE_LETTER, Character.isUpperCase(codePoint));
+            check("isLowerCase", codePoint, type == Character.LOWERCASE_LETTER || codePoint == 0xAA || codePoint == 0xBA, Character.isLowerCase(codePoint));
+            check("isAlphabetic", codePoint, isLetterType(type), Character.isAlphabetic(codePoint));
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public void test_java_lang_Character_isMethods() {
+        for (int codePoint = FIRST_CODE_POINT; codePoint <= LAST_CODE_POINT; codePoint++) {
+            checkCodePoint(codePoint);
+        }
+        for (int i = 0; i < OTHER_CODE_POINTS.length; i++) {
+            checkCodePoint(OTHER_CODE_POINTS[i]);
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public void test_java_lang_Character_isMethods_above_Latin1() {
+        /* These go through the Java implementation; check that the result comes back correctly */
+        AssertJUnit.assertTrue(Character.isDigit(0x0660));
+        AssertJUnit.assertTrue(Character.isLetter(0x0100));
+        AssertJUnit.assertTrue(Character.isUpperCase(0x0100));
+        AssertJUnit.assertTrue(Character.isLowerCase(0x0101));
+        AssertJUnit.assertTrue(Character.isAlphabetic(0x2160));
+        AssertJUnit.assertTrue(Character.isWhitespace(0x2028));
+        AssertJUnit.assertFalse(Character.isWhitespace(0x202F));
+        AssertJUnit.assertFalse(Character.isLetter(0x0300));
+    }
+}
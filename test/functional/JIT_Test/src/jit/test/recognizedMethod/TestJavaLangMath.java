@@ -55,4 +55,63 @@ public class TestJavaLangMath {
         AssertJUnit.assertEquals(Double.POSITIVE_INFINITY, Math.sqrt(Double.POSITIVE_INFINITY));
         AssertJUnit.assertTrue(Double.isNaN(Math.sqrt(Double.NaN)));
     }
+
+    /**
+    * Arguments for the floor, ceil and copySign tests, in an array so that the
+    * calls are not folded at compile time.
+    */
+    private static final double[] roundingInputs = {
+        -0.0d, +0.0d, -0.5d, +0.5d, -1.0d, +1.0d, -1.5d, +2.5d, 4503599627370495.5d, -4503599627370495.5d,
+        Double.MIN_VALUE, -Double.MIN_VALUE, Double.MAX_VALUE, -Double.MAX_VALUE,
+        Double.POSITIVE_INFINITY, Double.NEGATIVE_INFINITY, Double.NaN
+    };
+    private static final double[] expectedFloor = {
+        -0.0d, +0.0d, -1.0d, +0.0d, -1.0d, +1.0d, -2.0d, +2.0d, 4503599627370495.0d, -4503599627370496.0d,
+        +0.0d, -1.0d, Double.MAX_VALUE, -Double.MAX_VALUE,
+        Double.POSITIVE_INFINITY, Double.NEGATIVE_INFINITY, Double.NaN
+    };
+    private static final double[] expectedCeil = {
+        -0.0d, +0.0d, -0.0d, +1.0d, -1.0d, +1.0d, -1.0d, +3.0d, 4503599627370496.0d, -4503599627370495.0d,
+        +1.0d, -0.0d, Double.MAX_VALUE, -Double.MAX_VALUE,
+        Double.POSITIVE_INFINITY, Double.NEGATIVE_INFINITY, Double.NaN
+    };
+
+    /**
+    * Tests {@link Math#floor} and {@link Math#ceil}, which the JIT compiler may
+    * evaluate with a single rounding instruction. The sign of zero results must be
+    * preserved, so the results are compared with {@link Double#compare}.
+    */
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public void test_java_lang_Math_floor_ceil() {
+        for (int i = 0; i < roundingInputs.length; i++) {
+            AssertJUnit.assertEquals("Incorrect result for Math.floor(" + roundingInputs[i] + ")",
+                    0, Double.compare(expectedFloor[i], Math.floor(roundingInputs[i])));
+            AssertJUnit.assertEquals("Incorrect result for Math.ceil(" + roundingInputs[i] + ")",
+                    0, Double.compare(expectedCeil[i], Math.ceil(roundingInputs[i])));
+        }
+    }
+
+    /**
+    * Tests {@link Math#copySign}, which the JIT compiler may evaluate with
+    * bitwise operations.
+    */
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public void test_java_lang_Math_copySign() {
+        // NaN is last, and is neither used as a magnitude nor as a sign as its sign bit is not specified
+        for (int i = 0; i < roundingInputs.length - 1; i++) {
+            double magnitude = roundingInputs[i];
+            for (int j = 0; j < roundingInputs.length - 1; j++) {
+                double sign = roundingInputs[j];
+                double expected = ((Double.doubleToRawLongBits(sign) < 0) == (Double.doubleToRawLongBits(magnitude) < 0)) ? magnitude : -magnitude;
+                AssertJUnit.assertEquals("Incorrect result for Math.copySign(" + magnitude + ", " + sign + ")",
+                        Double.doubleToRawLongBits(expected), Double.doubleToRawLongBits(Math.copySign(magnitude, sign)));
+
+                float magnitudeF = (float)magnitude;
+                float signF = (float)sign;
+                float expectedF = ((Float.floatToRawIntBits(signF) < 0) == (Float.floatToRawIntBits(magnitudeF) < 0)) ? magnitudeF : -magnitudeF;
+                AssertJUnit.assertEquals("Incorrect result for Math.copySign(" + magnitudeF + ", " + signF + ")",
+                        Float.floatToRawIntBits(expectedF), Float.floatToRawIntBits(Math.copySign(magnitudeF, signF)));
+            }
+        }
+    }
 }
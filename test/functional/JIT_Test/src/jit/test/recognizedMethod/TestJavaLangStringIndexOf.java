@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package jit.test.recognizedMethod;
+import org.testng.AssertJUnit;
+import org.testng.annotations.Test;
+
+public class TestJavaLangStringIndexOf {
+
+    /**
+    * Reference implementation of {@link String#indexOf(String, int)} which is
+    * not itself a recognized method.
+    */
+    private static int naiveIndexOf(String s1, String s2, int fromIndex) {
+        fromIndex = Math.max(fromIndex, 0);
+        for (int i = fromIndex; i <= s1.length() - s2.length(); i++) {
+            if (s1.regionMatches(i, s2, 0, s2.length())) {
+                return i;
+            }
+        }
+        return (s2.length() == 0 && fromIndex >= s1.length()) ? s1.length() : -1;
+    }
+
+    private static void checkAllPositions(String s1, String s2) {
+        for (int fromIndex = -1; fromIndex <= s1.length() + 1; fromIndex++) {
+            AssertJUnit.assertEquals("Incorrect result for \"" + s1 + "\".indexOf(\"" + s2 + "\", " + fromIndex + ")",
+                    naiveIndexOf(s1, s2, fromIndex), s1.indexOf(s2, fromIndex));
+        }
+    }
+
+    /**
+    * Builds a string of the given length from the given alphabet, with the
+    * pattern placed at the given position if it is not negative.
+    */
+    private static String build(String alphabet, int length, String pattern, int position) {
+        StringBuilder builder = new StringBuilder(length);
+        for (int i = 0; i < length; i++) {
+            builder.append(alphabet.charAt(i % alphabet.length()));
+        }
+        if (position >= 0) {
+            builder.replace(position, position + pattern.length(), pattern);
+        }
+        return builder.toString();
+    }
+
+    private static void checkLengths(String alphabet, String pattern) {
+        for (int length = 0; length <= 48; length++) {
+            checkAllPositions(build(alphabet, length, pattern, -1), pattern);
+            for (int position = 0; position <= length - pattern.length(); position++) {
+                checkAllPositions(build(alphabet, length, pattern, position), pattern);
+            }
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public void test_java_lang_StringLatin1_indexOf() {
+        // Patterns whose first and last characters occur often in the string, so most candidates must be rejected
+        checkLengths("ab", "aab");
+        checkLengths("abc", "abcabcx");
+        checkLengths("xyz", "y");
+        checkLengths("a", "aaaaaaaaaaaaaaaaaaaaab");
+        checkLengths("\u00E9a", "a\u00E9\u00FF");
+        checkAllPositions("a long line of log output: ERROR ERROR WARN ERROR", "ERROR");
+        checkAllPositions("0123456789abcdef0123456789abcdef", "0123456789abcdef0123456789abcdef");
+        checkAllPositions("0123456789abcdef", "0123456789abcdef0");
+        checkAllPositions("abc", "");
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public void test_java_lang_StringUTF16_indexOf() {
+        checkLengths("\u0101b", "\u0101\u0101b");
+        checkLengths("ab\u4E2D", "ab\u4E2Dab\u4E2Dx");
+        checkLengths("\u4E2D\u6587", "\u6587");
+        checkLengths("\u0100\u0101", "\u0101\u0100\u0101\u0101");
+        // Characters with the same low or high byte as the pattern characters
+        checkLengths("a\u0161\u6100", "\u0161a");
+        checkAllPositions("\u4E2D\u6587\u4E2D\u6587\u4E2D\u6587\u4E2D\u6587\u4E2D\u6587\u4E2D\u6587\u4E2D\u6587\u4E2D", "\u6587\u4E2D\u6587\u4E2D\u6587\u4E2D\u6587\u4E2D\u6587");
+        checkAllPositions("\u4E2Dabc", "");
+    }
+}
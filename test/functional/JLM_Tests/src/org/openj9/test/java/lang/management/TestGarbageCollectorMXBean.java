@@ -88,6 +88,8 @@ public class TestGarbageCollectorMXBean {
 		attribs.put("MemoryUsed", new AttributeData(Long.TYPE.getName(), true, false, false));
 		attribs.put("TotalMemoryFreed", new AttributeData(Long.TYPE.getName(), true, false, false));
 		attribs.put("TotalCompacts", new AttributeData(Long.TYPE.getName(), true, false, false));
+		attribs.put("PendingFinalizationCount", new AttributeData(Long.TYPE.getName(), true, false, false));
+		attribs.put("OldestPendingFinalizationAge", new AttributeData(Long.TYPE.getName(), true, false, false));
 	}// end static initializer
 
 	private GarbageCollectorMXBean gcb;